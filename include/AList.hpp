@@ -10,66 +10,194 @@
  * Implement the List abstraction using a fixed sized array.
  * This array based implementation will dynamically allocate
  * a new block of memory once the current allocation becomes
- * full.  The new block is double in size of the old.  Thus
+ * full.  By default the new block is double in size of the old,
+ * though a different GrowthPolicy can be given to the list.  Thus
  * insertion at the end of the list can be O(1) in most cases,
  * but will take O(n) copies as well as a memory allocation
  * if it needs to grow.  Insertion in the middle or front
  * still requires shifting of items, so it is O(n).
+ *
+ * An AList can also be given room for a small number of values inside
+ * the list object itself.  An AList<T, InlineN> keeps up to InlineN
+ * values in this inline buffer, and only allocates a block of memory
+ * on the heap once it grows past that size.  Lists that usually stay
+ * small then never touch the heap at all.
+ *
+ * Indexing, getting and deleting values check by default that the
+ * access is legal.  An AList<T, InlineN, UncheckedBounds> skips these
+ * checks, for inner loops whose accesses are already known to be safe.
+ * The unchecked() and try methods give the same choice per call on any
+ * AList.
+ *
+ * The values of a list of trivially copyable values can also be kept
+ * in a list file mapped into memory with mapFile(), instead of memory
+ * on the heap.  The list then lives on in the file, with no loading
+ * step the next time it is mapped, and may be larger than physical
+ * memory.
  */
 #ifndef _ALIST_HPP_
 #define _ALIST_HPP_
 #include "AListIterator.hpp"
+#include "BoundsCheck.hpp"
+#include "GrowthPolicy.hpp"
 #include "List.hpp"
+#include "ListBinary.hpp"
+#include "MappedFile.hpp"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
 #include <string>
+#include <type_traits>
+#include <utility>
 using namespace std;
 
+/** @class AListInlineBuffer
+ * @brief Inline storage for the values of a small AList.
+ *
+ * Raw, suitably aligned storage for up to InlineN values of type T,
+ * kept inside of the AList object itself.  Like a heap allocated block,
+ * only the slots holding live values of the list are ever constructed.
+ */
+template<class T, int InlineN>
+struct AListInlineBuffer
+{
+  static_assert(InlineN > 0, "inline buffer size can not be negative");
+
+  /// @brief the raw bytes of the inline storage
+  alignas(T) unsigned char bytes[sizeof(T) * InlineN];
+
+  /// @brief access the inline storage as a block of values
+  T* data() const
+  {
+    return reinterpret_cast<T*>(const_cast<unsigned char*>(bytes));
+  }
+};
+
+/** @class AListInlineBuffer
+ * @brief An AList with no inline storage, values always live in a
+ *   block of memory allocated on the heap.
+ */
+template<class T>
+struct AListInlineBuffer<T, 0>
+{
+  /// @brief there is no inline storage to access
+  T* data() const
+  {
+    return nullptr;
+  }
+};
+
 /** @class AList
  * @brief The AList concrete array based implemention of the
  *   List interface.
  *
  * Concrete implementation of List abstraction using an
- * array based implementation.
+ * array based implementation.  The InlineN parameter gives the number
+ * of values that are stored inline in the list object before the list
+ * spills over into a heap allocated block, by default 0 so that all
+ * values live on the heap.  The BoundsCheck policy decides whether
+ * accesses are checked, by default CheckedBounds so that they are.
  */
-template<class T>
+template<class T, int InlineN = 0, class BoundsCheck = CheckedBounds>
 class AList : public List<T>
 {
 public:
   // constructors and destructors
   AList();                          // default constructor
-  AList(int size, T values[]);      // array based constructor
-  AList(const AList<T>& otherList); // copy constructor
+  explicit AList(const GrowthPolicy& growthPolicy);
+  AList(int size, T values[], const GrowthPolicy& growthPolicy = GrowthPolicy());
+  AList(const AList<T, InlineN, BoundsCheck>& otherList); // copy constructor
+  AList(AList<T, InlineN, BoundsCheck>&& otherList) noexcept(InlineN == 0 or is_nothrow_move_constructible<T>::value);
   ~AList();                         // destructor
 
+  // assignment operators
+  AList<T, InlineN, BoundsCheck>& operator=(const AList<T, InlineN, BoundsCheck>& rhs);
+  AList<T, InlineN, BoundsCheck>& operator=(AList<T, InlineN, BoundsCheck>&& rhs) noexcept(InlineN == 0 or is_nothrow_move_constructible<T>::value);
+
   // accessor and information methods
   int getAllocationSize() const;
+  GrowthPolicy getGrowthPolicy() const;
   T getFront() const;
   T getBack() const;
-  string str() const;
   bool operator==(const List<T>& rhs) const;
   T& operator[](int index) const;
 
+  // accessing and removing values without the checks of the
+  // methods above, or reporting failure instead of throwing
+  T& unchecked(int index) const;
+  T* data();
+  const T* data() const;
+  bool tryGetFront(T& value) const;
+  bool tryGetBack(T& value) const;
+  bool tryDeleteIndex(int index);
+
   // adding, accessing and removing values from the list
   void clear();
   List<T>& insertBack(const T& value);
+  List<T>& insertBack(T&& value);
   List<T>& operator>>(const T& value);
   void deleteBack();
   List<T>& insertFront(const T& value);
+  List<T>& insertFront(T&& value);
   List<T>& operator<<(const T& value);
   void deleteFront();
   void deleteValue(const T& value);
   void deleteIndex(int index);
+  List<T>& insertAt(int index, const T& value);
+  List<T>& insertAt(int index, T&& value);
+
+  // managing the memory allocation of the list
+  void reserve(int allocationSize);
+  void shrinkToFit();
+
+  // saving the values of the list to a binary file and loading them back
+  void saveBinary(const string& path) const;
+  void loadBinary(const string& path);
+
+  // keeping the values of the list in a file mapped into memory
+  template<class U = T>
+  void mapFile(const string& path, bool readOnly = false);
+  void syncFile();
+  void unmapFile();
+  bool isMapped() const;
+
+  // constructing new values directly in the list storage
+  template<class... Args>
+  T& emplaceBack(Args&&... args);
+  template<class... Args>
+  T& emplaceFront(Args&&... args);
+
+  // removing values in bulk, returning the number of values removed
+  template<class Predicate>
+  int removeIf(Predicate predicate);
+  template<class Range>
+  int removeAll(const Range& range);
+
+  // iterating over list the C++ way, using random access iterator
+  // objects and supporting range based iteration and <algorithm>
+  using value_type = T;
+  using iterator = AListIterator<T>;
+  using const_iterator = AListIterator<const T>;
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
 
-  // iterating over list the C++ way, using iterator objects
-  // and supporting range based iteration
-  ListIterator<T> begin();
-  ListIterator<T> end();
-  ListIterator<T> cbegin() const;
-  ListIterator<T> cend() const;
+protected:
+  // comparing values of lists, directly through our block of values
+  const T* contiguousValues() const;
+
+  // writing values out to a stream, walking through our own values
+  void writeValues(ListWriter<T>& writer, int first, int count) const;
 
 private:
-  /// @brief private constant, initial allocation size for empty lists
-  ///   to grow to
-  const int INITIAL_ALLOCATION_SIZE = 10;
+  /// @brief the policy deciding how large the allocation becomes
+  ///   when the list grows, and whether it shrinks as values are removed
+  GrowthPolicy growthPolicy;
 
   /// @brief the current amount of allocated memory being
   ///   managed by/for this list of values
@@ -78,11 +206,201 @@ private:
   /// @brief For the array based implementation, the values is a fixed
   ///   array of type T values.  The values contained in the list
   ///   will be manged from the array, and a new array allocated and
-  ///   values copied if we fill up the current allocation.
+  ///   values relocated if we fill up the current allocation.  The
+  ///   array is raw storage, only the first size slots hold
+  ///   constructed values.  While the list is small enough this
+  ///   points into the inline buffer instead of the heap.
   T* values;
 
+  /// @brief storage for up to InlineN values inside of the list itself
+  AListInlineBuffer<T, InlineN> inlineBuffer;
+
+  /// @brief the list file the values are mapped from, or nullptr while
+  ///   the values live in memory of the list itself
+  unique_ptr<MappedFile> mappedFile;
+
   // private member methods for managing the List internally
   void growListIfNeeded();
+  void shrinkListIfNeeded();
+  void reallocate(int newAllocationSize);
+  void shiftValuesUp(int index);
+  void shiftValuesDown(int index);
+  void copyValues(const T* source, int count);
+  void takeValues(AList<T, InlineN, BoundsCheck>& list);
+  bool usingInlineBuffer() const;
+  static T* allocateValues(int allocationSize);
+  void deallocateValues(T* values, int allocationSize);
+  T* mappedValues() const;
+  bool closeMappedFile();
 };
 
+/** @brief Emplace value on back
+ *
+ * Construct a new value at the end of this List from the given
+ * constructor arguments.  The arguments are perfectly forwarded to
+ * the constructor of T, so an rvalue argument is moved rather than
+ * copied into the list.
+ *
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns T& Returns a reference to the newly constructed value now
+ *   at the back of this list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+template<class... Args>
+T& AList<T, InlineN, BoundsCheck>::emplaceBack(Args&&... args)
+{
+  if (this->size < allocationSize)
+  {
+    // there is room, construct the value directly in the next free slot
+    new (values + this->size) T(forward<Args>(args)...);
+  }
+  else
+  {
+    // construct the value before growing, the arguments may refer to
+    // values in our current block of memory
+    T value(forward<Args>(args)...);
+    growListIfNeeded();
+    new (values + this->size) T(move(value));
+  }
+  this->size++;
+
+  return values[this->size - 1];
+}
+
+/** @brief Emplace value on front
+ *
+ * Construct a new value at the beginning of this List from the given
+ * constructor arguments.  Existing values are moved up by 1 index
+ * to make room, so this is still an O(n) operation for the array
+ * based list, but no values are copied.
+ *
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns T& Returns a reference to the newly constructed value now
+ *   at the front of this list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+template<class... Args>
+T& AList<T, InlineN, BoundsCheck>::emplaceFront(Args&&... args)
+{
+  // construct the value before growing, the arguments may refer to
+  // values in our current block of memory
+  T value(forward<Args>(args)...);
+
+  // first check and grow the memory allocation if needed
+  growListIfNeeded();
+
+  // an empty list has no values to shift, the new value simply
+  // becomes the first live value
+  if (this->isEmpty())
+  {
+    new (values) T(move(value));
+    this->size++;
+    return values[0];
+  }
+
+  // shift all items up by 1 index to make room at index 0
+  shiftValuesUp(0);
+  this->size++;
+
+  // now move the new value into the beginning of the current values
+  values[0] = move(value);
+
+  return values[0];
+}
+
+/** @brief Remove values matching predicate
+ *
+ * Remove every value of this list for which the predicate returns
+ * true, keeping the remaining values in their original order.  This
+ * is done in a single pass over the list, each value that is kept is
+ * moved down at most once to close up the holes left by removed
+ * values, so removing any number of values is O(n).  Unlike
+ * deleteValue() no exception is thrown if nothing is removed, the
+ * count of removed values tells the caller what happened.
+ *
+ * If the predicate throws, the values not yet tested are moved down
+ * so that the list is left holding valid values before rethrowing.
+ *
+ * @param predicate A callable taking a const T& and returning true
+ *   for values that should be removed.
+ *
+ * @returns int Returns the number of values removed from the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+template<class Predicate>
+int AList<T, InlineN, BoundsCheck>::removeIf(Predicate predicate)
+{
+  // kept is the number of values kept so far, they live in the
+  // slots before index kept
+  int kept = 0;
+  int index = 0;
+  try
+  {
+    for (; index < this->size; index++)
+    {
+      if (predicate(values[index]))
+      {
+        continue;
+      }
+
+      // close up any hole left by removed values
+      if (kept != index)
+      {
+        values[kept] = move(values[index]);
+      }
+      kept++;
+    }
+  }
+  catch (...)
+  {
+    // keep the untested values, moving them down over any holes
+    kept = move(values + index, values + this->size, values + kept) - values;
+    destroy(values + kept, values + this->size);
+    this->size = kept;
+    throw;
+  }
+
+  // the slots past the kept values were moved from or removed
+  int removed = this->size - kept;
+  destroy(values + kept, values + this->size);
+  this->size = kept;
+
+  // give memory back if the policy asks for it
+  if (removed > 0)
+  {
+    shrinkListIfNeeded();
+  }
+
+  return removed;
+}
+
+/** @brief Remove all values in range
+ *
+ * Remove every value of this list that is equal to one of the values
+ * in the given range, keeping the remaining values in their original
+ * order.  The range can be any container that supports range based
+ * iteration, such as a vector or an array.  Unlike deleteValue() no
+ * exception is thrown if nothing is removed, the count of removed
+ * values tells the caller what happened.  Each value of the list is
+ * searched for in the range, so this is O(n*m) for a range of m
+ * values.
+ *
+ * @param range The values that should be removed from this list.
+ *
+ * @returns int Returns the number of values removed from the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+template<class Range>
+int AList<T, InlineN, BoundsCheck>::removeAll(const Range& range)
+{
+  return removeIf([&range](const T& value) {
+    return find(std::begin(range), std::end(range), value) != std::end(range);
+  });
+}
+
+// template member definitions
+#include "AList.ipp"
+
 #endif // define _ALIST_HPP_
@@ -0,0 +1,1525 @@
+/** @file AList.ipp
+ * @brief Concrete array based implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using a fixed sized array.  This
+ * array based implementation will dynamically allocate a new block of
+ * memory once the current allocation becomes full.  The new block is
+ * double in size of the old.  Thus insertion at the end of the list
+ * can be O(1) in most cases, but will take O(n) copies as well as a
+ * memory allocation if it needs to grow.  Insertion in the middle or
+ * front still requires shifting of items, so it is O(n).  Lists with
+ * an inline buffer keep their first InlineN values inside of the list
+ * object and only allocate a block on the heap once they outgrow it.
+ *
+ * This file is included at the end of AList.hpp and is not compiled on
+ * its own.
+ */
+#include "AListIterator.hpp"
+#include "ListException.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/** @brief Default constructor
+ *
+ * Construct an empty list.  The empty list will have no allocated memory
+ * nor any values, other than its inline buffer if it has one.
+ */
+template<class T, int InlineN, class BoundsCheck>
+AList<T, InlineN, BoundsCheck>::AList()
+{
+  // Empty list has no values nor any allocated memory
+  // associated with it
+  this->size = 0;
+  this->allocationSize = InlineN;
+  values = inlineBuffer.data();
+}
+
+/** @brief Growth policy constructor
+ *
+ * Construct an empty list that will use the given policy to decide
+ * how its allocation grows and shrinks.
+ *
+ * @param growthPolicy The policy to use for the allocation of this list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+AList<T, InlineN, BoundsCheck>::AList(const GrowthPolicy& growthPolicy)
+{
+  this->size = 0;
+  this->allocationSize = InlineN;
+  this->growthPolicy = growthPolicy;
+  values = inlineBuffer.data();
+}
+
+/** @brief Standard constructor
+ *
+ * Construct a list of integer values from a (statically) defined and
+ * provided array of values.  We simply allocate a block of memory
+ * dynamically large enough to hold the values, then copy the values
+ * from the input parameter into our own private array of values.
+ *
+ * @param size The size of the input values were are given as well as the
+ *   size of the new list we are to construct.
+ * @param values The (static) array of string values to use to construct
+ *   this List values with.
+ * @param growthPolicy The policy to use for the allocation of this list,
+ *   the default policy doubles the allocation when the list is full.
+ */
+template<class T, int InlineN, class BoundsCheck>
+AList<T, InlineN, BoundsCheck>::AList(int size, T values[], const GrowthPolicy& growthPolicy)
+{
+  this->growthPolicy = growthPolicy;
+
+  // dynamically allocate a block of memory on the heap large enough to copy
+  // the given input values into, unless they fit in the inline buffer
+  this->size = 0;
+  this->allocationSize = InlineN;
+  this->values = inlineBuffer.data();
+  reserve(size);
+
+  // copy construct the values from the input paramter into our new shiny
+  // block of memory
+  copyValues(values, size);
+}
+
+/** @brief Copy constructor
+ *
+ * Provide a copy constructor for the List class.  A copy constructor
+ * will be invoked whenver you assign one instance of a List to another.
+ * For example
+ *   List newList = existingList;
+ * Where of course existingList was a previously created List.  This copy
+ * constructor, as the name suggests, should make a copy of the values from
+ * the given input list into a new List instance.
+ *
+ * The copy is allocated exactly large enough to hold the values, and
+ * uses the same growth policy as the list it copies.
+ *
+ * @param list The other List type we are to make a copy of in this
+ *   constructor.
+ */
+template<class T, int InlineN, class BoundsCheck>
+AList<T, InlineN, BoundsCheck>::AList(const AList<T, InlineN, BoundsCheck>& list)
+{
+  // allocate memory to hold the values we will copy
+  this->size = 0;
+  growthPolicy = list.growthPolicy;
+  allocationSize = InlineN;
+  values = inlineBuffer.data();
+  reserve(list.getSize());
+
+  // copy construct the values from the input List into this list
+  copyValues(list.values, list.getSize());
+}
+
+/** @brief Move constructor
+ *
+ * Construct this list by taking over the block of memory of the
+ * given list, which is left as an empty list.  No values are
+ * copied, so returning an AList from a function or moving one into
+ * a container is O(1).  Values held in an inline buffer can not be
+ * taken over, so those are moved one by one into our own buffer.
+ *
+ * @param list The other List whose values we are to take over.
+ */
+template<class T, int InlineN, class BoundsCheck>
+AList<T, InlineN, BoundsCheck>::AList(AList<T, InlineN, BoundsCheck>&& list) noexcept(InlineN == 0 or is_nothrow_move_constructible<T>::value)
+{
+  // start out as an empty list, then take over the values of the other list
+  this->size = 0;
+  allocationSize = InlineN;
+  growthPolicy = list.growthPolicy;
+  values = inlineBuffer.data();
+  takeValues(list);
+}
+
+/** @brief Class destructor
+ *
+ * Destructor for the List class.  A concrete List implementation must
+ * provide a clear() method to clear all items and safely deallocate any
+ * memory that the concrete instance is using.  Invoke the clear
+ * of the concrete subclass to perform the destruction.
+ */
+template<class T, int InlineN, class BoundsCheck>
+AList<T, InlineN, BoundsCheck>::~AList()
+{
+  // a mapped list leaves its values behind in its file, a destructor
+  // has no way to report it if closing the file fails
+  closeMappedFile();
+
+  // call clear to do actual work to deallocate any allocation
+  // before we destruct
+  this->clear();
+}
+
+/** @brief Copy assignment operator
+ *
+ * Replace the values of this list with a copy of the values of
+ * the right hand side list.  The copy is made first, so that
+ * this list is left unchanged if the copy fails.
+ *
+ * @param rhs The other List we are to make a copy of.
+ *
+ * @returns AList<T, InlineN, BoundsCheck>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T, int InlineN, class BoundsCheck>
+AList<T, InlineN, BoundsCheck>& AList<T, InlineN, BoundsCheck>::operator=(const AList<T, InlineN, BoundsCheck>& rhs)
+{
+  if (this != &rhs)
+  {
+    // copy into a temporary then move the copy into this list
+    AList<T, InlineN, BoundsCheck> copy(rhs);
+    *this = move(copy);
+  }
+
+  return *this;
+}
+
+/** @brief Move assignment operator
+ *
+ * Release the values of this list and take over the block of
+ * memory of the right hand side list, which is left as an
+ * empty list.
+ *
+ * @param rhs The other List whose values we are to take over.
+ *
+ * @returns AList<T, InlineN, BoundsCheck>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T, int InlineN, class BoundsCheck>
+AList<T, InlineN, BoundsCheck>& AList<T, InlineN, BoundsCheck>::operator=(AList<T, InlineN, BoundsCheck>&& rhs) noexcept(InlineN == 0 or is_nothrow_move_constructible<T>::value)
+{
+  if (this != &rhs)
+  {
+    // give back our own memory before taking over the other list, a
+    // mapped list leaves its values behind in its file
+    closeMappedFile();
+    clear();
+    growthPolicy = rhs.growthPolicy;
+    takeValues(rhs);
+  }
+
+  return *this;
+}
+
+/** @brief Allocation size accessor
+ *
+ * Accessor method to get the current amount of memory allocated
+ * by and being managed by this list.
+ *
+ * @returns int Returns the current allocation size of the
+ *   list of integers.
+ */
+template<class T, int InlineN, class BoundsCheck>
+int AList<T, InlineN, BoundsCheck>::getAllocationSize() const
+{
+  return allocationSize;
+}
+
+/** @brief Growth policy accessor
+ *
+ * Accessor method to get the policy this list uses to decide how its
+ * allocation grows and shrinks.
+ *
+ * @returns GrowthPolicy Returns a copy of the growth policy of the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+GrowthPolicy AList<T, InlineN, BoundsCheck>::getGrowthPolicy() const
+{
+  return growthPolicy;
+}
+
+/** @brief Access front of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the front of this list.
+ *
+ * @returns T Returns a copy of the front item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access front item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T, int InlineN, class BoundsCheck>
+T AList<T, InlineN, BoundsCheck>::getFront() const
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (BoundsCheck::enabled and this->isEmpty())
+  {
+    throw ListEmptyException("AList::getFront", this->size);
+  }
+
+  // otherwise safe to return the front item
+  return values[0];
+}
+
+/** @brief Access back of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the back of this list.
+ *
+ * @returns T Returns a copy of the back item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access back item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T, int InlineN, class BoundsCheck>
+T AList<T, InlineN, BoundsCheck>::getBack() const
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (BoundsCheck::enabled and this->isEmpty())
+  {
+    throw ListEmptyException("AList::getBack", this->size);
+  }
+
+  // otherwise safe to return the back item
+  return values[this->size - 1];
+}
+
+/** @brief Write values to stream
+ *
+ * Write the given range of values to the output stream, separated by a
+ * comma and a space, indexing its block of values directly rather than
+ * going through operator[] for each value.
+ *
+ * @param writer The stream or string to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write, at least 1.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::writeValues(ListWriter<T>& writer, int first, int count) const
+{
+  writer.writeValue(values[first]);
+  for (int index = first + 1; index < first + count; index++)
+  {
+    writer.writeText(", ");
+    writer.writeValue(values[index]);
+  }
+}
+
+/** @brief Boolean equals operator
+ *
+ * Check if this List is equal to the right hand side (rhs)
+ * list.  The lists are equal if their sizes are equal, and if
+ * all elements in both lists are equal.
+ * The comparison is done by List<T>::equals(), using whichever
+ * list is able to walk through its values fastest.
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this List to.
+ *
+ * @returns bool true if the lists are equal, false if the are not.
+ */
+template<class T, int InlineN, class BoundsCheck>
+bool AList<T, InlineN, BoundsCheck>::operator==(const List<T>& rhs) const
+{
+  // the list that can walk through its own values does the comparing
+  return this->equals(rhs);
+}
+
+/** @brief Contiguous values
+ *
+ * The values of an array based list are contiguous, so comparisons with any other
+ * list of contiguous values compare the two blocks of values directly.
+ *
+ * @returns const T* Returns a pointer to the first of the size values.
+ */
+template<class T, int InlineN, class BoundsCheck>
+const T* AList<T, InlineN, BoundsCheck>::contiguousValues() const
+{
+  return values;
+}
+
+/** @brief Indexing operator
+ *
+ * Provide a way to index individual values in our private
+ * internal array of integers.  This allows code to, for the
+ * most part, treated an instance of our List as if it were
+ * an array, though we also provide bounds checking to ensure
+ * no illegal access beyond the list bounds is attempted.  The check,
+ * like those of the other accessors, is compiled out of a list with
+ * the UncheckedBounds policy.
+ *
+ * @param index The index of the value it is desired to access from
+ *   this List.
+ *
+ * @returns int& Returns a reference to the requested List item at
+ *   the requested index.
+ *
+ * @throws ListMemoryBoundsException if a request for an index beyond
+ *   the end of the array (or less than 0) is made.
+ */
+template<class T, int InlineN, class BoundsCheck>
+T& AList<T, InlineN, BoundsCheck>::operator[](int index) const
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if (BoundsCheck::enabled and ((index < 0) or (index >= this->size)))
+  {
+    throw ListMemoryBoundsException("AList::operator[]", this->size, index);
+  }
+
+  // otherwise it is safe to return the reference to this value
+  return values[index];
+}
+
+/** @brief Clear out list
+ *
+ * Clear or empty out the list.  Return the list back
+ * to an empty list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::clear()
+{
+  // only the live values of the list were ever constructed, so only
+  // those need to be destroyed before we give the block back
+  destroy(values, values + this->size);
+
+  // a list mapped from a writable file stays in the file, which is cut
+  // down to hold no values
+  if (mappedFile != nullptr and not mappedFile->isReadOnly())
+  {
+    this->size = 0;
+    reallocate(InlineN);
+    return;
+  }
+
+  // give back any dynamic block of memory, the list goes back to using
+  // only its inline buffer
+  deallocateValues(values, allocationSize);
+  values = inlineBuffer.data();
+
+  // make sure size is 0 and allocation is back to the inline buffer now
+  this->size = 0;
+  allocationSize = InlineN;
+}
+
+/** @brief Insert value on back
+ *
+ * Append the indicated value to the end of this List
+ * of values.  This method will grow the list allocation if
+ * needed to accomodate appending the new value.  This method
+ * returns a reference to this instance, so that the result can
+ * be used in chained expressions of List types.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T, int InlineN, class BoundsCheck>
+List<T>& AList<T, InlineN, BoundsCheck>::insertBack(const T& value)
+{
+  // construct a copy of the value in the next free slot
+  emplaceBack(value);
+
+  // return a reference to this instance so that append operation
+  // can be used in chained expressions of List objects
+  return *this;
+}
+
+/** @brief Insert moved value on back
+ *
+ * Append the indicated value to the end of this List of values,
+ * moving the value into the list instead of copying it.
+ *
+ * @param value The value to move onto the end of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T, int InlineN, class BoundsCheck>
+List<T>& AList<T, InlineN, BoundsCheck>::insertBack(T&& value)
+{
+  emplaceBack(move(value));
+  return *this;
+}
+
+/** @brief Overload operator>> to append
+ *
+ * Overload the operator>> to perform append operation.  Implementation
+ * is actually done by the insertBack() member function.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T, int InlineN, class BoundsCheck>
+List<T>& AList<T, InlineN, BoundsCheck>::operator>>(const T& value)
+{
+  return insertBack(value);
+}
+
+/** @brief Unchecked indexing
+ *
+ * Access the value at the given index without checking that the index
+ * is within the list, whatever the BoundsCheck policy of the list.
+ * This is for inner loops that already keep their indexes within
+ * 0 to size - 1, and accessing any other index is undefined behavior.
+ *
+ * @param index The index of the value to access, which must be a legal
+ *   index of the list.
+ *
+ * @returns T& Returns a reference to the value at the index.
+ */
+template<class T, int InlineN, class BoundsCheck>
+T& AList<T, InlineN, BoundsCheck>::unchecked(int index) const
+{
+  return values[index];
+}
+
+/** @brief Data accessor
+ *
+ * Access the contiguous block of values of the list directly, for
+ * code such as a ListView that reads the values in place.  The block
+ * moves whenever the list reallocates, so the pointer is only good
+ * until the list next grows or shrinks.
+ *
+ * @returns T* Returns a pointer to the first of the size values of the
+ *   list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+T* AList<T, InlineN, BoundsCheck>::data()
+{
+  return values;
+}
+
+/** @brief Data accessor of constant list
+ *
+ * Access the contiguous block of values of a const list directly, only
+ * for reading them.
+ *
+ * @returns const T* Returns a pointer to the first of the size values
+ *   of the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+const T* AList<T, InlineN, BoundsCheck>::data() const
+{
+  return values;
+}
+
+/** @brief Try to access front of list
+ *
+ * Get a copy of the front value of the list if there is one.  Unlike
+ * getFront() an empty list is not an error, so no exception is
+ * built or thrown for it.
+ *
+ * @param value Set to a copy of the front value of the list, or left
+ *   unchanged if the list is empty.
+ *
+ * @returns bool Returns true if the list had a front value, false if
+ *   the list was empty.
+ */
+template<class T, int InlineN, class BoundsCheck>
+bool AList<T, InlineN, BoundsCheck>::tryGetFront(T& value) const
+{
+  if (this->isEmpty())
+  {
+    return false;
+  }
+
+  value = values[0];
+  return true;
+}
+
+/** @brief Try to access back of list
+ *
+ * Get a copy of the back value of the list if there is one.  Unlike
+ * getBack() an empty list is not an error, so no exception is
+ * built or thrown for it.
+ *
+ * @param value Set to a copy of the back value of the list, or left
+ *   unchanged if the list is empty.
+ *
+ * @returns bool Returns true if the list had a back value, false if
+ *   the list was empty.
+ */
+template<class T, int InlineN, class BoundsCheck>
+bool AList<T, InlineN, BoundsCheck>::tryGetBack(T& value) const
+{
+  if (this->isEmpty())
+  {
+    return false;
+  }
+
+  value = values[this->size - 1];
+  return true;
+}
+
+/** @brief Try to delete value at index
+ *
+ * Delete the value at the given index if it is a legal index of the
+ * list.  Unlike deleteIndex() an illegal index is not an error, the
+ * list is simply left unchanged.
+ *
+ * @param index The index of the value in the list to be removed.
+ *
+ * @returns bool Returns true if the value was removed, false if the
+ *   index was not within the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+bool AList<T, InlineN, BoundsCheck>::tryDeleteIndex(int index)
+{
+  if ((index < 0) or (index >= this->size))
+  {
+    return false;
+  }
+
+  shiftValuesDown(index);
+  shrinkListIfNeeded();
+  return true;
+}
+
+/** @brief Delete back item
+ *
+ * Delete the item from the back of the list.  This is a
+ * trivial O(1) operation for an array based implementation.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::deleteBack()
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (BoundsCheck::enabled and this->isEmpty())
+  {
+    throw ListEmptyException("AList::deleteBack", this->size);
+  }
+
+  // removing back item of an array means destroying it and reducing size by 1
+  this->size -= 1;
+  values[this->size].~T();
+
+  // give memory back if the policy asks for it
+  shrinkListIfNeeded();
+}
+
+/** @brief Insert value on front
+ *
+ * Prepend the indicated value to the beginning of this List
+ * of values.  This method will grow the list allocation if
+ * needed to accomodate prepending the new value.  This method
+ * returns a reference to this instance, so that the result can
+ * be used in chained expressions of List types.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T, int InlineN, class BoundsCheck>
+List<T>& AList<T, InlineN, BoundsCheck>::insertFront(const T& value)
+{
+  // shift values up and construct a copy of the value at index 0
+  emplaceFront(value);
+
+  // return a reference to this instance so that append operation
+  // can be used in chained expressions of List objects
+  return *this;
+}
+
+/** @brief Insert moved value on front
+ *
+ * Prepend the indicated value to the beginning of this List of
+ * values, moving the value into the list instead of copying it.
+ *
+ * @param value The value to move onto the beginning of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T, int InlineN, class BoundsCheck>
+List<T>& AList<T, InlineN, BoundsCheck>::insertFront(T&& value)
+{
+  emplaceFront(move(value));
+  return *this;
+}
+
+/** @brief Overload operator<< to prepend
+ *
+ * Overload the operator<< to perform prepend operation.  Implementation
+ * is actually done by the insertFront() member function.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T, int InlineN, class BoundsCheck>
+List<T>& AList<T, InlineN, BoundsCheck>::operator<<(const T& value)
+{
+  return insertFront(value);
+}
+
+/** @brief Delete front item
+ *
+ * Delete the item from the front of the list.  This operation
+ * is expensive for an array as we have to shift all items
+ * back down, giving O(n) performance to remove the front item.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::deleteFront()
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (BoundsCheck::enabled and this->isEmpty())
+  {
+    throw ListEmptyException("AList::deleteFront", this->size);
+  }
+
+  // shift all values down by 1 over the front value
+  shiftValuesDown(0);
+
+  // give memory back if the policy asks for it
+  shrinkListIfNeeded();
+}
+
+/** @brief Delete value(s)
+ *
+ * Delete the value from the list.  This method will delete all
+ * instances of the value from this list that it finds.  If the list
+ * does not conatin the value, then an exception is thrown.  All of
+ * the values are removed in a single O(n) pass using removeIf().
+ *
+ * @param value The value to deleted from this list.
+ *
+ * @throws ListValueNotFoundException If we are asked to delete a value
+ *   that does not exist, we thrown an exception instead of silently
+ *   ignoring this condition.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::deleteValue(const T& value)
+{
+  // remove every instance of the value in one pass through the list
+  int removed = removeIf([&value](const T& listValue) {
+    return listValue == value;
+  });
+
+  // if we didn't find a value to delete, let the caller know there
+  // may have been a problem
+  if (removed == 0)
+  {
+    throw ListValueNotFoundException("AList::deleteValue", value);
+  }
+}
+
+/** @brief Delete value at index
+ *
+ * Delete the value from the indicated index in this
+ * list.
+ *
+ * @param index The index of the value in the list to be removed.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the array or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::deleteIndex(int index)
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if (BoundsCheck::enabled and ((index < 0) or (index >= this->size)))
+  {
+    throw ListMemoryBoundsException("AList::deleteIndex", this->size, index);
+  }
+
+  // otherwise need to delete the item by shifting all items down from
+  // this position to the end of the array by 1 index
+  shiftValuesDown(index);
+
+  // give memory back if the policy asks for it
+  shrinkListIfNeeded();
+}
+
+/** @brief Insert value at index
+ *
+ * Insert the indicated value into this list so that it ends up at the
+ * given index.  The values from the index to the back are shifted up
+ * by 1 index to make room, so this is an O(n) operation.  Inserting at
+ * the size of the list appends the value on the back.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to insert into the list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T, int InlineN, class BoundsCheck>
+List<T>& AList<T, InlineN, BoundsCheck>::insertAt(int index, const T& value)
+{
+  return insertAt(index, T(value));
+}
+
+/** @brief Insert moved value at index
+ *
+ * Insert the indicated value into this list at the given index,
+ * moving the value into the list instead of copying it.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to move into the list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T, int InlineN, class BoundsCheck>
+List<T>& AList<T, InlineN, BoundsCheck>::insertAt(int index, T&& value)
+{
+  // the index can be 1 past the back, which appends the value
+  if (BoundsCheck::enabled and ((index < 0) or (index > this->size)))
+  {
+    throw ListMemoryBoundsException("AList::insertAt", this->size, index);
+  }
+
+  if (index == this->size)
+  {
+    emplaceBack(move(value));
+    return *this;
+  }
+
+  // take the value before growing, it may refer to a value in our
+  // current block of memory
+  T newValue(move(value));
+  growListIfNeeded();
+
+  // shift the items from the index up by 1 to make room
+  shiftValuesUp(index);
+  this->size++;
+  values[index] = move(newValue);
+
+  return *this;
+}
+
+/** @brief Reserve allocation
+ *
+ * Make sure the allocation of this list can hold at least the given
+ * number of values, so that a known number of insertions can be made
+ * without the list growing more than once.  The allocation is never
+ * reduced by this method.
+ *
+ * @param allocationSize The number of values the list should be able
+ *   to hold without growing.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::reserve(int allocationSize)
+{
+  if (allocationSize > this->allocationSize)
+  {
+    reallocate(allocationSize);
+  }
+}
+
+/** @brief Shrink allocation to fit
+ *
+ * Reduce the allocation of this list so that it is exactly large
+ * enough to hold its current values, giving any unused memory back to
+ * the heap.  An empty list gives back all of its memory.  A list that
+ * fits in its inline buffer moves its values back into that buffer.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::shrinkToFit()
+{
+  if (this->size < allocationSize)
+  {
+    reallocate(this->size);
+  }
+}
+
+/** @brief Save list to binary file
+ *
+ * Save the values of this list to a list file, replacing any file
+ * already at the path.  Values of a trivially copyable type are written
+ * as one contiguous block straight from the allocation of the list.
+ * Strings are written as a table of where each string ends, followed by
+ * all of their characters.
+ *
+ * @param path The path of the file to save the list to.
+ *
+ * @throws ListFileException If the file can not be written.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::saveBinary(const string& path) const
+{
+  ListBinaryWriter<T> writer("AList::saveBinary", path);
+  writer.write(values, this->size);
+}
+
+/** @brief Load list from binary file
+ *
+ * Replace the values of this list with the values of a list file
+ * saved by saveBinary() of any kind of list holding the same type of
+ * value.  The list is allocated exactly once, at the size given by the
+ * header of the file, and values of a trivially copyable type are read
+ * straight into that allocation as one block.  Strings are read through
+ * one temporary buffer holding the whole table and blob of characters.
+ * A file that is refused leaves the list unchanged, and if reading
+ * the values fails part way the list is left empty.
+ *
+ * @param path The path of the file to load the list from.
+ *
+ * @throws ListFileException If the file can not be read, or does not
+ *   hold a list of values of type T.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::loadBinary(const string& path)
+{
+  ListBinaryReader<T> reader("AList::loadBinary", path);
+  clear();
+  reserve(reader.getCount());
+
+  try
+  {
+    if (reader.readBlock(values))
+    {
+      this->size = reader.getCount();
+    }
+    else
+    {
+      reader.readValues([this](T&& value) { emplaceBack(move(value)); });
+    }
+  }
+  catch (...)
+  {
+    clear();
+    throw;
+  }
+}
+
+/** @brief Map list file
+ *
+ * Keep the values of this list in a list file mapped into memory,
+ * instead of in memory of the list itself.  The current values of the
+ * list are given back.  The values in the file become the values of
+ * the list straight away, and are only read from the disk as they are
+ * used, so even a huge list is ready with no loading step.  Only lists
+ * of trivially copyable values can be mapped.  This is checked when the
+ * list is compiled, which is why mapFile() is a member template, the
+ * explicit instances of lists of other values do not compile it.
+ *
+ * A writable file is created as an empty list if it does not exist,
+ * and otherwise must be a list file of values of type T, such as one
+ * saved by saveBinary().  Changing the list changes the file, and the
+ * list grows and shrinks the file with ftruncate and its mapping with
+ * mremap, instead of copying its values to a new block.  The size of
+ * the list is recorded in the file by syncFile() and unmapFile(), and
+ * when the list is destroyed or assigned another list.
+ *
+ * A read only file is mapped copy on write.  The list can still be
+ * changed, but the file never is, and the first time the list needs to
+ * grow its values are copied to the heap and the file is unmapped.
+ *
+ * @param path The path of the list file to map.
+ * @param readOnly True to never change the file, false to keep the
+ *   changes to the list in the file.
+ *
+ * @throws ListFileException If the file can not be mapped, or does not
+ *   hold a list of values of type T.  The list is left unchanged.
+ */
+template<class T, int InlineN, class BoundsCheck>
+template<class U>
+void AList<T, InlineN, BoundsCheck>::mapFile(const string& path, bool readOnly)
+{
+  static_assert(is_same<U, T>::value and is_trivially_copyable<U>::value, "only lists of trivially copyable values can be mapped, use saveBinary() and loadBinary() instead");
+  static_assert(alignof(T) <= alignof(ListBinaryHeader), "mapped values can not need more alignment than the file header");
+  unique_ptr<MappedFile> file(new MappedFile("AList::mapFile", path, readOnly));
+
+  // a new writable file starts out as an empty list
+  if (file->getLength() == 0 and not readOnly)
+  {
+    file->resize("AList::mapFile", sizeof(ListBinaryHeader));
+    *reinterpret_cast<ListBinaryHeader*>(file->getData()) = makeListBinaryHeader<T>(0, 0);
+  }
+
+  if (file->getLength() < sizeof(ListBinaryHeader))
+  {
+    throw ListFileException("AList::mapFile", path, "not a list file");
+  }
+  const ListBinaryHeader& header = *reinterpret_cast<const ListBinaryHeader*>(file->getData());
+  const char* problem = findListBinaryHeaderProblem<T>(header);
+  if (problem != nullptr)
+  {
+    throw ListFileException("AList::mapFile", path, problem);
+  }
+  uint64_t room = (file->getLength() - sizeof(ListBinaryHeader)) / sizeof(T);
+  if (header.count > room or header.dataSize != header.count * sizeof(T))
+  {
+    throw ListFileException("AList::mapFile", path, "list file is truncated or corrupt");
+  }
+
+  // give back the current values, then take over those of the file
+  unmapFile();
+  clear();
+  mappedFile = move(file);
+  values = mappedValues();
+  this->size = header.count;
+  allocationSize = readOnly ? this->size : static_cast<int>(min(room, static_cast<uint64_t>(numeric_limits<int>::max())));
+}
+
+/** @brief Sync list file
+ *
+ * Record the current size of a list mapped from a writable file in the
+ * file, and wait for all of the changed values to be written to the
+ * disk.  A list that is not mapped from a writable file has nothing to
+ * write.
+ *
+ * @throws ListFileException If the values can not be written.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::syncFile()
+{
+  if (mappedFile != nullptr and not mappedFile->isReadOnly())
+  {
+    *reinterpret_cast<ListBinaryHeader*>(mappedFile->getData()) = makeListBinaryHeader<T>(this->size, static_cast<uint64_t>(this->size) * sizeof(T));
+    mappedFile->sync("AList::syncFile");
+  }
+}
+
+/** @brief Unmap list file
+ *
+ * Stop keeping the values of this list in its mapped file.  A writable
+ * file is left holding exactly the values of the list, as a list file
+ * that can be mapped again or loaded by any list, and the list itself
+ * is left empty.
+ *
+ * @throws ListFileException If the file could not be cut down to the
+ *   size of the list.  The list is still unmapped and left empty.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::unmapFile()
+{
+  if (mappedFile == nullptr)
+  {
+    return;
+  }
+
+  string path = mappedFile->getPath();
+  if (not closeMappedFile())
+  {
+    throw ListFileException("AList::unmapFile", path, "could not write list file");
+  }
+}
+
+/** @brief Mapped test
+ *
+ * @returns bool Returns true if the values of this list are kept in a
+ *   mapped list file.
+ */
+template<class T, int InlineN, class BoundsCheck>
+bool AList<T, InlineN, BoundsCheck>::isMapped() const
+{
+  return mappedFile != nullptr;
+}
+
+/** @brief Begin iterator
+ *
+ * Create and return an iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns iterator returns a new random access iterator that keeps
+ *   track of iterating over the list items.
+ */
+template<class T, int InlineN, class BoundsCheck>
+typename AList<T, InlineN, BoundsCheck>::iterator AList<T, InlineN, BoundsCheck>::begin()
+{
+  return iterator(values);
+}
+
+/** @brief End iterator
+ *
+ * Return an iterator pointing just past the last value
+ * of this list, which is used to detect we are
+ * at the end of the list when iteration.
+ *
+ * @returns iterator returns a new random access iterator that points
+ *   to the end of the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+typename AList<T, InlineN, BoundsCheck>::iterator AList<T, InlineN, BoundsCheck>::end()
+{
+  return iterator(values + this->size);
+}
+
+/** @brief Begin iterator of constant list
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new random access iterator that
+ *   only gives read access to the list items.
+ */
+template<class T, int InlineN, class BoundsCheck>
+typename AList<T, InlineN, BoundsCheck>::const_iterator AList<T, InlineN, BoundsCheck>::begin() const
+{
+  return const_iterator(values);
+}
+
+/** @brief End iterator of constant list
+ *
+ * Return a const iterator pointing just past the last value of this
+ * list, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new random access iterator that
+ *   points to the end of the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+typename AList<T, InlineN, BoundsCheck>::const_iterator AList<T, InlineN, BoundsCheck>::end() const
+{
+  return const_iterator(values + this->size);
+}
+
+/** @brief Constant begin iterator
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns const_iterator returns a new random access iterator that
+ *   only gives read access to the list items.
+ */
+template<class T, int InlineN, class BoundsCheck>
+typename AList<T, InlineN, BoundsCheck>::const_iterator AList<T, InlineN, BoundsCheck>::cbegin() const
+{
+  return const_iterator(values);
+}
+
+/**@brief Constant end iterator
+ *
+ * Return a const iterator pointing just past the last value
+ * of this list, which is used to detect we are
+ * at the end of the list when iteration.
+ *
+ * @returns const_iterator returns a new random access iterator that
+ *   points to the end of the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+typename AList<T, InlineN, BoundsCheck>::const_iterator AList<T, InlineN, BoundsCheck>::cend() const
+{
+  return const_iterator(values + this->size);
+}
+
+/** @brief Grow list allocation
+ *
+ * Private member method that will increase the memory allocation if
+ * the list is currently at capacity.  The growth policy of the list
+ * decides the new allocation size, by default doubling the current
+ * allocation, and the values are relocated to a new block of that
+ * size.  This method is called by methods that need to grow the list,
+ * to ensure we have enough allocated capacity to accommodate the growth.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::growListIfNeeded()
+{
+  // if size is still less than what we have allocated, we still have room
+  // to grow at least one or more items in sizes
+  if (this->size < allocationSize)
+  {
+    return;
+  }
+
+  // otherwise size is equal to our allocation, ask the policy how large
+  // the allocation should become to fit at least 1 more value
+  reallocate(growthPolicy.grow(allocationSize, this->size + 1));
+}
+
+/** @brief Shrink list allocation
+ *
+ * Private member method called after values are removed from the list.
+ * If the growth policy has auto shrinking enabled and the list has
+ * become sparse enough, the values are relocated to a smaller block so
+ * that memory use stays proportional to the number of values.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::shrinkListIfNeeded()
+{
+  int newAllocationSize = growthPolicy.shrink(allocationSize, this->size);
+  if (newAllocationSize < allocationSize)
+  {
+    reallocate(newAllocationSize);
+  }
+}
+
+/** @brief Relocate to new allocation
+ *
+ * Private member method to relocate all of the values from the current
+ * block of memory to a new block of the given size, then deallocate
+ * the old block that is no longer needed.
+ *
+ * The new block is raw uninitialized memory, only the live values are
+ * move constructed into it (or copy constructed if moving T might
+ * throw), so relocating never default constructs the unused slots.
+ * If relocating a value throws, the list is left unchanged.
+ *
+ * The allocation never drops below the size of the inline buffer.  A
+ * list that shrinks back down to that size relocates its values into
+ * the inline buffer rather than a new block on the heap.
+ *
+ * @param newAllocationSize The size of the new block, must be at least
+ *   the current size of the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::reallocate(int newAllocationSize)
+{
+  // the inline buffer is always available, so never go below its size
+  if (newAllocationSize < InlineN)
+  {
+    newAllocationSize = InlineN;
+  }
+  if (newAllocationSize == allocationSize)
+  {
+    return;
+  }
+
+  // a list mapped from a writable file grows and shrinks the file and
+  // its mapping in place, the kernel moves the pages if it needs to
+  if (mappedFile != nullptr and not mappedFile->isReadOnly())
+  {
+    mappedFile->resize("AList::reallocate", sizeof(ListBinaryHeader) + static_cast<uint64_t>(newAllocationSize) * sizeof(T));
+    values = mappedValues();
+    allocationSize = newAllocationSize;
+    return;
+  }
+
+  // dynamically allocate a new block of raw memory of the new size, or
+  // use the inline buffer which is free whenever we are on the heap
+  T* newValues = newAllocationSize == InlineN ? inlineBuffer.data() : allocateValues(newAllocationSize);
+
+  // relocate the values from the original memory to this new block of
+  // memory, a trivially copyable value can simply have its bytes copied
+  if constexpr (is_trivially_copyable<T>::value)
+  {
+    if (this->size > 0)
+    {
+      memcpy(newValues, values, sizeof(T) * this->size);
+    }
+  }
+  else
+  {
+    int index = 0;
+    try
+    {
+      for (; index < this->size; index++)
+      {
+        new (newValues + index) T(move_if_noexcept(values[index]));
+      }
+    }
+    catch (...)
+    {
+      // undo the partial relocation, the original values are still intact
+      destroy(newValues, newValues + index);
+      deallocateValues(newValues, newAllocationSize);
+      throw;
+    }
+
+    // we don't need the old values anymore
+    destroy(values, values + this->size);
+  }
+
+  // be good managers of memory and return the old block to the heap
+  deallocateValues(values, allocationSize);
+
+  // now make sure we are using the new block of memory going forward for this
+  // list
+  values = newValues;
+  allocationSize = newAllocationSize;
+}
+
+/** @brief Shift values up
+ *
+ * Private member method to shift the live values from the given index
+ * to the back up by 1 index, making room at that index.  The allocation
+ * must have room for 1 more value past the back.  The slot at the index
+ * is left holding a moved from value that the caller is expected to
+ * assign to, and the caller is responsible for updating the size.
+ *
+ * Trivially copyable values are shifted with a single memmove of the
+ * block, other values are moved one by one.
+ *
+ * @param index The index to make room at, must be a valid index of
+ *   this list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::shiftValuesUp(int index)
+{
+  if constexpr (is_trivially_copyable<T>::value)
+  {
+    memmove(values + index + 1, values + index, sizeof(T) * (this->size - index));
+  }
+  else
+  {
+    // the slot past the back is uninitialized so the back value is
+    // move constructed into it, the remaining values are move assigned
+    new (values + this->size) T(move(values[this->size - 1]));
+    for (int slot = this->size - 1; slot > index; slot--)
+    {
+      values[slot] = move(values[slot - 1]);
+    }
+  }
+}
+
+/** @brief Shift values down
+ *
+ * Private member method to remove the value at the given index by
+ * shifting all of the values after it down by 1 index.  The slot at
+ * the back is no longer live afterwards and is destroyed, and the
+ * size of the list is reduced by 1.
+ *
+ * Trivially copyable values are shifted with a single memmove of the
+ * block, other values are moved one by one.
+ *
+ * @param index The index of the value to remove, must be a valid
+ *   index of this list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::shiftValuesDown(int index)
+{
+  if constexpr (is_trivially_copyable<T>::value)
+  {
+    memmove(values + index, values + index + 1, sizeof(T) * (this->size - index - 1));
+  }
+  else
+  {
+    for (; index < this->size - 1; index++)
+    {
+      values[index] = move(values[index + 1]);
+    }
+  }
+
+  // size of list was reduced by 1 by removal, the last slot
+  // was moved from and is no longer live
+  this->size--;
+  values[this->size].~T();
+}
+
+/** @brief Copy values onto back
+ *
+ * Private member method to copy construct the given values into the
+ * uninitialized slots at the end of this list.  The allocation must
+ * already be large enough to hold them.  If a copy throws, the values
+ * copied so far are destroyed and our block of memory is given back,
+ * so constructors can use this safely.
+ *
+ * @param source The array of values to copy from.
+ * @param count The number of values to copy.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::copyValues(const T* source, int count)
+{
+  // a trivially copyable value can simply have its bytes copied
+  if constexpr (is_trivially_copyable<T>::value)
+  {
+    if (count > 0)
+    {
+      memcpy(values + this->size, source, sizeof(T) * count);
+    }
+    this->size += count;
+    return;
+  }
+
+  try
+  {
+    uninitialized_copy_n(source, count, values + this->size);
+  }
+  catch (...)
+  {
+    // uninitialized_copy_n already destroyed any partial copies
+    clear();
+    throw;
+  }
+  this->size += count;
+}
+
+/** @brief Take over values of list
+ *
+ * Private member method to take over all of the values of the given
+ * list, which is left as an empty list using only its inline buffer.
+ * This list must be empty and using only its inline buffer beforehand.
+ * A block of memory on the heap is simply taken over, but values in
+ * the inline buffer of the other list have to be moved into our own
+ * inline buffer.
+ *
+ * @param list The other List whose values we are to take over.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::takeValues(AList<T, InlineN, BoundsCheck>& list)
+{
+  if (list.usingInlineBuffer())
+  {
+    // the values fit in our inline buffer, so relocate them there
+    if constexpr (is_trivially_copyable<T>::value)
+    {
+      if (list.size > 0)
+      {
+        memcpy(values, list.values, sizeof(T) * list.size);
+      }
+    }
+    else
+    {
+      for (int index = 0; index < list.size; index++)
+      {
+        new (values + index) T(move(list.values[index]));
+      }
+      destroy(list.values, list.values + list.size);
+    }
+    this->size = list.size;
+  }
+  else
+  {
+    // take over the values and allocation of the other list, along
+    // with the file they are mapped from
+    this->size = list.size;
+    allocationSize = list.allocationSize;
+    values = list.values;
+    mappedFile = move(list.mappedFile);
+
+    // the other list no longer owns the memory
+    list.allocationSize = InlineN;
+    list.values = list.inlineBuffer.data();
+  }
+
+  // the other list is now empty
+  list.size = 0;
+}
+
+/** @brief Using inline buffer
+ *
+ * Private helper to test if the values of this list currently live
+ * in the inline buffer of the list, rather than in a block of memory
+ * on the heap.
+ *
+ * @returns bool Returns true if the values are in the inline buffer.
+ */
+template<class T, int InlineN, class BoundsCheck>
+bool AList<T, InlineN, BoundsCheck>::usingInlineBuffer() const
+{
+  return InlineN > 0 and values == inlineBuffer.data();
+}
+
+/** @brief Allocate raw storage
+ *
+ * Private helper to allocate an uninitialized block of memory large
+ * enough to hold the requested number of values.  No values are
+ * constructed in the block.
+ *
+ * @param allocationSize The number of values the block should hold.
+ *
+ * @returns T* Returns a pointer to the new block, or nullptr when
+ *   an empty allocation is requested.
+ */
+template<class T, int InlineN, class BoundsCheck>
+T* AList<T, InlineN, BoundsCheck>::allocateValues(int allocationSize)
+{
+  if (allocationSize == 0)
+  {
+    return nullptr;
+  }
+
+  return allocator<T>().allocate(allocationSize);
+}
+
+/** @brief Deallocate raw storage
+ *
+ * Private helper to give a block of memory obtained from
+ * allocateValues() back to the heap.  Any values that were constructed
+ * in the block must already have been destroyed.  An empty block or
+ * the inline buffer of this list are not on the heap, so there is
+ * nothing to give back for them, and the values of a mapped file are
+ * given back by unmapping it.
+ *
+ * @param values The block of memory to deallocate.
+ * @param allocationSize The number of values the block was allocated for.
+ */
+template<class T, int InlineN, class BoundsCheck>
+void AList<T, InlineN, BoundsCheck>::deallocateValues(T* values, int allocationSize)
+{
+  if (values == nullptr or values == inlineBuffer.data())
+  {
+    return;
+  }
+
+  // the values of a read only mapped file are given back by unmapping
+  // the file, which is never changed
+  if (mappedFile != nullptr and values == mappedValues())
+  {
+    mappedFile.reset();
+    return;
+  }
+
+  allocator<T>().deallocate(values, allocationSize);
+}
+
+/** @brief Mapped values
+ *
+ * Private helper to find the values in the mapped file, right after the
+ * header of the file.
+ *
+ * @returns T* Returns a pointer to the block of values in the file.
+ */
+template<class T, int InlineN, class BoundsCheck>
+T* AList<T, InlineN, BoundsCheck>::mappedValues() const
+{
+  return reinterpret_cast<T*>(mappedFile->getData() + sizeof(ListBinaryHeader));
+}
+
+/** @brief Close mapped file
+ *
+ * Private helper to stop keeping the values of this list in its mapped
+ * file, if it has one.  The size of the list is recorded in a writable
+ * file, and the unused room at its end is cut off.  The list is left
+ * empty, using only its inline buffer.  This never throws, so it can be
+ * used by the destructor and move assignment.
+ *
+ * @returns bool Returns true if the file was closed, false if a
+ *   writable file could not be cut down to the size of the list.
+ */
+template<class T, int InlineN, class BoundsCheck>
+bool AList<T, InlineN, BoundsCheck>::closeMappedFile()
+{
+  if (mappedFile == nullptr)
+  {
+    return true;
+  }
+
+  unique_ptr<MappedFile> file = move(mappedFile);
+  bool closed = true;
+  if (not file->isReadOnly())
+  {
+    uint64_t dataSize = static_cast<uint64_t>(this->size) * sizeof(T);
+    *reinterpret_cast<ListBinaryHeader*>(file->getData()) = makeListBinaryHeader<T>(this->size, dataSize);
+    closed = file->close(sizeof(ListBinaryHeader) + dataSize);
+  }
+
+  // the values stay behind in the file
+  this->size = 0;
+  allocationSize = InlineN;
+  values = inlineBuffer.data();
+
+  return closed;
+}
@@ -8,42 +8,362 @@
  * @date   June 1, 2021
  *
  * Definition of concrete AListIterator to iterate over
- * AList<T> instances.
+ * AList<T> instances.  The values of an AList are contiguous in
+ * memory, so the iterator is a random access iterator that is nothing
+ * more than a pointer to the current value.  All of the members are
+ * defined here in the header, so that the compiler can inline them and
+ * iterating over an AList is as fast as walking a plain array.
  */
 #ifndef _ALIST_ITERATOR_HPP_
 #define _ALIST_ITERATOR_HPP_
-#include "ListIterator.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 using namespace std;
 
 /** @class AListIterator
- * @brief The ListIterator interface
+ * @brief The random access iterator for array based lists
  *
- * The defined ADT interface for a ListIterator objects.
- * These allow us to iterate over List<T> objects in the
- * standard and expected way for C++ template classes.
+ * Iterate over the values of an AList<T>.  An AListIterator<T> gives
+ * access to modify the values, an AListIterator<const T> is the
+ * const_iterator of the list and only gives read access.  These are
+ * standard iterators, so they work with range based iteration as well
+ * as with the <algorithm> library.
  */
 template<class T>
-class AListIterator : public ListIterator<T>
+class AListIterator
 {
 public:
+  // standard iterator traits
+  using iterator_category = random_access_iterator_tag;
+  using value_type = remove_const_t<T>;
+  using difference_type = ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
   // constructors
   AListIterator();
-  AListIterator(int index, T* values);
+  explicit AListIterator(T* current);
+  template<class U, class = enable_if_t<is_same<const U, T>::value>>
+  AListIterator(const AListIterator<U>& other);
+
+  // accessing the current value
+  reference operator*() const;
+  pointer operator->() const;
+  reference operator[](difference_type offset) const;
+
+  // moving the iterator
+  AListIterator<T>& operator++();
+  AListIterator<T> operator++(int);
+  AListIterator<T>& operator--();
+  AListIterator<T> operator--(int);
+  AListIterator<T>& operator+=(difference_type offset);
+  AListIterator<T>& operator-=(difference_type offset);
+  AListIterator<T> operator+(difference_type offset) const;
+  AListIterator<T> operator-(difference_type offset) const;
 
-  // overloaded operators
-  T operator*();
-  ListIterator<T>& operator++();
-  bool operator==(const AListIterator<T>& rhs) const;
-  bool operator!=(const AListIterator<T>& rhs) const;
+  // comparing iterators, mutable and const iterators can be mixed
+  template<class U>
+  difference_type operator-(const AListIterator<U>& rhs) const;
+  template<class U>
+  bool operator==(const AListIterator<U>& rhs) const;
+  template<class U>
+  bool operator!=(const AListIterator<U>& rhs) const;
+  template<class U>
+  bool operator<(const AListIterator<U>& rhs) const;
+  template<class U>
+  bool operator>(const AListIterator<U>& rhs) const;
+  template<class U>
+  bool operator<=(const AListIterator<U>& rhs) const;
+  template<class U>
+  bool operator>=(const AListIterator<U>& rhs) const;
 
 private:
-  /// The AList<T> class copies the current pointer
-  ///   to the list values when this iterator is
-  ///   created
-  T* values;
-  /// Current index to the point we currently are at
-  ///   in iterating through this AList
-  int current;
+  /// @brief pointer to the current value of the iteration, in the
+  ///   block of values of the AList
+  T* current;
+
+  // the const iterator is built from and compared to the mutable one
+  template<class U>
+  friend class AListIterator;
 };
 
+/** @brief Default constructor
+ *
+ * Default constructor, iterator will not be iterating over
+ * anything if constructed using the default constructor.
+ */
+template<class T>
+inline AListIterator<T>::AListIterator()
+  : current(nullptr)
+{
+}
+
+/** @brief Standard constructor
+ *
+ * Standard constructor, we are given a pointer to the value in the
+ * block of values of the AList we are to begin iteration with.
+ *
+ * @param current Pointer to the current value of the iteration.
+ */
+template<class T>
+inline AListIterator<T>::AListIterator(T* current)
+  : current(current)
+{
+}
+
+/** @brief Converting constructor
+ *
+ * A mutable iterator can be turned into a const iterator to the same
+ * value, but not the other way around.
+ *
+ * @param other The mutable iterator to convert.
+ */
+template<class T>
+template<class U, class>
+inline AListIterator<T>::AListIterator(const AListIterator<U>& other)
+  : current(other.current)
+{
+}
+
+/** @brief Overload dereference operator
+ *
+ * @returns reference Returns a reference to the current value, so
+ *   that values are neither copied nor are they copies when modified.
+ */
+template<class T>
+inline typename AListIterator<T>::reference AListIterator<T>::operator*() const
+{
+  return *current;
+}
+
+/** @brief Overload member access operator
+ *
+ * @returns pointer Returns a pointer to the current value.
+ */
+template<class T>
+inline typename AListIterator<T>::pointer AListIterator<T>::operator->() const
+{
+  return current;
+}
+
+/** @brief Overload indexing operator
+ *
+ * @param offset The offset from the current value of the value to
+ *   access.
+ *
+ * @returns reference Returns a reference to the value at the offset.
+ */
+template<class T>
+inline typename AListIterator<T>::reference AListIterator<T>::operator[](difference_type offset) const
+{
+  return current[offset];
+}
+
+/** @brief Overload pre increment operator
+ *
+ * @returns AListIterator<T>& Returns ourself, moved to the next value.
+ */
+template<class T>
+inline AListIterator<T>& AListIterator<T>::operator++()
+{
+  ++current;
+  return *this;
+}
+
+/** @brief Overload post increment operator
+ *
+ * @returns AListIterator<T> Returns a copy of ourself from before we
+ *   were moved to the next value.
+ */
+template<class T>
+inline AListIterator<T> AListIterator<T>::operator++(int)
+{
+  AListIterator<T> before(*this);
+  ++current;
+  return before;
+}
+
+/** @brief Overload pre decrement operator
+ *
+ * @returns AListIterator<T>& Returns ourself, moved to the previous value.
+ */
+template<class T>
+inline AListIterator<T>& AListIterator<T>::operator--()
+{
+  --current;
+  return *this;
+}
+
+/** @brief Overload post decrement operator
+ *
+ * @returns AListIterator<T> Returns a copy of ourself from before we
+ *   were moved to the previous value.
+ */
+template<class T>
+inline AListIterator<T> AListIterator<T>::operator--(int)
+{
+  AListIterator<T> before(*this);
+  --current;
+  return before;
+}
+
+/** @brief Overload compound addition operator
+ *
+ * @param offset The number of values to move forward.
+ *
+ * @returns AListIterator<T>& Returns ourself after moving.
+ */
+template<class T>
+inline AListIterator<T>& AListIterator<T>::operator+=(difference_type offset)
+{
+  current += offset;
+  return *this;
+}
+
+/** @brief Overload compound subtraction operator
+ *
+ * @param offset The number of values to move back.
+ *
+ * @returns AListIterator<T>& Returns ourself after moving.
+ */
+template<class T>
+inline AListIterator<T>& AListIterator<T>::operator-=(difference_type offset)
+{
+  current -= offset;
+  return *this;
+}
+
+/** @brief Overload addition operator
+ *
+ * @param offset The number of values to move forward.
+ *
+ * @returns AListIterator<T> Returns a new iterator offset values after
+ *   this one.
+ */
+template<class T>
+inline AListIterator<T> AListIterator<T>::operator+(difference_type offset) const
+{
+  return AListIterator<T>(current + offset);
+}
+
+/** @brief Overload subtraction operator
+ *
+ * @param offset The number of values to move back.
+ *
+ * @returns AListIterator<T> Returns a new iterator offset values before
+ *   this one.
+ */
+template<class T>
+inline AListIterator<T> AListIterator<T>::operator-(difference_type offset) const
+{
+  return AListIterator<T>(current - offset);
+}
+
+/** @brief Overload iterator difference operator
+ *
+ * @param rhs The other iterator over the same list.
+ *
+ * @returns difference_type Returns the number of values from the rhs
+ *   iterator to this iterator.
+ */
+template<class T>
+template<class U>
+inline typename AListIterator<T>::difference_type AListIterator<T>::operator-(const AListIterator<U>& rhs) const
+{
+  return current - rhs.current;
+}
+
+/** @brief Overload boolean equality operator
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if both iterators point to the same value.
+ */
+template<class T>
+template<class U>
+inline bool AListIterator<T>::operator==(const AListIterator<U>& rhs) const
+{
+  return current == rhs.current;
+}
+
+/** @brief Overload boolean not equal operator
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators point to different values.
+ */
+template<class T>
+template<class U>
+inline bool AListIterator<T>::operator!=(const AListIterator<U>& rhs) const
+{
+  return current != rhs.current;
+}
+
+/** @brief Overload boolean less than operator
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if this iterator points to an earlier value.
+ */
+template<class T>
+template<class U>
+inline bool AListIterator<T>::operator<(const AListIterator<U>& rhs) const
+{
+  return current < rhs.current;
+}
+
+/** @brief Overload boolean greater than operator
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if this iterator points to a later value.
+ */
+template<class T>
+template<class U>
+inline bool AListIterator<T>::operator>(const AListIterator<U>& rhs) const
+{
+  return current > rhs.current;
+}
+
+/** @brief Overload boolean less than or equal operator
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if this iterator does not point to a later value.
+ */
+template<class T>
+template<class U>
+inline bool AListIterator<T>::operator<=(const AListIterator<U>& rhs) const
+{
+  return current <= rhs.current;
+}
+
+/** @brief Overload boolean greater than or equal operator
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if this iterator does not point to an earlier value.
+ */
+template<class T>
+template<class U>
+inline bool AListIterator<T>::operator>=(const AListIterator<U>& rhs) const
+{
+  return current >= rhs.current;
+}
+
+/** @brief Overload addition operator with the offset first
+ *
+ * @param offset The number of values to move forward.
+ * @param itr The iterator to move forward from.
+ *
+ * @returns AListIterator<T> Returns a new iterator offset values after
+ *   the given one.
+ */
+template<class T>
+inline AListIterator<T> operator+(typename AListIterator<T>::difference_type offset, const AListIterator<T>& itr)
+{
+  return itr + offset;
+}
+
 #endif // define _ALIST_ITERATOR_HPP_
@@ -0,0 +1,40 @@
+/** @file BoundsCheck.hpp
+ * @brief Bounds checking policies for array based List implementations.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Declare the compile time policies that decide whether an array based
+ * list checks the indexes it is given, and that it is not empty, before
+ * accessing or removing values.  The checks of a list with the
+ * UncheckedBounds policy are removed by the compiler entirely.
+ */
+#ifndef _BOUNDS_CHECK_HPP_
+#define _BOUNDS_CHECK_HPP_
+using namespace std;
+
+/** @class CheckedBounds
+ * @brief Check every access, throwing a ListMemoryBoundsException or
+ *   ListEmptyException for an illegal one.  This is the default policy.
+ */
+struct CheckedBounds
+{
+  /// @brief accesses are checked
+  static constexpr bool enabled = true;
+};
+
+/** @class UncheckedBounds
+ * @brief Trust the caller to only make legal accesses.  An illegal
+ *   access with this policy is undefined behavior, so it should only be
+ *   used for code that is already known to stay within the list.
+ */
+struct UncheckedBounds
+{
+  /// @brief accesses are not checked
+  static constexpr bool enabled = false;
+};
+
+#endif // define _BOUNDS_CHECK_HPP_
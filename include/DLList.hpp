@@ -0,0 +1,213 @@
+/** @file DLList.hpp
+ * @brief Concrete doubly linked list implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using a doubly linked list.  Every
+ * node links to the node before it as well as the node after it.
+ * This costs an extra pointer per value compared to the singly linked
+ * LList, but means that insertion and removal at both the front and
+ * the back of the list are O(1), the list can be iterated over in
+ * reverse, and finding a value by index only has to walk from
+ * whichever end of the list is closer.
+ */
+#ifndef _DLLIST_HPP_
+#define _DLLIST_HPP_
+#include "DLListIterator.hpp"
+#include "DNode.hpp"
+#include "List.hpp"
+#include "NodePool.hpp"
+#include <new>
+#include <string>
+#include <utility>
+using namespace std;
+
+/** @class DLList
+ * @brief The DLList concrete doubly linked list implemention of the
+ *   List interface.
+ *
+ * Concrete implementation of List abstraction using a doubly linked
+ * list of nodes.  The memory for the nodes of the list comes from a
+ * NodePool owned by the list.
+ */
+template<class T>
+class DLList : public List<T>
+{
+public:
+  // constructors and destructors
+  DLList();                               // default constructor
+  DLList(int size, T values[]);           // array based constructor
+  DLList(const DLList<T>& otherList);     // copy constructor
+  DLList(DLList<T>&& otherList) noexcept; // move constructor
+  ~DLList();                              // destructor
+
+  // assignment operators
+  DLList<T>& operator=(const DLList<T>& rhs);
+  DLList<T>& operator=(DLList<T>&& rhs) noexcept;
+
+  // accessor and information methods
+  T getFront() const;
+  T getBack() const;
+  bool operator==(const List<T>& rhs) const;
+  T& operator[](int index) const;
+
+  // adding, accessing and removing values from the list
+  void clear();
+  List<T>& insertBack(const T& value);
+  List<T>& insertBack(T&& value);
+  List<T>& operator>>(const T& value);
+  void deleteBack();
+  List<T>& insertFront(const T& value);
+  List<T>& insertFront(T&& value);
+  List<T>& operator<<(const T& value);
+  void deleteFront();
+  void deleteValue(const T& value);
+  void deleteIndex(int index);
+  List<T>& insertAt(int index, const T& value);
+  List<T>& insertAt(int index, T&& value);
+
+  // constructing new values directly in new list nodes
+  template<class... Args>
+  T& emplaceBack(Args&&... args);
+  template<class... Args>
+  T& emplaceFront(Args&&... args);
+
+  // iterating over list the C++ way, using forward iterator objects
+  // and supporting range based iteration and <algorithm>
+  using value_type = T;
+  using iterator = DLListIterator<T>;
+  using const_iterator = DLListIterator<const T>;
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  // iterating over the list from the back to the front
+  DLListIterator<T> rbegin();
+  DLListIterator<T> rend();
+
+protected:
+  // comparing values of lists, walking through our own values
+  bool hasFastIndexing() const;
+  bool equalValues(const List<T>& rhs) const;
+  int compareValues(const List<T>& rhs) const;
+
+  // writing values out to a stream, walking through our own values
+  void writeValues(ListWriter<T>& writer, int first, int count) const;
+
+private:
+  /// @brief pointer to the front or first node of the linked list.
+  DNode<T>* front;
+
+  /// @brief pointer to the back or last node of the linked list.
+  DNode<T>* back;
+
+  /// @brief the pool that the memory for the nodes of this list
+  ///   comes from
+  NodePool<DNode<T>> nodePool;
+
+  // private member methods for managing the nodes of the list
+  DNode<T>* nodeAt(int index) const;
+  template<class... Args>
+  T& emplaceBefore(DNode<T>* next, Args&&... args);
+  void unlinkNode(DNode<T>* node);
+};
+
+/** @brief Emplace value before node
+ *
+ * Private helper to construct a new value in a new node, and link the
+ * node into the list right before the given node.  All of the ways of
+ * inserting into the list come down to this.  The arguments are
+ * perfectly forwarded to the constructor of T.
+ *
+ * @param next The node the new node is inserted before, or nullptr
+ *   to insert the new node at the back of the list.
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns T& Returns a reference to the newly constructed value.
+ */
+template<class T>
+template<class... Args>
+T& DLList<T>::emplaceBefore(DNode<T>* next, Args&&... args)
+{
+  DNode<T>* prev = (next == nullptr) ? back : next->prev;
+
+  // construct the new node, giving its memory back if the value throws
+  DNode<T>* node = nodePool.allocate();
+  try
+  {
+    new (node) DNode<T>(prev, next, forward<Args>(args)...);
+  }
+  catch (...)
+  {
+    nodePool.deallocate(node);
+    throw;
+  }
+
+  // link the neighbors to the new node, it becomes the front or the
+  // back if there is no neighbor on that side
+  if (prev == nullptr)
+  {
+    front = node;
+  }
+  else
+  {
+    prev->next = node;
+  }
+  if (next == nullptr)
+  {
+    back = node;
+  }
+  else
+  {
+    next->prev = node;
+  }
+  this->size++;
+
+  return node->value;
+}
+
+/** @brief Emplace value on back
+ *
+ * Construct a new value in a new node linked onto the end of this
+ * list.  This is a constant time O(1) operation.
+ *
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns T& Returns a reference to the newly constructed value now
+ *   at the back of this list.
+ */
+template<class T>
+template<class... Args>
+T& DLList<T>::emplaceBack(Args&&... args)
+{
+  return emplaceBefore(nullptr, forward<Args>(args)...);
+}
+
+/** @brief Emplace value on front
+ *
+ * Construct a new value in a new node linked onto the beginning of
+ * this list.  This is a constant time O(1) operation.
+ *
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns T& Returns a reference to the newly constructed value now
+ *   at the front of this list.
+ */
+template<class T>
+template<class... Args>
+T& DLList<T>::emplaceFront(Args&&... args)
+{
+  return emplaceBefore(front, forward<Args>(args)...);
+}
+
+// template member definitions
+#include "DLList.ipp"
+
+#endif // define _DLLIST_HPP_
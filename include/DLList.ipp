@@ -0,0 +1,882 @@
+/** @file DLList.ipp
+ * @brief Concrete doubly linked list implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using a doubly linked list.  Since
+ * every node knows the node before it, a node can be unlinked without
+ * searching for its predecessor, so deleting the back of the list is
+ * O(1) just like deleting the front.  Finding the node at an index
+ * walks forward from the front or backward from the back, whichever
+ * is closer, so it never takes more than n/2 steps.
+ *
+ * This file is included at the end of DLList.hpp and is not compiled
+ * on its own.
+ */
+#include "DLListIterator.hpp"
+#include "ListException.hpp"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/**
+ * @brief Default constructor
+ *
+ * Construct an empty list.  The empty list will have no allocated memory
+ * nor any values.
+ */
+template<class T>
+DLList<T>::DLList()
+{
+  // Empty list has size 0 and both front and back are null
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+}
+
+/**
+ * @brief Standard constructor
+ *
+ * Construct a list of values from a (statically) defined and
+ * provided array of values.  We need to dynamically construct
+ * a node for each value in the array and create a linked list of these
+ * nodes.
+ *
+ * @param size The size of the input values were are given as well as the
+ *   size of the new list we are to construct.
+ * @param values The (static) array of values to use to construct
+ *   this List values with.
+ */
+template<class T>
+DLList<T>::DLList(int size, T values[])
+{
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+
+  // insert the values one-by-one on the back
+  for (int index = 0; index < size; index++)
+  {
+    emplaceBack(values[index]);
+  }
+}
+
+/**
+ * @brief Copy constructor
+ *
+ * Provide a copy constructor for the List class.  The copy gets new
+ * nodes of its own, from its own node pool, holding copies of the
+ * values of the given list.
+ *
+ * @param list The other List type we are to make a copy of in this
+ *   constructor.
+ */
+template<class T>
+DLList<T>::DLList(const DLList<T>& list)
+{
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+
+  // insert a copy of each value of the other list on our back
+  for (DNode<T>* current = list.front; current != nullptr; current = current->next)
+  {
+    emplaceBack(current->value);
+  }
+}
+
+/**
+ * @brief Move constructor
+ *
+ * Construct this list by taking over the nodes of the given list,
+ * which is left as an empty list.  No nodes are allocated or
+ * values copied.  The node pool is moved along with the nodes,
+ * since the nodes live in the memory it manages.
+ *
+ * @param list The other List whose nodes we are to take over.
+ */
+template<class T>
+DLList<T>::DLList(DLList<T>&& list) noexcept
+  : nodePool(move(list.nodePool))
+{
+  // take over the nodes of the other list
+  this->size = list.size;
+  front = list.front;
+  back = list.back;
+
+  // the other list is now empty and no longer owns the nodes
+  list.size = 0;
+  list.front = nullptr;
+  list.back = nullptr;
+}
+
+/**
+ * @brief Class destructor
+ *
+ * Destructor for the List class.  Invoke the clear of the list to
+ * destroy the nodes and give back their memory.
+ */
+template<class T>
+DLList<T>::~DLList()
+{
+  this->clear();
+}
+
+/**
+ * @brief Copy assignment operator
+ *
+ * Replace the values of this list with a copy of the values of
+ * the right hand side list.  The copy is made first, so that
+ * this list is left unchanged if the copy fails.
+ *
+ * @param rhs The other List we are to make a copy of.
+ *
+ * @returns DLList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+DLList<T>& DLList<T>::operator=(const DLList<T>& rhs)
+{
+  if (this != &rhs)
+  {
+    // copy into a temporary then move the copy into this list
+    DLList<T> copy(rhs);
+    *this = move(copy);
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Move assignment operator
+ *
+ * Release the nodes of this list and take over the nodes of the
+ * right hand side list, which is left as an empty list.
+ *
+ * @param rhs The other List whose nodes we are to take over.
+ *
+ * @returns DLList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+DLList<T>& DLList<T>::operator=(DLList<T>&& rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    // give back our own nodes before taking over the other list
+    clear();
+
+    this->size = rhs.size;
+    front = rhs.front;
+    back = rhs.back;
+    nodePool = move(rhs.nodePool);
+
+    rhs.size = 0;
+    rhs.front = nullptr;
+    rhs.back = nullptr;
+  }
+
+  return *this;
+}
+
+/** @brief Access front of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the front of this list.
+ *
+ * @returns T Returns a copy of the front item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access front item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T DLList<T>::getFront() const
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("DLList::getFront", this->size);
+  }
+
+  return front->value;
+}
+
+/** @brief Access back of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the back of this list.
+ *
+ * @returns T Returns a copy of the back item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access back item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T DLList<T>::getBack() const
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("DLList::getBack", this->size);
+  }
+
+  return back->value;
+}
+
+/** @brief Write values to stream
+ *
+ * Write the given range of values to the output stream, separated by a
+ * comma and a space, walking the nodes from the first value rather
+ * than going through operator[] for each value.
+ *
+ * @param writer The stream or string to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write, at least 1.
+ */
+template<class T>
+void DLList<T>::writeValues(ListWriter<T>& writer, int first, int count) const
+{
+  // find the first node once, then walk on from it
+  DNode<T>* current = nodeAt(first);
+  writer.writeValue(current->value);
+  for (int written = 1; written < count; written++)
+  {
+    current = current->next;
+    writer.writeText(", ");
+    writer.writeValue(current->value);
+  }
+}
+
+/**
+ * @brief Boolean equals operator
+ *
+ * Check if this List is equal to the right hand side (rhs)
+ * list.  The lists are equal if their sizes are equal, and if
+ * all elements in both lists are equal.
+ * The comparison is done by List<T>::equals(), using whichever
+ * list is able to walk through its values fastest.
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this List to.
+ *
+ * @returns bool true if the lists are equal, false if the are not.
+ */
+template<class T>
+bool DLList<T>::operator==(const List<T>& rhs) const
+{
+  // the list that can walk through its own values does the comparing
+  return this->equals(rhs);
+}
+
+/** @brief Fast indexing test
+ *
+ * Finding a node by index has to walk the links of the list, so the
+ * doubly linked list does not have fast indexing.  Comparisons with
+ * other lists are done by walking our nodes instead.
+ *
+ * @returns bool Returns false, indexing this list is not O(1).
+ */
+template<class T>
+bool DLList<T>::hasFastIndexing() const
+{
+  return false;
+}
+
+/** @brief Check values for equality
+ *
+ * Check that the values of this list are equal to the values of the
+ * rhs list, which has the same size as this list.  We walk our nodes
+ * while stepping through the rhs list in lockstep.  If the rhs list is
+ * the same kind of doubly linked list its nodes are walked as well, otherwise
+ * it is indexed in order.
+ *
+ * @param rhs The other list of the same size to compare values with.
+ *
+ * @returns bool true if all values of the lists are equal.
+ */
+template<class T>
+bool DLList<T>::equalValues(const List<T>& rhs) const
+{
+  const DLList<T>* other = dynamic_cast<const DLList<T>*>(&rhs);
+  DNode<T>* otherCurrent = (other == nullptr) ? nullptr : other->front;
+
+  int index = 0;
+  for (DNode<T>* current = front; current != nullptr; current = current->next)
+  {
+    const T& rhsValue = (other == nullptr) ? rhs[index] : otherCurrent->value;
+    if (not(current->value == rhsValue))
+    {
+      return false;
+    }
+
+    index++;
+    if (other != nullptr)
+    {
+      otherCurrent = otherCurrent->next;
+    }
+  }
+
+  return true;
+}
+
+/** @brief Compare values
+ *
+ * Compare the values of this list with the rhs list in lexicographic
+ * order.  Like equalValues(), we walk our nodes and the rhs list in
+ * lockstep.
+ *
+ * @param rhs The other list on the right hand side of the comparison.
+ *
+ * @returns int Returns a negative value, 0 or a positive value if this
+ *   list orders before, the same as or after the rhs list.
+ */
+template<class T>
+int DLList<T>::compareValues(const List<T>& rhs) const
+{
+  const DLList<T>* other = dynamic_cast<const DLList<T>*>(&rhs);
+  DNode<T>* otherCurrent = (other == nullptr) ? nullptr : other->front;
+
+  int index = 0;
+  for (DNode<T>* current = front; current != nullptr and index < rhs.getSize(); current = current->next)
+  {
+    const T& rhsValue = (other == nullptr) ? rhs[index] : otherCurrent->value;
+    if (current->value < rhsValue)
+    {
+      return -1;
+    }
+    if (rhsValue < current->value)
+    {
+      return 1;
+    }
+
+    index++;
+    if (other != nullptr)
+    {
+      otherCurrent = otherCurrent->next;
+    }
+  }
+
+  // all values compared are equal, so the shorter list comes first
+  return this->size - rhs.getSize();
+}
+
+/**
+ * @brief Indexing operator
+ *
+ * Provide a way to index individual values in our private
+ * linked list of values.  The node is found by walking from
+ * whichever end of the list is closer to the index.
+ *
+ * @param index The index of the value it is desired to access from
+ *   this List.
+ *
+ * @returns T& Returns a reference to the requested List item at
+ *   the requested index.
+ *
+ * @throws ListMemoryBoundsException if a request for an index beyond
+ *   the end of the list (or less than 0) is made.
+ */
+template<class T>
+T& DLList<T>::operator[](int index) const
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("DLList::operator[]", this->size, index);
+  }
+
+  return nodeAt(index)->value;
+}
+
+/**
+ * @brief Clear out list
+ *
+ * Clear or empty out the list.  Return the list back to an empty
+ * list.  Each node is destroyed, then the node pool gives the
+ * memory of all of the nodes back to the heap at once.
+ */
+template<class T>
+void DLList<T>::clear()
+{
+  // destroy the nodes before their memory is returned back to the heap,
+  // nodes holding values that need no destruction can be skipped
+  if (not is_trivially_destructible<T>::value)
+  {
+    DNode<T>* current = front;
+    while (current != nullptr)
+    {
+      DNode<T>* nodeToDelete = current;
+      current = current->next;
+      nodeToDelete->~DNode<T>();
+    }
+  }
+  nodePool.release();
+
+  // make sure size is now 0 and front and back both point to null
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+}
+
+/** @brief Insert value on back
+ *
+ * Append the indicated value to the end of this List of values.
+ * This is an O(1) operation.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& DLList<T>::insertBack(const T& value)
+{
+  emplaceBack(value);
+  return *this;
+}
+
+/** @brief Insert moved value on back
+ *
+ * Append the indicated value to the end of this List of values,
+ * moving the value into the new node instead of copying it.
+ *
+ * @param value The value to move to the end of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& DLList<T>::insertBack(T&& value)
+{
+  emplaceBack(move(value));
+  return *this;
+}
+
+/** @brief Overload operator>> to append
+ *
+ * Overload the operator>> to perform append operation.  Implementation
+ * is actually done by the insertBack() member function.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& DLList<T>::operator>>(const T& value)
+{
+  return insertBack(value);
+}
+
+/** @brief Delete back item
+ *
+ * Delete the item from the back of the list.  The back node knows
+ * the node before it, so unlike the singly linked list this is a
+ * constant time O(1) operation.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   delete back item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+void DLList<T>::deleteBack()
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("DLList::deleteBack", this->size);
+  }
+
+  unlinkNode(back);
+}
+
+/** @brief Insert value on front
+ *
+ * Prepend the indicated value to the beginning of this List of
+ * values.  This is an O(1) operation.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& DLList<T>::insertFront(const T& value)
+{
+  emplaceFront(value);
+  return *this;
+}
+
+/** @brief Insert moved value on front
+ *
+ * Prepend the indicated value to the beginning of this List of
+ * values, moving the value into the new node instead of copying it.
+ *
+ * @param value The value to move to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& DLList<T>::insertFront(T&& value)
+{
+  emplaceFront(move(value));
+  return *this;
+}
+
+/** @brief Overload operator<< to prepend
+ *
+ * Overload the operator<< to perform prepend operation.  Implementation
+ * is actually done by the insertFront() member function.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& DLList<T>::operator<<(const T& value)
+{
+  return insertFront(value);
+}
+
+/** @brief Delete front item
+ *
+ * Delete the item from the front of the list.  This is a constant
+ * time O(1) operation.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   delete front item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+void DLList<T>::deleteFront()
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("DLList::deleteFront", this->size);
+  }
+
+  unlinkNode(front);
+}
+
+/** @brief Delete value(s)
+ *
+ * Delete the value from the list.  This method will delete all
+ * instances of the value from this list that it finds, unlinking each
+ * matching node in a single walk down the list.  If the list does not
+ * conatin the value, then an exception is thrown.
+ *
+ * @param value The value to deleted from this list.
+ *
+ * @throws ListValueNotFoundException If we are asked to delete a value
+ *   that does not exist, we thrown an exception instead of silently
+ *   ignoring this condition.
+ */
+template<class T>
+void DLList<T>::deleteValue(const T& value)
+{
+  bool foundValue = false;
+
+  DNode<T>* current = front;
+  while (current != nullptr)
+  {
+    // advance before unlinking, the node is gone afterwards
+    DNode<T>* node = current;
+    current = current->next;
+    if (node->value == value)
+    {
+      unlinkNode(node);
+      foundValue = true;
+    }
+  }
+
+  // if we didn't find a value to delete, let the caller know there
+  // may have been a problem
+  if (not foundValue)
+  {
+    throw ListValueNotFoundException("DLList::deleteValue", value);
+  }
+}
+
+/** @brief Delete value at index
+ *
+ * Delete the value from the indicated index in this list.  The node
+ * is found by walking from the closer end of the list, then unlinked
+ * in O(1).
+ *
+ * @param index The index of the value in the list to be removed.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+void DLList<T>::deleteIndex(int index)
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("DLList::deleteIndex", this->size, index);
+  }
+
+  unlinkNode(nodeAt(index));
+}
+
+/** @brief Insert value at index
+ *
+ * Insert the indicated value into this list so that it ends up at
+ * the given index.  The node currently at the index is found by
+ * walking from the closer end of the list, and the new node is
+ * linked in before it.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to insert into the list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so
+ *   that the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& DLList<T>::insertAt(int index, const T& value)
+{
+  return insertAt(index, T(value));
+}
+
+/** @brief Insert moved value at index
+ *
+ * Insert the indicated value into this list at the given index,
+ * moving the value into the new node instead of copying it.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to move into the list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so
+ *   that the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& DLList<T>::insertAt(int index, T&& value)
+{
+  // the index can be 1 past the back, which appends the value
+  if ((index < 0) or (index > this->size))
+  {
+    throw ListMemoryBoundsException("DLList::insertAt", this->size, index);
+  }
+
+  DNode<T>* next = (index == this->size) ? nullptr : nodeAt(index);
+  emplaceBefore(next, move(value));
+
+  return *this;
+}
+
+/** @brief Begin iterator
+ *
+ * Create and return an iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns iterator returns a new forward iterator that keeps track
+ *   of iterating over the list items.
+ */
+template<class T>
+typename DLList<T>::iterator DLList<T>::begin()
+{
+  return iterator(front);
+}
+
+/** @brief End iterator
+ *
+ * Return an iterator pointing to one past the end of this list,
+ * which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns iterator returns a new forward iterator that points to
+ *   the end of the list.
+ */
+template<class T>
+typename DLList<T>::iterator DLList<T>::end()
+{
+  return iterator(nullptr);
+}
+
+/** @brief Begin iterator of constant list
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename DLList<T>::const_iterator DLList<T>::begin() const
+{
+  return const_iterator(front);
+}
+
+/** @brief End iterator of constant list
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename DLList<T>::const_iterator DLList<T>::end() const
+{
+  return const_iterator(nullptr);
+}
+
+/** @brief Constant begin iterator
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename DLList<T>::const_iterator DLList<T>::cbegin() const
+{
+  return const_iterator(front);
+}
+
+/** @brief Constant end iterator
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename DLList<T>::const_iterator DLList<T>::cend() const
+{
+  return const_iterator(nullptr);
+}
+
+/** @brief Reverse begin iterator
+ *
+ * Create and return an iterator pointing to the back of this list,
+ * that moves towards the front of the list as it is incremented.
+ *
+ * @returns DLListIterator<T> returns a new reverse iterator starting
+ *   at the back value of the list.
+ */
+template<class T>
+DLListIterator<T> DLList<T>::rbegin()
+{
+  DLListIterator<T> beginItr(back, true);
+  return beginItr;
+}
+
+/** @brief Reverse end iterator
+ *
+ * Return a reverse iterator pointing before the front of this list,
+ * which is used to detect we are done iterating in reverse.
+ *
+ * @returns DLListIterator<T> returns a new reverse iterator that
+ *   points to the end indicator of the reverse iteration.
+ */
+template<class T>
+DLListIterator<T> DLList<T>::rend()
+{
+  DLListIterator<T> endItr(nullptr, true);
+  return endItr;
+}
+
+/** @brief Find node at index
+ *
+ * Private helper to find the node holding the value at the given
+ * index.  We walk forward from the front if the index is in the
+ * first half of the list, and backward from the back otherwise.
+ *
+ * @param index The index of the node to find, must be a valid index
+ *   of this list.
+ *
+ * @returns DNode<T>* Returns a pointer to the node at the index.
+ */
+template<class T>
+DNode<T>* DLList<T>::nodeAt(int index) const
+{
+  DNode<T>* current;
+  if (index < this->size / 2)
+  {
+    current = front;
+    for (int currentIdx = 0; currentIdx < index; currentIdx++)
+    {
+      current = current->next;
+    }
+  }
+  else
+  {
+    current = back;
+    for (int currentIdx = this->size - 1; currentIdx > index; currentIdx--)
+    {
+      current = current->prev;
+    }
+  }
+
+  return current;
+}
+
+/** @brief Unlink node
+ *
+ * Private helper to remove the given node from the list.  The
+ * neighbors of the node are linked to each other, the front or back
+ * moves if the node was at that end, and the node is destroyed and
+ * its memory given back to the node pool.
+ *
+ * @param node The node of this list to remove.
+ */
+template<class T>
+void DLList<T>::unlinkNode(DNode<T>* node)
+{
+  if (node->prev == nullptr)
+  {
+    front = node->next;
+  }
+  else
+  {
+    node->prev->next = node->next;
+  }
+  if (node->next == nullptr)
+  {
+    back = node->prev;
+  }
+  else
+  {
+    node->next->prev = node->prev;
+  }
+
+  node->~DNode<T>();
+  nodePool.deallocate(node);
+  this->size--;
+}
@@ -0,0 +1,83 @@
+/** @file DLListIterator.hpp
+ * @brief Concrete Iterator for DLList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Definition of concrete DLListIterator to iterate over
+ * DLList<T> instances.
+ */
+#ifndef _DLLIST_ITERATOR_HPP_
+#define _DLLIST_ITERATOR_HPP_
+#include "DNode.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+using namespace std;
+
+/** @class DLListIterator
+ * @brief The forward iterator for doubly linked lists
+ *
+ * Iterate over the values of a DLList<T>.  Since the nodes are linked
+ * in both directions, the iterator can move either way, and a reverse
+ * iterator simply follows the prev links when it is incremented.  A
+ * DLListIterator<T> gives access to modify the values, a
+ * DLListIterator<const T> is the const_iterator of the list and only
+ * gives read access.  These are standard iterators, so they work with
+ * range based iteration as well as with the <algorithm> library.  The
+ * end of the list is a null node that can not be stepped back from, so
+ * they are forward iterators rather than bidirectional ones.
+ */
+template<class T>
+class DLListIterator
+{
+public:
+  // standard iterator traits
+  using iterator_category = forward_iterator_tag;
+  using value_type = remove_const_t<T>;
+  using difference_type = ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  // constructors
+  DLListIterator();
+  DLListIterator(DNode<value_type>* ptr, bool reverse = false);
+  template<class U, class = enable_if_t<is_same<const U, T>::value>>
+  DLListIterator(const DLListIterator<U>& other);
+
+  // accessing the current value
+  reference operator*() const;
+  pointer operator->() const;
+
+  // moving the iterator
+  DLListIterator<T>& operator++();
+  DLListIterator<T> operator++(int);
+  DLListIterator<T>& operator--();
+
+  // comparing iterators, mutable and const iterators can be mixed
+  template<class U>
+  bool operator==(const DLListIterator<U>& rhs) const;
+  template<class U>
+  bool operator!=(const DLListIterator<U>& rhs) const;
+
+private:
+  /// @brief pointer to the current node of the current
+  ///   iteration of the list
+  DNode<value_type>* current;
+
+  /// @brief true if this iterator moves from the back of the list
+  ///   towards the front when it is incremented
+  bool reverse;
+
+  // the const iterator is built from and compared to the mutable one
+  template<class U>
+  friend class DLListIterator;
+};
+
+// template member definitions
+#include "DLListIterator.ipp"
+
+#endif // define _DLLIST_ITERATOR_HPP_
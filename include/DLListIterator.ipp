@@ -0,0 +1,181 @@
+/** @file DLListIterator.ipp
+ * @brief Concrete Iterator for DLList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implementation of concrete DLListIterator to iterate over
+ * DLList<T> instances in either direction.
+ *
+ * This file is included at the end of DLListIterator.hpp and is not
+ * compiled on its own.
+ */
+#include <string>
+using namespace std;
+
+/**
+ * @brief Default constructor
+ *
+ * Default constructor, iterator will not be iterating over
+ * anything if constructed using the default constructor.
+ */
+template<class T>
+DLListIterator<T>::DLListIterator()
+{
+  current = nullptr;
+  reverse = false;
+}
+
+/**
+ * @brief Standard constructor
+ *
+ * Standard constructor, we are given a pointer to the node
+ * we are to begin iteration with, and the direction to iterate in.
+ *
+ * @param ptr A pointer to the DNode<T> item at start of
+ *   this iteration of the linked list DLList<T> instance.
+ * @param reverse True to iterate from the back of the list
+ *   towards the front.
+ */
+template<class T>
+DLListIterator<T>::DLListIterator(DNode<value_type>* ptr, bool reverse)
+{
+  this->current = ptr;
+  this->reverse = reverse;
+}
+
+/**
+ * @brief Converting constructor
+ *
+ * A mutable iterator can be turned into a const iterator to the same
+ * node, but not the other way around.
+ *
+ * @param other The mutable iterator to convert.
+ */
+template<class T>
+template<class U, class>
+DLListIterator<T>::DLListIterator(const DLListIterator<U>& other)
+{
+  this->current = other.current;
+  this->reverse = other.reverse;
+}
+
+/**
+ * @brief Overload dereference operator
+ *
+ * Overload the dereference operator* for the DLListIterator.
+ * This method makes it easy/convenient to access the info
+ * that the iterator is currently pointing two.
+ *
+ * @returns reference Returns a reference to the value currently being
+ *   pointed to by this iterator.
+ */
+template<class T>
+typename DLListIterator<T>::reference DLListIterator<T>::operator*() const
+{
+  return current->value;
+}
+
+/**
+ * @brief Overload member access operator
+ *
+ * @returns pointer Returns a pointer to the value of the current node.
+ */
+template<class T>
+typename DLListIterator<T>::pointer DLListIterator<T>::operator->() const
+{
+  return &current->value;
+}
+
+/**
+ * @brief Overload increment operator
+ *
+ * Overload the pre increment operator++.  This is defined to cause the
+ * iterator to move to the next item in the direction of the iteration,
+ * towards the back for a forward iterator and towards the front for a
+ * reverse iterator.
+ *
+ * @returns DLListIterator<T>& We need to return ourself after
+ *   incrementing the iterator to the next value of the list we are
+ *   iterating over.
+ */
+template<class T>
+DLListIterator<T>& DLListIterator<T>::operator++()
+{
+  current = reverse ? current->prev : current->next;
+
+  return *this;
+}
+
+/**
+ * @brief Overload post increment operator
+ *
+ * @returns DLListIterator<T> Returns a copy of ourself from before we
+ *   were moved to the next node.
+ */
+template<class T>
+DLListIterator<T> DLListIterator<T>::operator++(int)
+{
+  DLListIterator<T> before(*this);
+  current = reverse ? current->prev : current->next;
+
+  return before;
+}
+
+/**
+ * @brief Overload decrement operator
+ *
+ * Overload the pre decrement operator--.  This moves the iterator back
+ * to the previous item in the direction of the iteration.
+ *
+ * @returns DLListIterator<T>& We need to return ourself after
+ *   decrementing the iterator to the previous value of the list.
+ */
+template<class T>
+DLListIterator<T>& DLListIterator<T>::operator--()
+{
+  current = reverse ? current->next : current->prev;
+
+  return *this;
+}
+
+/**
+ * @brief Overload boolean equality operator
+ *
+ * Overload the boolean operator== to check for equivalence.  This is
+ * needed to create loops and test if we are done yet or not iterating
+ * over the list by testing if the iterator is == the end() iterator item.
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators are both pointing to the same
+ *   value of the iteration, false otherwise.
+ */
+template<class T>
+template<class U>
+bool DLListIterator<T>::operator==(const DLListIterator<U>& rhs) const
+{
+  return current == rhs.current;
+}
+
+/**
+ * @brief Overload boolean not equal operator
+ *
+ * Overload the boolean operator!= to check for nonequivalance.  This is
+ * needed to create loops and test if we are done yet or not iterating
+ * over the list by testing if the iterator is != the end() iterator item.
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators are not pointing to the same
+ *   value of the iteration, false otherwise.
+ */
+template<class T>
+template<class U>
+bool DLListIterator<T>::operator!=(const DLListIterator<U>& rhs) const
+{
+  return current != rhs.current;
+}
@@ -0,0 +1,52 @@
+/** @file DNode.hpp
+ * @brief Definition of the DNode class used by DLList linked lists.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Definition of DNode class used by DLList doubly linked list
+ * implementations and supporting iteration classes.  Simplifies
+ * inclusion circular references to put this structure definition in
+ * its own file.
+ */
+#ifndef _DNODE_HPP_
+#define _DNODE_HPP_
+#include <utility>
+using namespace std;
+
+/** DNode
+ * A simple node structure type to be used to hold values in our
+ * doubly linked list implementation of the List ADT.  Each node is
+ * linked to both the node before it and the node after it.
+ */
+template<class T>
+struct DNode
+{
+public:
+  /// @brief Construct a node linked to the given previous and next
+  ///   nodes, with the value constructed in place from the remaining
+  ///   arguments.
+  template<class... Args>
+  DNode(DNode<T>* prev, DNode<T>* next, Args&&... args)
+    : value(forward<Args>(args)...),
+      prev(prev),
+      next(next)
+  {
+  }
+
+  /// @brief the actual date value of type T this node contains.
+  T value;
+
+  /// @brief A pointer to the previous node of the linked list, or
+  ///    nullptr if this node is the front node.
+  DNode<T>* prev;
+
+  /// @brief A pointer to the next node of the linked list, or
+  ///    nullptr if this node is the back node.
+  DNode<T>* next;
+};
+
+#endif // define _DNODE_HPP_
@@ -0,0 +1,142 @@
+/** @file GList.hpp
+ * @brief Concrete gap buffer based implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using a gap buffer.  Like the AList,
+ * values are kept in a dynamically allocated block of memory that
+ * doubles in size when it becomes full.  But the unused slots of the
+ * block are not kept at the end, they form a gap that is kept at the
+ * position of the last insertion or deletion.  Values before the gap
+ * are at the beginning of the block, values after the gap are at the
+ * end of the block.  An edit only needs to move the gap from the
+ * position of the previous edit, so edits clustered near each other
+ * cost O(distance) instead of O(n), and indexing is still O(1).
+ */
+#ifndef _GLIST_HPP_
+#define _GLIST_HPP_
+#include "GListIterator.hpp"
+#include "List.hpp"
+#include <string>
+using namespace std;
+
+/** @class GList
+ * @brief The GList concrete gap buffer based implemention of the
+ *   List interface.
+ *
+ * Concrete implementation of List abstraction using an array
+ * with a movable gap of unused slots.
+ */
+template<class T>
+class GList : public List<T>
+{
+public:
+  // constructors and destructors
+  GList();                              // default constructor
+  GList(int size, T values[]);          // array based constructor
+  GList(const GList<T>& otherList);     // copy constructor
+  GList(GList<T>&& otherList) noexcept; // move constructor
+  ~GList();                             // destructor
+
+  // assignment operators
+  GList<T>& operator=(const GList<T>& rhs);
+  GList<T>& operator=(GList<T>&& rhs) noexcept;
+
+  // accessor and information methods
+  int getAllocationSize() const;
+  T getFront() const;
+  T getBack() const;
+  bool operator==(const List<T>& rhs) const;
+  T& operator[](int index) const;
+
+  // adding, accessing and removing values from the list
+  void clear();
+  List<T>& insertBack(const T& value);
+  List<T>& insertBack(T&& value);
+  List<T>& operator>>(const T& value);
+  void deleteBack();
+  List<T>& insertFront(const T& value);
+  List<T>& insertFront(T&& value);
+  List<T>& operator<<(const T& value);
+  void deleteFront();
+  void deleteValue(const T& value);
+  void deleteIndex(int index);
+  List<T>& insertAt(int index, const T& value);
+  List<T>& insertAt(int index, T&& value);
+
+  // iterating over list the C++ way, using forward iterator objects
+  // and supporting range based iteration and <algorithm>
+  using value_type = T;
+  using iterator = GListIterator<T>;
+  using const_iterator = GListIterator<const T>;
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+protected:
+  // writing values out to a stream, indexing our own values directly
+  void writeValues(ListWriter<T>& writer, int first, int count) const;
+
+private:
+  /// @brief private constant, initial allocation size for empty lists
+  ///   to grow to
+  const int INITIAL_ALLOCATION_SIZE = 10;
+
+  /// @brief the current amount of allocated memory being
+  ///   managed by/for this list of values
+  int allocationSize;
+
+  /// @brief the slot where the gap begins, which is also the index
+  ///   of the list where the gap currently sits.  The values before
+  ///   the gap occupy slots 0 up to gapStart.
+  int gapStart;
+
+  /// @brief the slot just past the end of the gap.  The values after
+  ///   the gap occupy slots gapEnd up to the end of the block.
+  int gapEnd;
+
+  /// @brief The block of values holding the list and the gap.  The
+  ///   block is raw storage, the slots of the gap are never holding
+  ///   constructed values.
+  T* values;
+
+  // private member methods for managing the List internally
+  int slot(int index) const;
+  void moveGapTo(int index);
+  void growListIfNeeded();
+  void copyValues(const T* source, int count);
+  static T* allocateValues(int allocationSize);
+  static void deallocateValues(T* values, int allocationSize);
+};
+
+/** @brief Map list index to block slot
+ *
+ * Private helper to find the slot in our block of values that holds
+ * the value at the given index of the list.  Indexes at or past the
+ * gap have to skip over the slots of the gap.
+ *
+ * @param index The index into the list.
+ *
+ * @returns int Returns the slot in the block of values for the index.
+ */
+template<class T>
+inline int GList<T>::slot(int index) const
+{
+  if (index < gapStart)
+  {
+    return index;
+  }
+  return index + (gapEnd - gapStart);
+}
+
+// template member definitions
+#include "GList.ipp"
+
+#endif // define _GLIST_HPP_
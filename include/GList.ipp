@@ -0,0 +1,937 @@
+/** @file GList.ipp
+ * @brief Concrete gap buffer based implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using a gap buffer.  The block of
+ * memory holds the values before the gap at its beginning and the
+ * values after the gap at its end.  Every insertion or deletion first
+ * moves the gap to the index of the edit, which costs one value move
+ * per index the gap travels, and then simply constructs a value into
+ * the gap or widens the gap over the deleted value.  Sequences of
+ * edits near each other, including appending on the back, are cheap,
+ * while edits that jump around the list are O(n) like the AList.
+ *
+ * This file is included at the end of GList.hpp and is not compiled on
+ * its own.
+ */
+#include "GListIterator.hpp"
+#include "ListException.hpp"
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/** @brief Default constructor
+ *
+ * Construct an empty list.  The empty list will have no allocated memory
+ * nor any values.
+ */
+template<class T>
+GList<T>::GList()
+{
+  // Empty list has no values nor any allocated memory
+  // associated with it
+  this->size = 0;
+  allocationSize = 0;
+  gapStart = 0;
+  gapEnd = 0;
+  values = nullptr;
+}
+
+/** @brief Standard constructor
+ *
+ * Construct a list of values from a (statically) defined and provided
+ * array of values.  We allocate a block of memory dynamically large
+ * enough to hold the values and copy them into the beginning of the
+ * block, leaving the (empty) gap at the back of the list.
+ *
+ * @param size The size of the input values were are given as well as the
+ *   size of the new list we are to construct.
+ * @param values The (static) array of values to use to construct
+ *   this List values with.
+ */
+template<class T>
+GList<T>::GList(int size, T values[])
+{
+  this->size = 0;
+  allocationSize = size;
+  gapStart = 0;
+  gapEnd = allocationSize;
+  this->values = allocateValues(allocationSize);
+
+  // copy construct the values from the input paramter into our new block
+  copyValues(values, size);
+}
+
+/** @brief Copy constructor
+ *
+ * Provide a copy constructor for the GList class, making a copy of
+ * the values from the given input list into a new GList instance.
+ * The block of the copy is exactly large enough for the values, and
+ * its gap is at the back of the list.
+ *
+ * @param list The other List type we are to make a copy of in this
+ *   constructor.
+ */
+template<class T>
+GList<T>::GList(const GList<T>& list)
+{
+  this->size = 0;
+  allocationSize = list.size;
+  gapStart = 0;
+  gapEnd = allocationSize;
+  values = allocateValues(allocationSize);
+
+  // copy the values before the gap of the other list, then the values
+  // after its gap
+  copyValues(list.values, list.gapStart);
+  copyValues(list.values + list.gapEnd, list.allocationSize - list.gapEnd);
+}
+
+/** @brief Move constructor
+ *
+ * Construct this list by taking over the block of memory of the
+ * given list, which is left as an empty list.  No values are
+ * copied.
+ *
+ * @param list The other List whose values we are to take over.
+ */
+template<class T>
+GList<T>::GList(GList<T>&& list) noexcept
+{
+  // take over the values and allocation of the other list
+  this->size = list.size;
+  allocationSize = list.allocationSize;
+  gapStart = list.gapStart;
+  gapEnd = list.gapEnd;
+  values = list.values;
+
+  // the other list is now empty and no longer owns the memory
+  list.size = 0;
+  list.allocationSize = 0;
+  list.gapStart = 0;
+  list.gapEnd = 0;
+  list.values = nullptr;
+}
+
+/** @brief Class destructor
+ *
+ * Destructor for the List class.  Invoke the clear of this concrete
+ * class to destroy the values and deallocate the block of memory.
+ */
+template<class T>
+GList<T>::~GList()
+{
+  // call clear to do actual work to deallocate any allocation
+  // before we destruct
+  this->clear();
+}
+
+/** @brief Copy assignment operator
+ *
+ * Replace the values of this list with a copy of the values of
+ * the right hand side list.  The copy is made first, so that
+ * this list is left unchanged if the copy fails.
+ *
+ * @param rhs The other List we are to make a copy of.
+ *
+ * @returns GList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+GList<T>& GList<T>::operator=(const GList<T>& rhs)
+{
+  if (this != &rhs)
+  {
+    // copy into a temporary then move the copy into this list
+    GList<T> copy(rhs);
+    *this = move(copy);
+  }
+
+  return *this;
+}
+
+/** @brief Move assignment operator
+ *
+ * Release the values of this list and take over the block of
+ * memory of the right hand side list, which is left as an
+ * empty list.
+ *
+ * @param rhs The other List whose values we are to take over.
+ *
+ * @returns GList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+GList<T>& GList<T>::operator=(GList<T>&& rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    // give back our own memory before taking over the other list
+    clear();
+
+    this->size = rhs.size;
+    allocationSize = rhs.allocationSize;
+    gapStart = rhs.gapStart;
+    gapEnd = rhs.gapEnd;
+    values = rhs.values;
+
+    rhs.size = 0;
+    rhs.allocationSize = 0;
+    rhs.gapStart = 0;
+    rhs.gapEnd = 0;
+    rhs.values = nullptr;
+  }
+
+  return *this;
+}
+
+/** @brief Allocation size accessor
+ *
+ * Accessor method to get the current amount of memory allocated
+ * by and being managed by this list.
+ *
+ * @returns int Returns the current allocation size of the
+ *   list of values.
+ */
+template<class T>
+int GList<T>::getAllocationSize() const
+{
+  return allocationSize;
+}
+
+/** @brief Access front of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the front of this list.
+ *
+ * @returns T Returns a copy of the front item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access front item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T GList<T>::getFront() const
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("GList::getFront", this->size);
+  }
+
+  // otherwise safe to return the front item
+  return values[slot(0)];
+}
+
+/** @brief Access back of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the back of this list.
+ *
+ * @returns T Returns a copy of the back item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access back item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T GList<T>::getBack() const
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("GList::getBack", this->size);
+  }
+
+  // otherwise safe to return the back item
+  return values[slot(this->size - 1)];
+}
+
+/** @brief Write values to stream
+ *
+ * Write the given range of values to the output stream, separated by a
+ * comma and a space, indexing around the gap directly rather than
+ * going through operator[] for each value.
+ *
+ * @param writer The stream or string to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write, at least 1.
+ */
+template<class T>
+void GList<T>::writeValues(ListWriter<T>& writer, int first, int count) const
+{
+  writer.writeValue(values[slot(first)]);
+  for (int index = first + 1; index < first + count; index++)
+  {
+    writer.writeText(", ");
+    writer.writeValue(values[slot(index)]);
+  }
+}
+
+/** @brief Boolean equals operator
+ *
+ * Check if this List is equal to the right hand side (rhs)
+ * list.  The lists are equal if their sizes are equal, and if
+ * all elements in both lists are equal.
+ * The comparison is done by List<T>::equals(), using whichever
+ * list is able to walk through its values fastest.
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this List to.
+ *
+ * @returns bool true if the lists are equal, false if the are not.
+ */
+template<class T>
+bool GList<T>::operator==(const List<T>& rhs) const
+{
+  // the list that can walk through its own values does the comparing
+  return this->equals(rhs);
+}
+
+/** @brief Indexing operator
+ *
+ * Provide a way to index individual values of the list.  The list
+ * index is mapped to its slot in the block, skipping over the gap,
+ * so this is still an O(1) operation.  We also provide bounds checking
+ * to ensure no illegal access beyond the list bounds is attempted.
+ *
+ * @param index The index of the value it is desired to access from
+ *   this List.
+ *
+ * @returns T& Returns a reference to the requested List item at
+ *   the requested index.
+ *
+ * @throws ListMemoryBoundsException if a request for an index beyond
+ *   the end of the list (or less than 0) is made.
+ */
+template<class T>
+T& GList<T>::operator[](int index) const
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("GList::operator[]", this->size, index);
+  }
+
+  // otherwise it is safe to return the reference to this value
+  return values[slot(index)];
+}
+
+/** @brief Clear out list
+ *
+ * Clear or empty out the list.  Return the list back
+ * to an empty list.
+ */
+template<class T>
+void GList<T>::clear()
+{
+  // destroy the live values on both sides of the gap
+  destroy(values, values + gapStart);
+  destroy(values + gapEnd, values + allocationSize);
+
+  // if values is not null, it points to a dynamic block of memory, so
+  // deallocate that block.
+  if (values != nullptr)
+  {
+    deallocateValues(values, allocationSize);
+    values = nullptr;
+  }
+
+  // make sure size and allocation are both reading as 0 now
+  this->size = 0;
+  allocationSize = 0;
+  gapStart = 0;
+  gapEnd = 0;
+}
+
+/** @brief Insert value on back
+ *
+ * Append the indicated value to the end of this List of values.  The
+ * gap is moved to the back of the list first, so a sequence of appends
+ * is O(1) each (amortized over growth).
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& GList<T>::insertBack(const T& value)
+{
+  return insertAt(this->size, value);
+}
+
+/** @brief Insert moved value on back
+ *
+ * Append the indicated value to the end of this List of values,
+ * moving the value into the list instead of copying it.
+ *
+ * @param value The value to move onto the end of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& GList<T>::insertBack(T&& value)
+{
+  return insertAt(this->size, move(value));
+}
+
+/** @brief Overload operator>> to append
+ *
+ * Overload the operator>> to perform append operation.  Implementation
+ * is actually done by the insertBack() member function.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& GList<T>::operator>>(const T& value)
+{
+  return insertBack(value);
+}
+
+/** @brief Delete back item
+ *
+ * Delete the item from the back of the list.  The gap is moved to the
+ * back of the list and widened over the back value.
+ */
+template<class T>
+void GList<T>::deleteBack()
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("GList::deleteBack", this->size);
+  }
+
+  deleteIndex(this->size - 1);
+}
+
+/** @brief Insert value on front
+ *
+ * Prepend the indicated value to the beginning of this List of values.
+ * The gap is moved to the front of the list first, so a sequence of
+ * prepends is O(1) each (amortized over growth).
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& GList<T>::insertFront(const T& value)
+{
+  return insertAt(0, value);
+}
+
+/** @brief Insert moved value on front
+ *
+ * Prepend the indicated value to the beginning of this List of
+ * values, moving the value into the list instead of copying it.
+ *
+ * @param value The value to move onto the beginning of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& GList<T>::insertFront(T&& value)
+{
+  return insertAt(0, move(value));
+}
+
+/** @brief Overload operator<< to prepend
+ *
+ * Overload the operator<< to perform prepend operation.  Implementation
+ * is actually done by the insertFront() member function.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& GList<T>::operator<<(const T& value)
+{
+  return insertFront(value);
+}
+
+/** @brief Delete front item
+ *
+ * Delete the item from the front of the list.  The gap is moved to the
+ * front of the list and widened over the front value.
+ */
+template<class T>
+void GList<T>::deleteFront()
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("GList::deleteFront", this->size);
+  }
+
+  deleteIndex(0);
+}
+
+/** @brief Delete value(s)
+ *
+ * Delete the value from the list.  This method will delete all
+ * instances of the value from this list that it finds.  If the list
+ * does not conatin the value, then an exception is thrown.  We search
+ * backwards through the list, so the gap only ever travels towards the
+ * front and all of the deletions together cost O(n).
+ *
+ * @param value The value to deleted from this list.
+ *
+ * @throws ListValueNotFoundException If we are asked to delete a value
+ *   that does not exist, we thrown an exception instead of silently
+ *   ignoring this condition.
+ */
+template<class T>
+void GList<T>::deleteValue(const T& value)
+{
+  // flag so we can tell if we succeeded at least one time
+  // or not in finding a value to remove
+  bool foundValue = false;
+
+  // iterate backwards through the list so we can safely use the
+  // deleteIndex() List method to remove any values that we
+  // find
+  for (int index = this->size - 1; index >= 0; index--)
+  {
+    // if we find a value, remove it from the list
+    if (values[slot(index)] == value)
+    {
+      deleteIndex(index);
+      foundValue = true;
+    }
+  }
+
+  // if we didn't find a value to delete, let the caller know there
+  // may have been a problem
+  if (not foundValue)
+  {
+    throw ListValueNotFoundException("GList::deleteValue", value);
+  }
+}
+
+/** @brief Delete value at index
+ *
+ * Delete the value from the indicated index in this list.  The gap is
+ * moved to the index, after which the value to delete is the first
+ * value after the gap, and the gap is simply widened over it.
+ *
+ * @param index The index of the value in the list to be removed.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+void GList<T>::deleteIndex(int index)
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("GList::deleteIndex", this->size, index);
+  }
+
+  // move the gap to the index and widen it over the value
+  moveGapTo(index);
+  values[gapEnd].~T();
+  gapEnd++;
+  this->size--;
+}
+
+/** @brief Insert value at index
+ *
+ * Insert the indicated value into this list so that it ends up at the
+ * given index.  The gap is moved to the index and the value is
+ * constructed into the first slot of the gap.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to insert into the list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& GList<T>::insertAt(int index, const T& value)
+{
+  return insertAt(index, T(value));
+}
+
+/** @brief Insert moved value at index
+ *
+ * Insert the indicated value into this list at the given index,
+ * moving the value into the list instead of copying it.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to move into the list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& GList<T>::insertAt(int index, T&& value)
+{
+  // the index can be 1 past the back, which appends the value
+  if ((index < 0) or (index > this->size))
+  {
+    throw ListMemoryBoundsException("GList::insertAt", this->size, index);
+  }
+
+  // take the value before growing, it may refer to a value in our
+  // current block of memory
+  T newValue(move(value));
+  growListIfNeeded();
+
+  // move the gap to the index and construct the value into it
+  moveGapTo(index);
+  new (values + gapStart) T(move(newValue));
+  gapStart++;
+  this->size++;
+
+  return *this;
+}
+
+/** @brief Begin iterator
+ *
+ * Create and return an iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns iterator returns a new forward iterator that keeps track
+ *   of iterating over the list items.
+ */
+template<class T>
+typename GList<T>::iterator GList<T>::begin()
+{
+  return iterator(0, gapStart, gapEnd - gapStart, values);
+}
+
+/** @brief End iterator
+ *
+ * Return an iterator pointing to one past the end of this list,
+ * which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns iterator returns a new forward iterator that points to
+ *   the end of the list.
+ */
+template<class T>
+typename GList<T>::iterator GList<T>::end()
+{
+  return iterator(this->size, gapStart, gapEnd - gapStart, values);
+}
+
+/** @brief Begin iterator of constant list
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename GList<T>::const_iterator GList<T>::begin() const
+{
+  return const_iterator(0, gapStart, gapEnd - gapStart, values);
+}
+
+/** @brief End iterator of constant list
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename GList<T>::const_iterator GList<T>::end() const
+{
+  return const_iterator(this->size, gapStart, gapEnd - gapStart, values);
+}
+
+/** @brief Constant begin iterator
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename GList<T>::const_iterator GList<T>::cbegin() const
+{
+  return const_iterator(0, gapStart, gapEnd - gapStart, values);
+}
+
+/** @brief Constant end iterator
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename GList<T>::const_iterator GList<T>::cend() const
+{
+  return const_iterator(this->size, gapStart, gapEnd - gapStart, values);
+}
+
+/** @brief Move gap
+ *
+ * Private member method to move the gap so that it begins at the given
+ * index of the list.  The values between the current position of the
+ * gap and the new position are moved across the gap, one value move
+ * for each index the gap travels.  Each value is move constructed into
+ * an unused slot and then destroyed, so the slots of the gap never hold
+ * live values.  Trivially copyable values are moved with a single
+ * memmove of the block.
+ *
+ * @param index The index of the list the gap should begin at.
+ */
+template<class T>
+void GList<T>::moveGapTo(int index)
+{
+  int gapLength = gapEnd - gapStart;
+
+  // a full block has an empty gap, only its position changes
+  if (gapLength == 0)
+  {
+    gapStart = index;
+    gapEnd = index;
+    return;
+  }
+
+  if (index < gapStart)
+  {
+    // gap moves towards the front, values before it move to the back
+    // side of the gap, starting with the value next to the gap
+    int count = gapStart - index;
+    if constexpr (is_trivially_copyable<T>::value)
+    {
+      memmove(values + gapEnd - count, values + index, sizeof(T) * count);
+    }
+    else
+    {
+      for (int source = gapStart - 1; source >= index; source--)
+      {
+        new (values + source + gapLength) T(move(values[source]));
+        values[source].~T();
+      }
+    }
+    gapStart -= count;
+    gapEnd -= count;
+  }
+  else if (index > gapStart)
+  {
+    // gap moves towards the back, values after it move to the front
+    // side of the gap, starting with the value next to the gap
+    int count = index - gapStart;
+    if constexpr (is_trivially_copyable<T>::value)
+    {
+      memmove(values + gapStart, values + gapEnd, sizeof(T) * count);
+    }
+    else
+    {
+      for (int source = gapEnd; source < gapEnd + count; source++)
+      {
+        new (values + source - gapLength) T(move(values[source]));
+        values[source].~T();
+      }
+    }
+    gapStart += count;
+    gapEnd += count;
+  }
+}
+
+/** @brief Grow list allocation
+ *
+ * Private member method that will increase the memory allocation if
+ * the list is currently at capacity, in which case the gap is empty.
+ * We double the current allocation and relocate the values before the
+ * gap to the beginning of the new block and the values after the gap
+ * to the end of the new block, so the new gap is all of the added
+ * slots.  If relocating a value throws, the list is left unchanged.
+ */
+template<class T>
+void GList<T>::growListIfNeeded()
+{
+  // if size is still less than what we have allocated, we still have room
+  // to grow at least one or more items in sizes
+  if (this->size < allocationSize)
+  {
+    return;
+  }
+
+  // otherwise size is equal to our allocation, double the size of our allocation
+  // to accommodate future growth, or make size 10 initially by default if
+  // an empty list is being grown
+  int newAllocationSize;
+  if (allocationSize == 0)
+  {
+    newAllocationSize = INITIAL_ALLOCATION_SIZE;
+  }
+  else
+  {
+    newAllocationSize = 2 * allocationSize;
+  }
+
+  // dynamically allocate a new block of raw memory of the new size
+  T* newValues = allocateValues(newAllocationSize);
+  int backCount = allocationSize - gapEnd;
+  int newGapEnd = newAllocationSize - backCount;
+
+  // relocate the values on both sides of the gap, a trivially copyable
+  // value can simply have its bytes copied
+  if constexpr (is_trivially_copyable<T>::value)
+  {
+    if (gapStart > 0)
+    {
+      memcpy(newValues, values, sizeof(T) * gapStart);
+    }
+    if (backCount > 0)
+    {
+      memcpy(newValues + newGapEnd, values + gapEnd, sizeof(T) * backCount);
+    }
+  }
+  else
+  {
+    int index = 0;
+    try
+    {
+      for (; index < this->size; index++)
+      {
+        int newSlot = (index < gapStart) ? index : index + (newGapEnd - gapStart);
+        new (newValues + newSlot) T(move_if_noexcept(values[slot(index)]));
+      }
+    }
+    catch (...)
+    {
+      // undo the partial relocation, the original values are still intact
+      for (int undo = 0; undo < index; undo++)
+      {
+        int newSlot = (undo < gapStart) ? undo : undo + (newGapEnd - gapStart);
+        newValues[newSlot].~T();
+      }
+      deallocateValues(newValues, newAllocationSize);
+      throw;
+    }
+
+    // we don't need the old values anymore
+    destroy(values, values + gapStart);
+    destroy(values + gapEnd, values + allocationSize);
+  }
+
+  // be good managers of memory and return the old block to the heap
+  if (values != nullptr)
+  {
+    deallocateValues(values, allocationSize);
+  }
+
+  // now make sure we are using the new block of memory going forward for this
+  // list, the gap stays at the same index of the list
+  values = newValues;
+  allocationSize = newAllocationSize;
+  gapEnd = newGapEnd;
+}
+
+/** @brief Copy values onto back
+ *
+ * Private member method to copy construct the given values onto the
+ * back of this list.  This is only used by constructors while the gap
+ * is at the back of the list, and the allocation must already be large
+ * enough to hold the values.  If a copy throws, the list is cleared and
+ * our block of memory is given back.
+ *
+ * @param source The array of values to copy from.
+ * @param count The number of values to copy.
+ */
+template<class T>
+void GList<T>::copyValues(const T* source, int count)
+{
+  try
+  {
+    uninitialized_copy_n(source, count, values + gapStart);
+  }
+  catch (...)
+  {
+    // uninitialized_copy_n already destroyed any partial copies
+    clear();
+    throw;
+  }
+  gapStart += count;
+  this->size += count;
+}
+
+/** @brief Allocate raw storage
+ *
+ * Private helper to allocate an uninitialized block of memory large
+ * enough to hold the requested number of values.  No values are
+ * constructed in the block.
+ *
+ * @param allocationSize The number of values the block should hold.
+ *
+ * @returns T* Returns a pointer to the new block, or nullptr when
+ *   an empty allocation is requested.
+ */
+template<class T>
+T* GList<T>::allocateValues(int allocationSize)
+{
+  if (allocationSize == 0)
+  {
+    return nullptr;
+  }
+
+  return allocator<T>().allocate(allocationSize);
+}
+
+/** @brief Deallocate raw storage
+ *
+ * Private helper to give a block of memory obtained from
+ * allocateValues() back to the heap.  Any values that were constructed
+ * in the block must already have been destroyed.
+ *
+ * @param values The block of memory to deallocate.
+ * @param allocationSize The number of values the block was allocated for.
+ */
+template<class T>
+void GList<T>::deallocateValues(T* values, int allocationSize)
+{
+  allocator<T>().deallocate(values, allocationSize);
+}
@@ -0,0 +1,83 @@
+/** @file GListIterator.hpp
+ * @brief Concrete Iterator for GList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Definition of concrete GListIterator to iterate over
+ * GList<T> instances.
+ */
+#ifndef _GLIST_ITERATOR_HPP_
+#define _GLIST_ITERATOR_HPP_
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+using namespace std;
+
+/** @class GListIterator
+ * @brief The forward iterator for gap buffer lists
+ *
+ * Iterate over the values of a GList<T> in list order, skipping
+ * over the gap of unused slots in the block of values.
+ * A GListIterator<T> gives access to modify the values, a
+ * GListIterator<const T> is the const_iterator of the list and only
+ * gives read access.  These are standard iterators, so they work with
+ * range based iteration as well as with the <algorithm> library.
+ */
+template<class T>
+class GListIterator
+{
+public:
+  // standard iterator traits
+  using iterator_category = forward_iterator_tag;
+  using value_type = remove_const_t<T>;
+  using difference_type = ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  // constructors
+  GListIterator();
+  GListIterator(int index, int gapStart, int gapLength, T* values);
+  template<class U, class = enable_if_t<is_same<const U, T>::value>>
+  GListIterator(const GListIterator<U>& other);
+
+  // accessing the current value
+  reference operator*() const;
+  pointer operator->() const;
+
+  // moving the iterator
+  GListIterator<T>& operator++();
+  GListIterator<T> operator++(int);
+
+  // comparing iterators, mutable and const iterators can be mixed
+  template<class U>
+  bool operator==(const GListIterator<U>& rhs) const;
+  template<class U>
+  bool operator!=(const GListIterator<U>& rhs) const;
+
+private:
+  /// The GList<T> class copies the current pointer
+  ///   to the list values when this iterator is
+  ///   created
+  T* values;
+  /// The slot of the block of values where the gap begins
+  int gapStart;
+  /// The number of unused slots in the gap that iteration
+  ///   has to skip over
+  int gapLength;
+  /// Current index to the point we currently are at
+  ///   in iterating through this GList
+  int current;
+
+  // the const iterator is built from and compared to the mutable one
+  template<class U>
+  friend class GListIterator;
+};
+
+// template member definitions
+#include "GListIterator.ipp"
+
+#endif // define _GLIST_ITERATOR_HPP_
@@ -0,0 +1,74 @@
+/** @file GrowthPolicy.hpp
+ * @brief Growth policies for array based List implementations.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Declare the GrowthPolicy used by array based lists to decide how
+ * large a new block of memory should be when the list grows, and
+ * (optionally) when to give memory back after the list shrinks.
+ */
+#ifndef _GROWTH_POLICY_HPP_
+#define _GROWTH_POLICY_HPP_
+using namespace std;
+
+/** @class GrowthPolicy
+ * @brief Decide allocation sizes for an array based list.
+ *
+ * A list asks its policy for a new allocation size whenever it runs
+ * out of room, and, if auto shrinking is enabled, whenever values are
+ * removed.  Growth can double the allocation, grow it by half, or add
+ * a fixed sized chunk.  Auto shrinking uses hysteresis: the allocation
+ * is only halved once the list drops to a quarter full, so a list that
+ * alternately grows and shrinks around a boundary does not reallocate
+ * on every operation.
+ */
+class GrowthPolicy
+{
+public:
+  /// @brief the ways the allocation of a list can be grown
+  enum GrowthType
+  {
+    DOUBLING,
+    ONE_AND_HALF,
+    FIXED_CHUNK
+  };
+
+  // constructors
+  GrowthPolicy();
+  GrowthPolicy(GrowthType growthType, int initialAllocationSize, int chunkSize, bool autoShrink);
+
+  // factory methods for the common policies
+  static GrowthPolicy doubling();
+  static GrowthPolicy oneAndHalf();
+  static GrowthPolicy fixedChunk(int chunkSize);
+
+  // accessor and information methods
+  GrowthType getGrowthType() const;
+  int getInitialAllocationSize() const;
+  int getChunkSize() const;
+  bool isAutoShrink() const;
+  GrowthPolicy withAutoShrink(bool autoShrink) const;
+
+  // allocation size decisions
+  int grow(int allocationSize, int requiredSize) const;
+  int shrink(int allocationSize, int size) const;
+
+private:
+  /// @brief the way the allocation is grown when the list is full
+  GrowthType growthType;
+
+  /// @brief the allocation size an empty list grows to
+  int initialAllocationSize;
+
+  /// @brief number of values added to the allocation by FIXED_CHUNK growth
+  int chunkSize;
+
+  /// @brief true if the allocation should be reduced as values are removed
+  bool autoShrink;
+};
+
+#endif // _GROWTH_POLICY_HPP_
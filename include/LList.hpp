@@ -18,8 +18,15 @@
 #define _LLIST_HPP_
 #include "LListIterator.hpp"
 #include "List.hpp"
+#include "ListBinary.hpp"
 #include "Node.hpp"
+#include "NodePool.hpp"
+#include "SkipIndex.hpp"
+#include <algorithm>
+#include <iterator>
+#include <new>
 #include <string>
+#include <utility>
 using namespace std;
 
 /** @class LList
@@ -27,20 +34,27 @@ using namespace std;
  *   List interface.
  *
  * Concrete implementation of List abstraction using an
- * array based implementation.
+ * array based implementation.  The memory for the nodes of the list
+ * comes from the NodeAllocator, by default a NodePool owned by the
+ * list.  A SkipIndex can optionally be enabled to find the node at any
+ * index in expected O(log n).
  */
-template<class T>
+template<class T, class NodeAllocator = NodePool<Node<T>>>
 class LList : public List<T>
 {
 public:
   // constructors and destructors
   LList();                          // default constructor
   LList(int size, T values[]);      // array based constructor
-  LList(const LList<T>& otherList); // copy constructor
+  LList(const LList<T, NodeAllocator>& otherList); // copy constructor
+  LList(LList<T, NodeAllocator>&& otherList) noexcept; // move constructor
   ~LList();                         // destructor
 
+  // assignment operators
+  LList<T, NodeAllocator>& operator=(const LList<T, NodeAllocator>& rhs);
+  LList<T, NodeAllocator>& operator=(LList<T, NodeAllocator>&& rhs) noexcept;
+
   // accessor and information methods
-  string str() const;
   bool operator==(const List<T>& rhs) const;
   T& operator[](int index) const;
   List<T>& operator>>(const T& value);
@@ -51,18 +65,58 @@ public:
   void deleteBack();
   void deleteFront();
   List<T>& insertBack(const T& value);
+  List<T>& insertBack(T&& value);
   T getFront() const;
   T getBack() const;
   List<T>& insertFront(const T& value);
+  List<T>& insertFront(T&& value);
   void deleteIndex(int index);
+  List<T>& insertAt(int index, const T& value);
+  List<T>& insertAt(int index, T&& value);
   void deleteValue(const T& value);
 
-  // iterating over list the C++ way, using iterator objects
-  // and supporting range based iteration
-  ListIterator<T> begin();
-  ListIterator<T> end();
-  ListIterator<T> cbegin() const;
-  ListIterator<T> cend() const;
+  // constructing new values directly in new list nodes
+  template<class... Args>
+  T& emplaceBack(Args&&... args);
+  template<class... Args>
+  T& emplaceFront(Args&&... args);
+
+  // saving the values of the list to a binary file and loading them back
+  void saveBinary(const string& path) const;
+  void loadBinary(const string& path);
+
+  // access to the allocator the nodes of the list come from
+  const NodeAllocator& getNodeAllocator() const;
+
+  // turning the skip list positional index on and off
+  void setSkipIndex(bool enabled);
+  bool hasSkipIndex() const;
+
+  // removing values in bulk, returning the number of values removed
+  template<class Predicate>
+  int removeIf(Predicate predicate);
+  template<class Range>
+  int removeAll(const Range& range);
+
+  // iterating over list the C++ way, using forward iterator objects
+  // and supporting range based iteration and <algorithm>
+  using value_type = T;
+  using iterator = LListIterator<T>;
+  using const_iterator = LListIterator<const T>;
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+protected:
+  // comparing values of lists, walking through our own values
+  bool equalValues(const List<T>& rhs) const;
+  int compareValues(const List<T>& rhs) const;
+
+  // writing values out to a stream, walking through our own values
+  void writeValues(ListWriter<T>& writer, int first, int count) const;
 
 private:
   /// @brief pointer to the front or first node of the linked list.
@@ -70,6 +124,237 @@ private:
 
   /// @brief pointer to the back or last node of the linked list.
   Node<T>* back;
+
+  /// @brief the allocator that the memory for the nodes of this list
+  ///   comes from, by default a pool carving nodes out of larger slabs
+  NodeAllocator nodeAllocator;
+
+  /// @brief the node that was found by the last positional access of
+  ///   the list, or nullptr if there is no remembered position.  Walks
+  ///   to later indexes start from here instead of from the front.
+  mutable Node<T>* cursor;
+
+  /// @brief the index of the cursor node in the list
+  mutable int cursorIndex;
+
+  /// @brief express lanes over the nodes of the list for finding the
+  ///   node at an index, only kept up to date once enabled
+  SkipIndex<T> skipIndex;
+
+  // private member methods for managing the nodes of the list
+  Node<T>* nodeAt(int index) const;
+  void invalidateCursor();
+  template<class... Args>
+  Node<T>* newNode(Node<T>* next, Args&&... args);
+  void deleteNode(Node<T>* node);
 };
 
+/** @brief Invalidate cursor
+ *
+ * Private helper to forget the remembered position of the last
+ * positional access.  Called by operations that change the list in a
+ * way that could move or remove the node at the cursor.
+ */
+template<class T, class NodeAllocator>
+inline void LList<T, NodeAllocator>::invalidateCursor()
+{
+  cursor = nullptr;
+  cursorIndex = 0;
+}
+
+/** @brief New node
+ *
+ * Private helper to get memory for a new node from the node allocator
+ * of the list, and construct the node in it.  The arguments after the
+ * next pointer are perfectly forwarded to the constructor of T.  If
+ * constructing the value throws, the memory is given back.
+ *
+ * @param next The node the new node should link to.
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns Node<T>* Returns a pointer to the new node.
+ */
+template<class T, class NodeAllocator>
+template<class... Args>
+Node<T>* LList<T, NodeAllocator>::newNode(Node<T>* next, Args&&... args)
+{
+  Node<T>* node = nodeAllocator.allocate();
+  try
+  {
+    new (node) Node<T>(next, forward<Args>(args)...);
+  }
+  catch (...)
+  {
+    nodeAllocator.deallocate(node);
+    throw;
+  }
+
+  return node;
+}
+
+/** @brief Delete node
+ *
+ * Private helper to destroy a node that has been unlinked from the
+ * list, and give its memory back to the node allocator of the list.
+ *
+ * @param node The node to delete.
+ */
+template<class T, class NodeAllocator>
+inline void LList<T, NodeAllocator>::deleteNode(Node<T>* node)
+{
+  node->~Node<T>();
+  nodeAllocator.deallocate(node);
+}
+
+/** @brief Emplace value on back
+ *
+ * Construct a new value in a new node linked onto the end of this
+ * list.  The arguments are perfectly forwarded to the constructor of
+ * T, so the value is constructed directly inside of the Node<T> and
+ * an rvalue argument is moved rather than copied.
+ *
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns T& Returns a reference to the newly constructed value now
+ *   at the back of this list.
+ */
+template<class T, class NodeAllocator>
+template<class... Args>
+T& LList<T, NodeAllocator>::emplaceBack(Args&&... args)
+{
+  Node<T>* node = newNode(nullptr, forward<Args>(args)...);
+
+  // new node becomes the front as well if the list was empty
+  if (this->isEmpty())
+  {
+    front = node;
+  }
+  else
+  {
+    back->next = node;
+  }
+  back = node;
+  this->size++;
+  skipIndex.insert(this->size - 1, node);
+
+  return node->value;
+}
+
+/** @brief Emplace value on front
+ *
+ * Construct a new value in a new node linked onto the beginning of
+ * this list.  This is a constant time O(1) operation for the linked
+ * list.
+ *
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns T& Returns a reference to the newly constructed value now
+ *   at the front of this list.
+ */
+template<class T, class NodeAllocator>
+template<class... Args>
+T& LList<T, NodeAllocator>::emplaceFront(Args&&... args)
+{
+  Node<T>* node = newNode(front, forward<Args>(args)...);
+
+  // new node becomes the back as well if the list was empty
+  if (this->isEmpty())
+  {
+    back = node;
+  }
+  front = node;
+  this->size++;
+  skipIndex.insert(0, node);
+
+  // the remembered node is still in the list, one index further back
+  cursorIndex++;
+
+  return node->value;
+}
+
+/** @brief Remove values matching predicate
+ *
+ * Remove every value of this list for which the predicate returns
+ * true, keeping the remaining values in their original order.  This
+ * is done in a single walk down the list, unlinking and deleting
+ * each matching node as we go, so removing any number of values is
+ * O(n).  Unlike deleteValue() no exception is thrown if nothing is
+ * removed, the count of removed values tells the caller what
+ * happened.  The list is kept consistent after every removal, so it
+ * is still valid if the predicate throws.  If the skip index is enabled
+ * it is updated for each removed node, costing an expected O(log n)
+ * per removed value.
+ *
+ * @param predicate A callable taking a const T& and returning true
+ *   for values that should be removed.
+ *
+ * @returns int Returns the number of values removed from the list.
+ */
+template<class T, class NodeAllocator>
+template<class Predicate>
+int LList<T, NodeAllocator>::removeIf(Predicate predicate)
+{
+  int removed = 0;
+  invalidateCursor();
+
+  // link is the pointer that points to the node we are looking at,
+  // either front or the next pointer of the previous node
+  Node<T>* previous = nullptr;
+  Node<T>** link = &front;
+  int index = 0;
+  while (*link != nullptr)
+  {
+    Node<T>* node = *link;
+    if (predicate(node->value))
+    {
+      // unlink the node, the previous node becomes the back if
+      // we are removing the back node
+      *link = node->next;
+      if (node == back)
+      {
+        back = previous;
+      }
+      deleteNode(node);
+      skipIndex.remove(index);
+      this->size--;
+      removed++;
+    }
+    else
+    {
+      previous = node;
+      link = &node->next;
+      index++;
+    }
+  }
+
+  return removed;
+}
+
+/** @brief Remove all values in range
+ *
+ * Remove every value of this list that is equal to one of the values
+ * in the given range, keeping the remaining values in their original
+ * order.  The range can be any container that supports range based
+ * iteration, such as a vector or an array.  Unlike deleteValue() no
+ * exception is thrown if nothing is removed, the count of removed
+ * values tells the caller what happened.  Each value of the list is
+ * searched for in the range, so this is O(n*m) for a range of m
+ * values.
+ *
+ * @param range The values that should be removed from this list.
+ *
+ * @returns int Returns the number of values removed from the list.
+ */
+template<class T, class NodeAllocator>
+template<class Range>
+int LList<T, NodeAllocator>::removeAll(const Range& range)
+{
+  return removeIf([&range](const T& value) {
+    return find(std::begin(range), std::end(range), value) != std::end(range);
+  });
+}
+
+// template member definitions
+#include "LList.ipp"
+
 #endif // define _LLIST_HPP_
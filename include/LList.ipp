@@ -0,0 +1,1068 @@
+/** @file LList.ipp
+ * @brief Concrete array based implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using a fixed sized array.
+ * This array based implementation will dynamically allocate
+ * a new block of memory once the current allocation becomes
+ * full.  The new block is double in size of the old.  Thus
+ * insertion at the end of the list can be O(1) in most cases,
+ * but will take O(n) copies as well as a memory allocation
+ * if it needs to grow.  Insertion in the middle or front
+ * still requires shifting of items, so it is O(n).
+ *
+ * This file is included at the end of LList.hpp and is not compiled on
+ * its own.
+ */
+#include "LListIterator.hpp"
+#include "ListException.hpp"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/**
+ * @brief Default constructor
+ *
+ * Construct an empty list.  The empty list will have no allocated memory
+ * nor any values.
+ */
+template<class T, class NodeAllocator>
+LList<T, NodeAllocator>::LList()
+{
+  // Empty list has size 0 and both front and back are null
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+  invalidateCursor();
+}
+
+/**
+ * @brief Standard constructor
+ *
+ * Construct a list of integer values from a (statically) defined and
+ * provided array of integers.  We need to dynamically construct
+ * a node for each value in the array and create a linked list of these
+ * nodes.
+ *
+ * @param size The size of the input values were are given as well as the
+ *   size of the new list we are to construct.
+ * @param values The (static) array of string values to use to construct
+ *   this List values with.
+ */
+template<class T, class NodeAllocator>
+LList<T, NodeAllocator>::LList(int size, T values[])
+{
+  // Make sure list is empty before copying values from array.
+  // Empty list has size 0 and both front and back are null
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+  invalidateCursor();
+
+  // iterate through the array reusing member functions to
+  // simply insert new values one-by-one on the back
+  for (int index = 0; index < size; index++)
+  {
+    // uncomment this after implementing insertBack() to enable its
+    // reuse to correctly implement the array based constructor
+    insertBack(values[index]);
+  }
+}
+
+/**
+ * @brief Copy constructor
+ *
+ * Provide a copy constructor for the List class.  A copy constructor
+ * will be invoked whenver you assign one instance of a List to another.
+ * For example
+ *   List newList = existingList;
+ * Where of course existingList was a previously created List.  This copy
+ * constructor, as the name suggests, should make a copy of the values from
+ * the given input list into a new List instance.
+ *
+ * @param list The other List type we are to make a copy of in this
+ *   constructor.
+ */
+template<class T, class NodeAllocator>
+LList<T, NodeAllocator>::LList(const LList<T, NodeAllocator>& list)
+{
+  // Make sure list is empty before copying values from other list.
+  // Empty list has size 0 and both front and back are null
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+  invalidateCursor();
+
+  // the copy is indexed as well if the other list is
+  setSkipIndex(list.hasSkipIndex());
+
+  // if the other list is not empty, then we need to iterate through
+  // its values and insert them into the back of this list
+  if (not list.isEmpty())
+  {
+    Node<T>* current = list.front;
+    while (current != nullptr)
+    {
+      // uncomment this after implementing insertBack() to enable its
+      // reuse to correctly implement the copy constructor
+      insertBack(current->value);
+      current = current->next;
+    }
+  }
+}
+
+/**
+ * @brief Move constructor
+ *
+ * Construct this list by taking over the nodes of the given list,
+ * which is left as an empty list.  No nodes are allocated or
+ * values copied.  The node allocator is moved along with the nodes,
+ * since the nodes live in the memory it manages.
+ *
+ * @param list The other List whose nodes we are to take over.
+ */
+template<class T, class NodeAllocator>
+LList<T, NodeAllocator>::LList(LList<T, NodeAllocator>&& list) noexcept
+  : nodeAllocator(move(list.nodeAllocator)),
+    skipIndex(move(list.skipIndex))
+{
+  // take over the nodes of the other list
+  this->size = list.size;
+  front = list.front;
+  back = list.back;
+
+  invalidateCursor();
+
+  // the other list is now empty and no longer owns the nodes
+  list.size = 0;
+  list.front = nullptr;
+  list.back = nullptr;
+  list.invalidateCursor();
+}
+
+/**
+ * @brief Class destructor
+ *
+ * Destructor for the List class.  A concrete List implementation must
+ * provide a clear() method to clear all items and safely deallocate any
+ * memory that the concrete instance is using.  Invoke the clear
+ * of the concrete subclass to perform the destruction.
+ */
+template<class T, class NodeAllocator>
+LList<T, NodeAllocator>::~LList()
+{
+  // call clear to do actual work to deallocate any allocation
+  // before we destruct
+  this->clear();
+}
+
+/**
+ * @brief Copy assignment operator
+ *
+ * Replace the values of this list with a copy of the values of
+ * the right hand side list.  The copy is made first, so that
+ * this list is left unchanged if the copy fails.
+ *
+ * @param rhs The other List we are to make a copy of.
+ *
+ * @returns LList<T, NodeAllocator>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T, class NodeAllocator>
+LList<T, NodeAllocator>& LList<T, NodeAllocator>::operator=(const LList<T, NodeAllocator>& rhs)
+{
+  if (this != &rhs)
+  {
+    // copy into a temporary then move the copy into this list
+    LList<T, NodeAllocator> copy(rhs);
+    *this = move(copy);
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Move assignment operator
+ *
+ * Release the nodes of this list and take over the nodes of the
+ * right hand side list, which is left as an empty list.
+ *
+ * @param rhs The other List whose nodes we are to take over.
+ *
+ * @returns LList<T, NodeAllocator>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T, class NodeAllocator>
+LList<T, NodeAllocator>& LList<T, NodeAllocator>::operator=(LList<T, NodeAllocator>&& rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    // give back our own nodes before taking over the other list
+    clear();
+
+    this->size = rhs.size;
+    front = rhs.front;
+    back = rhs.back;
+    nodeAllocator = move(rhs.nodeAllocator);
+    skipIndex = move(rhs.skipIndex);
+
+    rhs.size = 0;
+    rhs.front = nullptr;
+    rhs.back = nullptr;
+    rhs.invalidateCursor();
+  }
+
+  return *this;
+}
+
+/** @brief Write values to stream
+ *
+ * Write the given range of values to the output stream, separated by a
+ * comma and a space, walking the nodes from the first value rather
+ * than going through operator[] for each value.
+ *
+ * @param writer The stream or string to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write, at least 1.
+ */
+template<class T, class NodeAllocator>
+void LList<T, NodeAllocator>::writeValues(ListWriter<T>& writer, int first, int count) const
+{
+  // find the first node once, then walk on from it
+  Node<T>* current = nodeAt(first);
+  writer.writeValue(current->value);
+  for (int written = 1; written < count; written++)
+  {
+    current = current->next;
+    writer.writeText(", ");
+    writer.writeValue(current->value);
+  }
+}
+
+/**
+ * @brief Boolean equals operator
+ *
+ * Check if this List is equal to the right hand side (rhs)
+ * list.  The lists are equal if their sizes are equal, and if
+ * all elements in both lists are equal.
+ * The comparison is done by List<T>::equals(), using whichever
+ * list is able to walk through its values fastest.
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this List to.
+ *
+ * @returns bool true if the lists are equal, false if the are not.
+ */
+template<class T, class NodeAllocator>
+bool LList<T, NodeAllocator>::operator==(const List<T>& rhs) const
+{
+  // the list that can walk through its own values does the comparing
+  return this->equals(rhs);
+}
+
+/** @brief Check values for equality
+ *
+ * Check that the values of this list are equal to the values of the
+ * rhs list, which has the same size as this list.  We walk our nodes
+ * while stepping through the rhs list in lockstep.  If the rhs list is
+ * the same kind of linked list its nodes are walked as well, otherwise
+ * it is indexed in order.
+ *
+ * @param rhs The other list of the same size to compare values with.
+ *
+ * @returns bool true if all values of the lists are equal.
+ */
+template<class T, class NodeAllocator>
+bool LList<T, NodeAllocator>::equalValues(const List<T>& rhs) const
+{
+  const LList<T, NodeAllocator>* other = dynamic_cast<const LList<T, NodeAllocator>*>(&rhs);
+  Node<T>* otherCurrent = (other == nullptr) ? nullptr : other->front;
+
+  int index = 0;
+  for (Node<T>* current = front; current != nullptr; current = current->next)
+  {
+    const T& rhsValue = (other == nullptr) ? rhs[index] : otherCurrent->value;
+    if (not(current->value == rhsValue))
+    {
+      return false;
+    }
+
+    index++;
+    if (other != nullptr)
+    {
+      otherCurrent = otherCurrent->next;
+    }
+  }
+
+  return true;
+}
+
+/** @brief Compare values
+ *
+ * Compare the values of this list with the rhs list in lexicographic
+ * order.  Like equalValues(), we walk our nodes and the rhs list in
+ * lockstep.
+ *
+ * @param rhs The other list on the right hand side of the comparison.
+ *
+ * @returns int Returns a negative value, 0 or a positive value if this
+ *   list orders before, the same as or after the rhs list.
+ */
+template<class T, class NodeAllocator>
+int LList<T, NodeAllocator>::compareValues(const List<T>& rhs) const
+{
+  const LList<T, NodeAllocator>* other = dynamic_cast<const LList<T, NodeAllocator>*>(&rhs);
+  Node<T>* otherCurrent = (other == nullptr) ? nullptr : other->front;
+
+  int index = 0;
+  for (Node<T>* current = front; current != nullptr and index < rhs.getSize(); current = current->next)
+  {
+    const T& rhsValue = (other == nullptr) ? rhs[index] : otherCurrent->value;
+    if (current->value < rhsValue)
+    {
+      return -1;
+    }
+    if (rhsValue < current->value)
+    {
+      return 1;
+    }
+
+    index++;
+    if (other != nullptr)
+    {
+      otherCurrent = otherCurrent->next;
+    }
+  }
+
+  // all values compared are equal, so the shorter list comes first
+  return this->size - rhs.getSize();
+}
+
+/**
+ * @brief Indexing operator
+ *
+ * Provide a way to index individual values in our private
+ * linked list of values.  This allows code to, for the
+ * most part, treated an instance of our List as if it were
+ * an array, though we also provide bounds checking to ensure
+ * no illegal access beyond the list bounds is attempted.
+ *
+ * The node found is remembered, so that accessing the list at
+ * increasing indexes, as in a loop over all of the indexes, walks
+ * forward from the last node found instead of from the front, and
+ * the whole loop is O(n) rather than O(n^2).
+ *
+ * @param index The index of the value it is desired to access from
+ *   this List.
+ *
+ * @returns int& Returns a reference to the requested List item at
+ *   the requested index.
+ *
+ * @throws ListMemoryBoundsException if a request for an index beyond
+ *   the end of the array (or less than 0) is made.
+ */
+template<class T, class NodeAllocator>
+T& LList<T, NodeAllocator>::operator[](int index) const
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("LList::operator[]", this->size, index);
+  }
+
+  // otherwise it is safe to return the reference to the value in the
+  // index'th node of the list, but we have to do some work to find it
+  return nodeAt(index)->value;
+}
+
+/**
+ * @brief Clear out list
+ *
+ * Clear or empty out the list.  Return the list back to an empty
+ * list.  Each node is destroyed, then the node allocator gives the
+ * memory of all of the nodes back to the heap at once.  Nodes holding
+ * values that need no destruction don't even have to be visited.
+ */
+template<class T, class NodeAllocator>
+void LList<T, NodeAllocator>::clear()
+{
+  // if the list is not empty, we need to destroy the nodes before their
+  // memory is returned back to the heap
+  if (not is_trivially_destructible<T>::value and not this->isEmpty())
+  {
+    Node<T>* current = front;
+
+    // iterate through the nodes of the list to destroy them
+    while (current != nullptr)
+    {
+      // remember this node to destroy while advancing
+      // to next node for next iteration
+      Node<T>* nodeToDelete = current;
+      current = current->next;
+
+      // now safe to destroy this node
+      nodeToDelete->~Node<T>();
+    }
+  }
+  nodeAllocator.release();
+  skipIndex.clear();
+
+  // make sure size is now 0 and front and back both point to null
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+  invalidateCursor();
+}
+
+/**
+ * @brief Delete back item
+ *
+ * Delete the item from the back of the list.  This is an expensive
+ * O(n) operation for a singly linked list.
+ */
+template<class T, class NodeAllocator>
+void LList<T, NodeAllocator>::deleteBack()
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("LList::deleteBack", this->size);
+  }
+
+  // if current list only has 1 item, then the list will now become
+  // empty
+  if (this->size == 1)
+  {
+    skipIndex.remove(0);
+    deleteNode(front);
+    front = nullptr;
+    back = nullptr;
+    this->size = 0;
+    invalidateCursor();
+  }
+  // otherwise there are at least 2 items in the list and we can
+  // remove the current back item.  problem is, this is not a double
+  // linked list, so we have to search till the item before the back
+  else
+  {
+    // need to search through list and position prev to the node before
+    // the back node, which leaves the cursor on the new back node
+    Node<T>* prev = nodeAt(this->size - 2);
+
+    // now remove the back node, and make prev the new back.
+    skipIndex.remove(this->size - 1);
+    deleteNode(back);
+    prev->next = nullptr;
+    back = prev;
+    this->size -= 1;
+  }
+}
+
+/**
+ * @brief Delete front item
+ *
+ * Delete the item from the front of the list.  For a singly
+ * linked list this operation is much cheaper than deleting
+ * from the back, it is constant time O(1) to remove a front item.
+ */
+template<class T, class NodeAllocator>
+void LList<T, NodeAllocator>::deleteFront()
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("LList::deleteFront", this->size);
+  }
+
+  // remember current front
+  Node<T>* nodeToDelete = front;
+
+  // move to new front
+  front = front->next;
+
+  // delete the node we removed
+  deleteNode(nodeToDelete);
+  skipIndex.remove(0);
+
+  // update list size since we just removed a node
+  this->size -= 1;
+
+  // the remembered node moves one index forward, unless it was removed
+  if (cursor == nodeToDelete)
+  {
+    invalidateCursor();
+  }
+  else
+  {
+    cursorIndex--;
+  }
+
+  // list might now be empty, so make sure to repoint back as well
+  // to nullptr if that is the case
+  if (this->isEmpty())
+  {
+    back = nullptr;
+  }
+}
+
+/**
+ * @brief Begin iterator
+ *
+ * Create and return an iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns iterator returns a new forward iterator that keeps track
+ *   of iterating over the list items.
+ */
+template<class T, class NodeAllocator>
+typename LList<T, NodeAllocator>::iterator LList<T, NodeAllocator>::begin()
+{
+  return iterator(front);
+}
+
+/**
+ * @brief End iterator
+ *
+ * Return an iterator pointing past the back node of this list,
+ * which is used to detect we are at the end of the list when
+ * iteration.
+ *
+ * @returns iterator returns a new forward iterator that points to
+ *   the end of the list.
+ */
+template<class T, class NodeAllocator>
+typename LList<T, NodeAllocator>::iterator LList<T, NodeAllocator>::end()
+{
+  return iterator(nullptr);
+}
+
+/**
+ * @brief Begin iterator of constant list
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T, class NodeAllocator>
+typename LList<T, NodeAllocator>::const_iterator LList<T, NodeAllocator>::begin() const
+{
+  return const_iterator(front);
+}
+
+/**
+ * @brief End iterator of constant list
+ *
+ * Return a const iterator pointing past the back node of this list,
+ * used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T, class NodeAllocator>
+typename LList<T, NodeAllocator>::const_iterator LList<T, NodeAllocator>::end() const
+{
+  return const_iterator(nullptr);
+}
+
+/**
+ * @brief Constant begin iterator
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T, class NodeAllocator>
+typename LList<T, NodeAllocator>::const_iterator LList<T, NodeAllocator>::cbegin() const
+{
+  return const_iterator(front);
+}
+
+/**
+ * @brief Constant end iterator
+ *
+ * Return a const iterator pointing past the back node of this list,
+ * which is used to detect we are at the end of the list when
+ * iteration.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T, class NodeAllocator>
+typename LList<T, NodeAllocator>::const_iterator LList<T, NodeAllocator>::cend() const
+{
+  return const_iterator(nullptr);
+}
+
+/**
+ * @brief Back Insertion method
+ * 
+ * Method used to insert a value at the end of a 
+ * given linked list
+ * 
+ * @param The new value to be added to the end of a linked list
+ * 
+ * @returns List<T>& returns a reference to the linked list
+ * being operated on
+ * 
+ */
+template<class T, class NodeAllocator>
+List<T>& LList<T, NodeAllocator>::insertBack(const T& newValue)
+{
+  emplaceBack(newValue);
+  return *this;
+}
+
+/**
+ * @brief Back Insertion method for moved values
+ *
+ * Method used to insert a value at the end of a given linked list,
+ * moving the value into the new node instead of copying it.
+ *
+ * @param newValue The new value to be moved to the end of the linked list
+ *
+ * @returns List<T>& returns a reference to the linked list
+ * being operated on
+ */
+template<class T, class NodeAllocator>
+List<T>& LList<T, NodeAllocator>::insertBack(T&& newValue)
+{
+  emplaceBack(move(newValue));
+  return *this;
+}
+
+/**
+ * @brief Back Insertion Operator 
+ * 
+ * Provide a way to directly add a value to the end of 
+ * a given linked list. 
+ * 
+ * @param newValue
+ * 
+ * The new value to be added to the linked list
+ * 
+ * @returns List<T>& returns a reference to the linked list
+ * being operated on
+ * 
+ */
+template<class T, class NodeAllocator>
+List<T>& LList<T, NodeAllocator>::operator>>(const T& newValue)
+{
+  return insertBack(newValue);
+}
+
+/** @brief Access front of linked list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the front of this given linked list.
+ *
+ * @returns T Returns a copy of the front value of the
+ *   linked list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access front value of an empty linked list, this exception
+ *   is created and thrown instead.
+ */
+template<class T, class NodeAllocator>
+T LList<T, NodeAllocator>::getFront() const
+{
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("LList::getFront", this->size);
+  }
+
+  return front->value;
+}
+
+/** @brief Access back of linked list
+ *
+ * Accessor method to get a copy of the value currently
+ * at the back of this linked list.
+ *
+ * @returns T Returns a copy of the back item of the
+ *   linked list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access back value of an empty linked list, this exception
+ *   is created and thrown instead.
+ */
+template<class T, class NodeAllocator>
+T LList<T, NodeAllocator>::getBack() const
+{
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("LList::getBack", this->size);
+  }
+
+  return back->value;
+}
+
+/** @brief Insert value on front
+ *
+ * Prepend the indicated value to the beginning of this Linked List
+ * of values.  This method will grow the linked list allocation if
+ * needed to accomodate prepending the new value.  This method
+ * returns a reference to this instance, so that the result can
+ * be used in chained expressions of Linked List types.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this Linked List instance, so that
+ *   the result can be used in further Linekd List operator expressions.
+ */
+template<class T, class NodeAllocator>
+List<T>& LList<T, NodeAllocator>::insertFront(const T& newValue)
+{
+  emplaceFront(newValue);
+  return *this;
+}
+
+/** @brief Insert moved value on front
+ *
+ * Prepend the indicated value to the beginning of this Linked List
+ * of values, moving the value into the new node instead of copying it.
+ *
+ * @param newValue The value to move to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this Linked List instance, so that
+ *   the result can be used in further Linked List operator expressions.
+ */
+template<class T, class NodeAllocator>
+List<T>& LList<T, NodeAllocator>::insertFront(T&& newValue)
+{
+  emplaceFront(move(newValue));
+  return *this;
+}
+
+/** @brief Overload operator<< to prepend
+ *
+ * Overload the operator<< to perform prepend operation.  Implementation
+ * is actually done by the insertFront() member function.
+ *
+ * @param value The value to prepend to the beginning of the current linked list.
+ *
+ * @returns List<T>& Returns a reference to this Linked List instance, so that
+ *   the result can be used in further Linked List operator expressions.
+ */
+template<class T, class NodeAllocator>
+List<T>& LList<T, NodeAllocator>::operator<<(const T& newValue)
+{
+  return insertFront(newValue);
+}
+
+/** @brief Delete value at index
+ *
+ * Delete the value from the indicated index in this linked
+ * list.
+ *
+ * @param index The index of the value in the linked list to be removed.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the array or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T, class NodeAllocator>
+void LList<T, NodeAllocator>::deleteIndex(int position)
+{
+  if (position < 0 || position >= this->size)
+  {
+    throw ListMemoryBoundsException("LList::deleteIndex", this->size, position);
+  }
+  if (position == 0)
+  {
+    deleteFront();
+  }
+  else if (position == this -> getSize() - 1)
+  {
+    deleteBack();
+  }
+  else
+  {
+    // find the node before the position, the cursor is left on it so
+    // it is still valid after the following node is removed
+    Node<T> *temp = nodeAt(position - 1);
+    Node<T> *newAddress = temp->next->next;
+    Node<T> *deleteTemp = temp->next;
+    temp->next = newAddress;
+    deleteNode(deleteTemp);
+    skipIndex.remove(position);
+    this->size--;
+  }
+}
+
+/** @brief Delete value(s)
+ *
+ * Delete the value from the linked list.  This method will delete all
+ * instances of the value from this linked list that it finds.  If the linked list
+ * does not conatin the value, then an exception is thrown.  All of
+ * the values are removed in a single O(n) walk using removeIf().
+ *
+ * @param value The value to deleted from this linked list.
+ *
+ * @throws ListValueNotFoundException If we are asked to delete a value
+ *   that does not exist, we thrown an exception instead of completely
+ *   ignoring this condition.
+ */
+template<class T, class NodeAllocator>
+void LList<T, NodeAllocator>::deleteValue(const T& value)
+{
+  // remove every instance of the value in one walk down the list
+  int removed = removeIf([&value](const T& listValue) {
+    return listValue == value;
+  });
+
+  if (removed == 0)
+  {
+    throw ListValueNotFoundException("LList::deleteValue", value);
+  }
+}
+
+/** @brief Insert value at index
+ *
+ * Insert the indicated value into this linked list so that it ends up
+ * at the given index.  Inserting at the front or back is O(1), otherwise
+ * we have to walk to the node before the index, so this is O(n).
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to insert into the list.
+ *
+ * @returns List<T>& Returns a reference to this Linked List instance, so
+ *   that the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T, class NodeAllocator>
+List<T>& LList<T, NodeAllocator>::insertAt(int index, const T& value)
+{
+  return insertAt(index, T(value));
+}
+
+/** @brief Insert moved value at index
+ *
+ * Insert the indicated value into this linked list at the given
+ * index, moving the value into the new node instead of copying it.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to move into the list.
+ *
+ * @returns List<T>& Returns a reference to this Linked List instance, so
+ *   that the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T, class NodeAllocator>
+List<T>& LList<T, NodeAllocator>::insertAt(int index, T&& value)
+{
+  // the index can be 1 past the back, which appends the value
+  if ((index < 0) or (index > this->size))
+  {
+    throw ListMemoryBoundsException("LList::insertAt", this->size, index);
+  }
+
+  if (index == 0)
+  {
+    emplaceFront(move(value));
+  }
+  else if (index == this->size)
+  {
+    emplaceBack(move(value));
+  }
+  else
+  {
+    // walk to the node before the index and link the new node after it,
+    // the cursor is left on the node before so it stays valid
+    Node<T>* prev = nodeAt(index - 1);
+    prev->next = newNode(prev->next, move(value));
+    this->size++;
+    skipIndex.insert(index, prev->next);
+  }
+
+  return *this;
+}
+
+/** @brief Find node at index
+ *
+ * Private helper to find the node holding the value at the given
+ * index.  If the remembered cursor is at or before the index we walk
+ * forward from the cursor, otherwise we have to start from the front.
+ * When the index is further away than a short walk and the skip index
+ * is enabled, the express lanes get us to a node just before the index
+ * instead.  The back node is always found directly.  The node found becomes the
+ * new cursor.  Since the cursor is updated by const accessors, a list
+ * must not be accessed by index from several threads at once.
+ *
+ * @param index The index of the node to find, must be a valid index
+ *   of this list.
+ *
+ * @returns Node<T>* Returns a pointer to the node at the index.
+ */
+template<class T, class NodeAllocator>
+Node<T>* LList<T, NodeAllocator>::nodeAt(int index) const
+{
+  Node<T>* current;
+  if (index == this->size - 1)
+  {
+    current = back;
+  }
+  else
+  {
+    // start from the cursor if it is not past the index
+    int currentIdx = 0;
+    current = front;
+    if (cursor != nullptr and cursorIndex <= index)
+    {
+      currentIdx = cursorIndex;
+      current = cursor;
+    }
+
+    // search the express lanes for a node closer to the index
+    if (index - currentIdx > SkipIndex<T>::SHORT_WALK)
+    {
+      int laneIdx;
+      Node<T>* laneNode = skipIndex.find(index, laneIdx);
+      if (laneNode != nullptr and laneIdx > currentIdx)
+      {
+        currentIdx = laneIdx;
+        current = laneNode;
+      }
+    }
+
+    // advance to next node until we reach the index'th node of
+    // this list
+    for (; currentIdx < index; currentIdx++)
+    {
+      current = current->next;
+    }
+  }
+
+  // remember where we are for the next access
+  cursor = current;
+  cursorIndex = index;
+  return current;
+}
+
+/** @brief Save list to binary file
+ *
+ * Save the values of this list to a list file, replacing any file
+ * already at the path.  The file is the same as the one saved by an
+ * AList of the same values, so either kind of list can load it.
+ *
+ * @param path The path of the file to save the list to.
+ *
+ * @throws ListFileException If the file can not be written.
+ */
+template<class T, class NodeAllocator>
+void LList<T, NodeAllocator>::saveBinary(const string& path) const
+{
+  ListBinaryWriter<T> writer("LList::saveBinary", path);
+  writer.write(cbegin(), this->size);
+}
+
+/** @brief Load list from binary file
+ *
+ * Replace the values of this list with the values of a list file
+ * saved by saveBinary() of any kind of list holding the same type of
+ * value.  The node allocator is asked to reserve room for all of the
+ * nodes up front, so the default NodePool gets them all from a single
+ * slab, and the values are then moved into new nodes in order.  A
+ * file that is refused leaves the list unchanged, and if reading the
+ * values fails part way the list is left empty.
+ *
+ * @param path The path of the file to load the list from.
+ *
+ * @throws ListFileException If the file can not be read, or does not
+ *   hold a list of values of type T.
+ */
+template<class T, class NodeAllocator>
+void LList<T, NodeAllocator>::loadBinary(const string& path)
+{
+  ListBinaryReader<T> reader("LList::loadBinary", path);
+  clear();
+  nodeAllocator.reserve(reader.getCount());
+
+  try
+  {
+    reader.readValues([this](T&& value) { emplaceBack(move(value)); });
+  }
+  catch (...)
+  {
+    clear();
+    throw;
+  }
+}
+
+/** @brief Node allocator accessor
+ *
+ * Accessor method to get the allocator that the memory for the nodes
+ * of this list comes from.
+ *
+ * @returns const NodeAllocator& Returns a reference to the node
+ *   allocator of the list.
+ */
+template<class T, class NodeAllocator>
+const NodeAllocator& LList<T, NodeAllocator>::getNodeAllocator() const
+{
+  return nodeAllocator;
+}
+
+/** @brief Set skip index
+ *
+ * Turn the skip list positional index of this list on or off.  Turning
+ * it on builds the express lanes over the current nodes, which is
+ * O(n).  From then on operator[], deleteIndex(), insertAt() and
+ * deleteBack() find their node in expected O(log n), while inserting
+ * and deleting at the front stays O(1) in the expected case.  The cost
+ * is one lane entry for every three nodes on average, and a little
+ * work to keep the index up to date on every insertion and deletion.
+ *
+ * @param enabled true to turn the index on, false to turn it off and
+ *   give back its memory.
+ */
+template<class T, class NodeAllocator>
+void LList<T, NodeAllocator>::setSkipIndex(bool enabled)
+{
+  if (enabled == skipIndex.isEnabled())
+  {
+    return;
+  }
+
+  if (enabled)
+  {
+    skipIndex.enable(front);
+  }
+  else
+  {
+    skipIndex.disable();
+  }
+}
+
+/** @brief Skip index accessor
+ *
+ * @returns bool Returns true if the skip list positional index of this
+ *   list is enabled.
+ */
+template<class T, class NodeAllocator>
+bool LList<T, NodeAllocator>::hasSkipIndex() const
+{
+  return skipIndex.isEnabled();
+}
@@ -1,5 +1,5 @@
 /** @file LListIterator.hpp
- * @brief Concrete Iterator for AList<T> list types.
+ * @brief Concrete Iterator for LList<T> list types.
  *
  * @author Derek Harter
  * @note   class: COSC 2336, Summer 2021
@@ -8,40 +8,179 @@
  * @date   June 1, 2021
  *
  * Definition of concrete LListIterator to iterate over
- * AList<T> instances.
+ * LList<T> instances.  A singly linked list can only be walked
+ * forward, so this is a forward iterator holding a pointer to the
+ * current node.  All of the members are defined here in the header, so
+ * that the compiler can inline them into the loops that use them.
  */
 #ifndef _LLIST_ITERATOR_HPP_
 #define _LLIST_ITERATOR_HPP_
-#include "LList.hpp"
-#include "ListIterator.hpp"
 #include "Node.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 using namespace std;
 
 /** @class LListIterator
- * @brief The ListIterator interface
+ * @brief The forward iterator for linked lists
  *
- * The defined ADT interface for a ListIterator objects.
- * These allow us to iterate over List<T> objects in the
- * standard and expected way for C++ template classes.
+ * Iterate over the values of an LList<T>.  An LListIterator<T> gives
+ * access to modify the values, an LListIterator<const T> is the
+ * const_iterator of the list and only gives read access.  These are
+ * standard iterators, so they work with range based iteration as well
+ * as with the <algorithm> library.
  */
 template<class T>
-class LListIterator : public ListIterator<T>
+class LListIterator
 {
 public:
+  // standard iterator traits
+  using iterator_category = forward_iterator_tag;
+  using value_type = remove_const_t<T>;
+  using difference_type = ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
   // constructors
   LListIterator();
-  LListIterator(Node<T>* ptr);
+  explicit LListIterator(Node<value_type>* ptr);
+  template<class U, class = enable_if_t<is_same<const U, T>::value>>
+  LListIterator(const LListIterator<U>& other);
+
+  // accessing the current value
+  reference operator*() const;
+  pointer operator->() const;
 
-  // overloaded operators
-  T operator*();
-  ListIterator<T>& operator++();
-  bool operator==(const LListIterator<T>& rhs) const;
-  bool operator!=(const LListIterator<T>& rhs) const;
+  // moving the iterator
+  LListIterator<T>& operator++();
+  LListIterator<T> operator++(int);
+
+  // comparing iterators, mutable and const iterators can be mixed
+  template<class U>
+  bool operator==(const LListIterator<U>& rhs) const;
+  template<class U>
+  bool operator!=(const LListIterator<U>& rhs) const;
 
 private:
   /// @brief pointer to the current node of the current
   ///   iteration of the list
-  Node<T>* current;
+  Node<value_type>* current;
+
+  // the const iterator is built from and compared to the mutable one
+  template<class U>
+  friend class LListIterator;
 };
 
+/** @brief Default constructor
+ *
+ * Default constructor, iterator will not be iterating over
+ * anything if constructed using the default constructor.
+ */
+template<class T>
+inline LListIterator<T>::LListIterator()
+  : current(nullptr)
+{
+}
+
+/** @brief Standard constructor
+ *
+ * Standard constructor, we are given a pointer to the node
+ * we are to begin iteration with.
+ *
+ * @param ptr A pointer to the Node<T> item at start of
+ *   this iteration of the linked list LList<T> instance, or
+ *   nullptr for the end of the list.
+ */
+template<class T>
+inline LListIterator<T>::LListIterator(Node<value_type>* ptr)
+  : current(ptr)
+{
+}
+
+/** @brief Converting constructor
+ *
+ * A mutable iterator can be turned into a const iterator to the same
+ * node, but not the other way around.
+ *
+ * @param other The mutable iterator to convert.
+ */
+template<class T>
+template<class U, class>
+inline LListIterator<T>::LListIterator(const LListIterator<U>& other)
+  : current(other.current)
+{
+}
+
+/** @brief Overload dereference operator
+ *
+ * @returns reference Returns a reference to the value of the current
+ *   node, so that values are neither copied nor are they copies when
+ *   modified.
+ */
+template<class T>
+inline typename LListIterator<T>::reference LListIterator<T>::operator*() const
+{
+  return current->value;
+}
+
+/** @brief Overload member access operator
+ *
+ * @returns pointer Returns a pointer to the value of the current node.
+ */
+template<class T>
+inline typename LListIterator<T>::pointer LListIterator<T>::operator->() const
+{
+  return &current->value;
+}
+
+/** @brief Overload pre increment operator
+ *
+ * @returns LListIterator<T>& Returns ourself, moved to the next node.
+ */
+template<class T>
+inline LListIterator<T>& LListIterator<T>::operator++()
+{
+  current = current->next;
+  return *this;
+}
+
+/** @brief Overload post increment operator
+ *
+ * @returns LListIterator<T> Returns a copy of ourself from before we
+ *   were moved to the next node.
+ */
+template<class T>
+inline LListIterator<T> LListIterator<T>::operator++(int)
+{
+  LListIterator<T> before(*this);
+  current = current->next;
+  return before;
+}
+
+/** @brief Overload boolean equality operator
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if both iterators point to the same node.
+ */
+template<class T>
+template<class U>
+inline bool LListIterator<T>::operator==(const LListIterator<U>& rhs) const
+{
+  return current == rhs.current;
+}
+
+/** @brief Overload boolean not equal operator
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators point to different nodes.
+ */
+template<class T>
+template<class U>
+inline bool LListIterator<T>::operator!=(const LListIterator<U>& rhs) const
+{
+  return current != rhs.current;
+}
+
 #endif // define _LLIST_ITERATOR_HPP_
@@ -15,7 +15,7 @@
  */
 #ifndef _LIST_HPP_
 #define _LIST_HPP_
-#include "ListIterator.hpp"
+#include "ListWriter.hpp"
 #include <iostream>
 using namespace std;
 
@@ -36,35 +36,93 @@ public:
   bool isEmpty() const;
   virtual T getFront() const = 0;
   virtual T getBack() const = 0;
-  virtual string str() const = 0;
+  virtual string str() const;
+  void writeTo(ostream& out) const;
+  void writeTo(ostream& out, int first, int count) const;
   virtual bool operator==(const List<T>& rhs) const = 0;
+  bool equals(const List<T>& rhs) const;
+  int compare(const List<T>& rhs) const;
+  bool operator<(const List<T>& rhs) const;
   virtual T& operator[](int index) const = 0;
 
   // adding, accessing and removing values from the list
   virtual void clear() = 0;
   virtual List<T>& insertBack(const T& value) = 0;
+  virtual List<T>& insertBack(T&& value) = 0;
   virtual List<T>& operator>>(const T& value) = 0;
   virtual void deleteBack() = 0;
   virtual List<T>& insertFront(const T& value) = 0;
+  virtual List<T>& insertFront(T&& value) = 0;
   virtual List<T>& operator<<(const T& value) = 0;
   virtual void deleteFront() = 0;
   virtual void deleteValue(const T& value) = 0;
   virtual void deleteIndex(int index) = 0;
+  virtual List<T>& insertAt(int index, const T& value) = 0;
+  virtual List<T>& insertAt(int index, T&& value) = 0;
 
-  // iterating over list the C++ way, using iterator objects
-  virtual ListIterator<T> begin() = 0;
-  virtual ListIterator<T> end() = 0;
-  virtual ListIterator<T> cbegin() const = 0;
-  virtual ListIterator<T> cend() const = 0;
+  // iterating over list the C++ way is up to each concrete list, which
+  // provides begin() and end() returning its own standard iterator and
+  // const_iterator types by value, rather than through a virtual base
 
   // friend functions and friend operators
   template<typename U>
   friend ostream& operator<<(ostream& out, const List<U>& rhs);
 
 protected: // private to the class hierarchy, only child classes can access
+  // comparing values of lists, concrete lists can provide faster
+  // algorithms that make use of how they store their values
+  virtual bool hasFastIndexing() const;
+  virtual const T* contiguousValues() const;
+  virtual bool equalValues(const List<T>& rhs) const;
+  virtual int compareValues(const List<T>& rhs) const;
+
+  // writing values out to a stream, concrete lists can walk their own
+  // storage instead of indexing each value
+  virtual void writeValues(ListWriter<T>& writer, int first, int count) const;
+
   /// @brief the current size of the list of integer values, this is
   ///   protected so derived classes can access it
   int size;
+
+private:
+  // building the representation of the list
+  string formatString(true_type fast) const;
+  string formatString(false_type fast) const;
+  void writeList(ListWriter<T>& writer) const;
 };
 
+/**
+ * @brief Size accessor
+ *
+ * Accessor method to get the current size of this List of integers.
+ * Defined here in the header so that it can be inlined.
+ *
+ * @returns int Returns the current size of the list of integers.
+ */
+template<class T>
+inline int List<T>::getSize() const
+{
+  return size;
+}
+
+/**
+ * @brief Check if empty list
+ *
+ * Accessor method to test if the list is currently
+ * empty or not.
+ *
+ * @returns bool Returns true if the list is currently
+ *   empty, or false if it has 1 or more items.
+ */
+template<class T>
+inline bool List<T>::isEmpty() const
+{
+  // can simply test size, if it is equal to 0, then it is true the
+  // list is empty, if it is not equal, then the answer is false
+  return size == 0;
+}
+
+// template member definitions
+#include "List.ipp"
+
 #endif // define _LIST_HPP_
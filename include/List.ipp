@@ -0,0 +1,428 @@
+/** @file List.ipp
+ * @brief Abstract base class definition of List abstract data type.
+ *   This implementation file implements any concrete methods,
+ *   including friend operators, that may be able to be defined
+ *   from the base class.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Overloading and Templates
+ * @date   June 1, 2021
+ *
+ * Implementation of List base class concrete member
+ * functions and friend functions.
+ *
+ * This file is included at the end of List.hpp and is not compiled on
+ * its own.
+ */
+#include "ListException.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/**
+ * @brief Check lists for equality
+ *
+ * Check if this List is equal to the right hand side (rhs) list.  The
+ * lists are equal if their sizes are equal, and if all elements in
+ * both lists are equal.  Concrete lists implement their operator==
+ * with this method.  Like compare(), the check is done by whichever
+ * list can walk its own values while indexing the other in O(n).
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this List to.
+ *
+ * @returns bool true if the lists are equal, false if the are not.
+ */
+template<class T>
+bool List<T>::equals(const List<T>& rhs) const
+{
+  // first the lists have to be of the same size, or else they
+  // cannot be equal
+  if (size != rhs.size)
+  {
+    return false;
+  }
+
+  if (hasFastIndexing() and not rhs.hasFastIndexing())
+  {
+    return rhs.equalValues(*this);
+  }
+
+  return equalValues(rhs);
+}
+
+/**
+ * @brief Compare lists
+ *
+ * Compare the values of this list with the right hand side (rhs) list
+ * in lexicographic order, the same way that two strings are ordered.
+ * The first pair of values that differ decide the order, and if one
+ * list runs out of values first, the shorter list comes first.
+ *
+ * Concrete lists override compareValues() to compare in the way best
+ * suited to how they store their values.  The comparison is always
+ * done by the list that is able to walk through its own values while
+ * indexing the other list.  If only the rhs list is slow to index,
+ * as for a doubly linked list, the comparison is turned around so
+ * that it is the one walking its own values, and the comparison
+ * never becomes O(n^2).
+ *
+ * @param rhs The other list on the right hand side of the comparison.
+ *
+ * @returns int Returns a negative value if this list orders before the
+ *   rhs list, 0 if they hold equal values, and a positive value if
+ *   this list orders after the rhs list.
+ */
+template<class T>
+int List<T>::compare(const List<T>& rhs) const
+{
+  if (hasFastIndexing() and not rhs.hasFastIndexing())
+  {
+    return -rhs.compareValues(*this);
+  }
+
+  return compareValues(rhs);
+}
+
+/**
+ * @brief Boolean less than operator
+ *
+ * Check if this List orders before the right hand side (rhs) list, in
+ * the lexicographic order of their values.
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this List to.
+ *
+ * @returns bool true if this list orders before the rhs list.
+ */
+template<class T>
+bool List<T>::operator<(const List<T>& rhs) const
+{
+  return compare(rhs) < 0;
+}
+
+/**
+ * @brief Fast indexing test
+ *
+ * Test if the values of this list can be accessed in index order for
+ * O(1) each.  Array based lists can simply index into their block of
+ * values, lists that can not should override this to return false.
+ *
+ * @returns bool Returns true if indexing this list in order is fast.
+ */
+template<class T>
+bool List<T>::hasFastIndexing() const
+{
+  return true;
+}
+
+/**
+ * @brief Contiguous values
+ *
+ * Find the block of memory holding the values of this list, if the
+ * values are all stored one after another in index order, as they are
+ * for an array based list or a view of one.  Lists that store their
+ * values any other way keep this default.
+ *
+ * @returns const T* Returns a pointer to the first of the size values
+ *   of the list, or nullptr if the values are not contiguous or the
+ *   list is empty.
+ */
+template<class T>
+const T* List<T>::contiguousValues() const
+{
+  return nullptr;
+}
+
+/**
+ * @brief Check values of lists for equality
+ *
+ * Check that the values of this list are equal to the values of the
+ * rhs list, which has the same size as this list.  If the values of
+ * both lists are contiguous, whichever kinds of list they are, the two
+ * blocks of values are compared directly, with a single memcmp() when
+ * values that are equal are always the same bytes in memory.
+ * Otherwise both lists are indexed in lockstep, walking our own block
+ * of values if we have one, which is O(n) as long as both lists have
+ * fast indexing.
+ *
+ * @param rhs The other list of the same size to compare values with.
+ *
+ * @returns bool true if all values of the lists are equal.
+ */
+template<class T>
+bool List<T>::equalValues(const List<T>& rhs) const
+{
+  const T* values = contiguousValues();
+  const T* rhsValues = rhs.contiguousValues();
+  if (values != nullptr and rhsValues != nullptr)
+  {
+    if constexpr (has_unique_object_representations<T>::value)
+    {
+      return memcmp(values, rhsValues, sizeof(T) * size) == 0;
+    }
+    else
+    {
+      return equal(values, values + size, rhsValues);
+    }
+  }
+
+  for (int index = 0; index < size; index++)
+  {
+    const T& value = (values != nullptr) ? values[index] : (*this)[index];
+    if (not(value == rhs[index]))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Compare values of lists
+ *
+ * Compare the values of this list with the rhs list in lexicographic
+ * order.  If the values of both lists are contiguous, both blocks of
+ * values are searched for the first pair that differ.  Otherwise both
+ * lists are indexed in lockstep, walking our own block of values if we
+ * have one, which is O(n) as long as both lists have fast indexing.
+ *
+ * @param rhs The other list on the right hand side of the comparison.
+ *
+ * @returns int Returns a negative value, 0 or a positive value if this
+ *   list orders before, the same as or after the rhs list.
+ */
+template<class T>
+int List<T>::compareValues(const List<T>& rhs) const
+{
+  int count = min(size, rhs.size);
+  const T* values = contiguousValues();
+  const T* rhsValues = rhs.contiguousValues();
+  if (values != nullptr and rhsValues != nullptr)
+  {
+    pair<const T*, const T*> difference = mismatch(values, values + count, rhsValues);
+    if (difference.first != values + count)
+    {
+      return (*difference.first < *difference.second) ? -1 : 1;
+    }
+  }
+  else
+  {
+    for (int index = 0; index < count; index++)
+    {
+      const T& value = (values != nullptr) ? values[index] : (*this)[index];
+      const T& rhsValue = rhs[index];
+      if (value < rhsValue)
+      {
+        return -1;
+      }
+      if (rhsValue < value)
+      {
+        return 1;
+      }
+    }
+  }
+
+  // all values compared are equal, so the shorter list comes first
+  return size - rhs.size;
+}
+
+/**
+ * @brief List to string
+ *
+ * Accessor method to construct and return a string representation
+ * of the current values and status of this List instance.  The
+ * representation is the one written by writeTo(), so to output a large
+ * list it is better to write it to the stream directly.
+ *
+ * @returns string Returns the string constructed with the information
+ *   about this List.
+ */
+template<class T>
+string List<T>::str() const
+{
+  return formatString(IsFastFormatted<T>());
+}
+
+/**
+ * @brief Format list as string
+ *
+ * Build the string representation of a list of plain integers.  Room
+ * for the whole string is reserved up front, estimated from the number
+ * of digits of the front and back values, and the values are then
+ * formatted with to_chars straight into the string.  The text is the
+ * same as writing the list to an ostream.
+ *
+ * @param fast Tag saying that the values are fast formatted.
+ *
+ * @returns string Returns the string representation of the list.
+ */
+template<class T>
+string List<T>::formatString(true_type) const
+{
+  // "<list> size: " and " [ " and "]" around the values
+  int length = 17 + ListWriter<int>::digitCount(size);
+  if (size > 0)
+  {
+    int digits = max(ListWriter<T>::digitCount(getFront()), ListWriter<T>::digitCount(getBack()));
+    length += size * (digits + 2);
+  }
+
+  string text;
+  text.reserve(length);
+  ListWriter<T> writer(text);
+  writeList(writer);
+
+  return text;
+}
+
+/**
+ * @brief Format list as string
+ *
+ * Build the string representation of a list of any other type of
+ * value, formatting the values with a string stream.
+ *
+ * @param fast Tag saying that the values are not fast formatted.
+ *
+ * @returns string Returns the string representation of the list.
+ */
+template<class T>
+string List<T>::formatString(false_type) const
+{
+  ostringstream out;
+  writeTo(out);
+
+  // convert the string stream into a concrete string to return
+  return out.str();
+}
+
+/**
+ * @brief Write list to stream
+ *
+ * Write the representation of this list to the output stream, one
+ * value at a time, so that no copy of the whole representation is
+ * ever built in memory.
+ *
+ * @param out The output stream to write the representation of the
+ *   list to.
+ */
+template<class T>
+void List<T>::writeTo(ostream& out) const
+{
+  ListWriter<T> writer(out);
+  writeList(writer);
+}
+
+/**
+ * @brief Write list
+ *
+ * Write the whole representation of this list, its size and then all
+ * of its values, to the writer.
+ *
+ * @param writer The stream or string to write the list to.
+ */
+template<class T>
+void List<T>::writeList(ListWriter<T>& writer) const
+{
+  // write list information to the writer
+  writer.writeText("<list> size: ");
+  writer.writeSize(size);
+  writer.writeText(" [ ");
+
+  // write the current values of the list, the last one is only
+  // followed by a space
+  if (size > 0)
+  {
+    writeValues(writer, 0, size);
+    writer.writeText(" ");
+  }
+  writer.writeText("]");
+}
+
+/**
+ * @brief Write range of list to stream
+ *
+ * Write count values of this list, starting with the value at index
+ * first, to the output stream, separated by a comma and a space.  A
+ * large list can be written out a page at a time this way.
+ *
+ * @param out The output stream to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write.
+ *
+ * @throws ListMemoryBoundsException If the range of values does not
+ *   lie within the list.
+ */
+template<class T>
+void List<T>::writeTo(ostream& out, int first, int count) const
+{
+  if ((first < 0) or (count < 0) or (first > size - count))
+  {
+    throw ListMemoryBoundsException("List::writeTo", size, (first < 0 or count < 0) ? first : first + count - 1);
+  }
+
+  if (count > 0)
+  {
+    ListWriter<T> writer(out);
+    writeValues(writer, first, count);
+  }
+}
+
+/**
+ * @brief Write values to stream
+ *
+ * Write the given range of values, which is known to lie within the
+ * list and to not be empty, to the output stream separated by a comma
+ * and a space.  This general version indexes each value, lists that
+ * can not index in O(1) should override it to walk their own values.
+ *
+ * @param writer The stream or string to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write, at least 1.
+ */
+template<class T>
+void List<T>::writeValues(ListWriter<T>& writer, int first, int count) const
+{
+  writer.writeValue((*this)[first]);
+  for (int index = first + 1; index < first + count; index++)
+  {
+    writer.writeText(", ");
+    writer.writeValue((*this)[index]);
+  }
+}
+
+/**
+ * @brief Overload output stream operator for List type.
+ *
+ * Overload the output stream operator so that we can display current
+ * values of a List on standard output.  We can define this in the
+ * base class because the list is written by writeTo(), which streams
+ * the values straight to the output stream without first building
+ * the whole representation as a string.
+ *
+ * @param out The output stream we should send the representation
+ *   of the current List to.
+ * @param rhs The List object to create and return a string
+ *   representation of on the output stream.
+ *
+ * @returns ostream& Returns a reference to the originaly provided
+ *   output stream, but after we  have inserted current List
+ *   values / representation onto the stream
+ */
+template<typename U>
+ostream& operator<<(ostream& out, const List<U>& rhs)
+{
+  // stream the list representation straight to the output stream
+  rhs.writeTo(out);
+
+  // return the modified output stream as our result
+  return out;
+}
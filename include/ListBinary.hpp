@@ -0,0 +1,574 @@
+/** @file ListBinary.hpp
+ * @brief Binary file format that lists save their values to and load
+ *   them back from.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * A list file starts with a fixed size header giving the version of the
+ * format, how the values are laid out, and how many there are.  Values
+ * of trivially copyable types are stored as their raw bytes, one value
+ * right after the other, so the values of an array based list are
+ * written and read back as a single block.  Strings are stored as a
+ * table of the offset each string ends at, followed by all of their
+ * characters in one blob.  Values are stored in the byte order of the
+ * machine that saved them, and the header records that byte order so a
+ * file from a machine with a different one is refused rather than read
+ * as garbage.  All of the members are defined here in the header, the
+ * same as those of the ListWriter.
+ */
+#ifndef _LIST_BINARY_HPP_
+#define _LIST_BINARY_HPP_
+#include "ListException.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/** @class ListBinaryHeader
+ * @brief The header at the start of every list file.
+ */
+struct ListBinaryHeader
+{
+  /// @brief the bytes "LIST", marking the file as a list file
+  char magic[4];
+
+  /// @brief the number 0x01020304 in the byte order of the machine
+  ///   that saved the file
+  uint32_t byteOrder;
+
+  /// @brief the version of the format the file was saved in
+  uint32_t version;
+
+  /// @brief how the values are laid out in the file
+  uint32_t layout;
+
+  /// @brief the size in bytes of one value, or of one character for
+  ///   strings
+  uint32_t valueSize;
+
+  /// @brief unused, always 0
+  uint32_t unused;
+
+  /// @brief the number of values in the file
+  uint64_t count;
+
+  /// @brief the number of bytes of values, or of characters in the
+  ///   blob for strings
+  uint64_t dataSize;
+};
+
+static_assert(sizeof(ListBinaryHeader) == 40, "list file header must not be padded");
+
+/** @class BinaryBlockLayout
+ * @brief Layout of values of a trivially copyable type T, stored as
+ *   their raw bytes one after the other.
+ */
+template<class T>
+struct BinaryBlockLayout
+{
+  /// @brief the layout as recorded in the header
+  static constexpr uint32_t id = 1;
+
+  /// @brief the size of each value
+  static constexpr uint32_t valueSize = sizeof(T);
+};
+
+/** @class BinaryStringLayout
+ * @brief Layout of strings, stored as a table of where each string ends
+ *   followed by a blob of all of their characters.
+ */
+struct BinaryStringLayout
+{
+  /// @brief the layout as recorded in the header
+  static constexpr uint32_t id = 2;
+
+  /// @brief the size of each character
+  static constexpr uint32_t valueSize = sizeof(char);
+};
+
+/** @class BinaryUnsupportedLayout
+ * @brief Values of types that can not be saved to a list file.  Trying
+ *   to save or load them fails to compile.
+ */
+struct BinaryUnsupportedLayout
+{
+};
+
+/** @class ListBinaryLayout
+ * @brief Select the layout that lists of values of type T are saved in.
+ */
+template<class T>
+struct ListBinaryLayout
+  : conditional<is_same<T, string>::value, BinaryStringLayout,
+                typename conditional<is_trivially_copyable<T>::value, BinaryBlockLayout<T>,
+                                     BinaryUnsupportedLayout>::type>::type
+{
+};
+
+/** @brief Make list file header
+ *
+ * Make the header of a list file of values of type T.
+ *
+ * @param count The number of values of the list.
+ * @param dataSize The number of bytes of values, or of characters for
+ *   strings.
+ *
+ * @returns ListBinaryHeader Returns the header for the file.
+ */
+template<class T>
+inline ListBinaryHeader makeListBinaryHeader(int count, uint64_t dataSize)
+{
+  ListBinaryHeader header = {{'L', 'I', 'S', 'T'}, 0x01020304, 1, ListBinaryLayout<T>::id, ListBinaryLayout<T>::valueSize, 0, static_cast<uint64_t>(count), dataSize};
+  return header;
+}
+
+/** @brief Find list file header problem
+ *
+ * Check that a header describes a list of values of type T, saved in
+ * the version and byte order we read.
+ *
+ * @param header The header read from the start of a file.
+ *
+ * @returns const char* Returns what is wrong with the header, or
+ *   nullptr if the values can be read.
+ */
+template<class T>
+inline const char* findListBinaryHeaderProblem(const ListBinaryHeader& header)
+{
+  if (memcmp(header.magic, "LIST", 4) != 0)
+  {
+    return "not a list file";
+  }
+  if (header.byteOrder != 0x01020304)
+  {
+    return "list file was saved with a different byte order";
+  }
+  if (header.version != 1)
+  {
+    return "list file version is not supported";
+  }
+  if (header.layout != ListBinaryLayout<T>::id or header.valueSize != ListBinaryLayout<T>::valueSize)
+  {
+    return "list file holds a different type of value";
+  }
+  if (header.count > static_cast<uint64_t>(numeric_limits<int>::max()))
+  {
+    return "list file holds too many values";
+  }
+
+  return nullptr;
+}
+
+/** @class ListBinaryWriter
+ * @brief Writes the values of a list of type T to a new list file.
+ */
+template<class T>
+class ListBinaryWriter
+{
+public:
+  // constructors
+  ListBinaryWriter(const char* operation, const string& path);
+
+  // writing the list file
+  template<class Iterator>
+  void write(Iterator first, int count);
+
+private:
+  /// @brief the file being written
+  ofstream out;
+
+  /// @brief the name of the list operation saving the file
+  const char* operation;
+
+  /// @brief the path of the file being written
+  string path;
+
+  // writing the parts of the list file
+  void writeHeader(int count, uint64_t dataSize);
+  template<class Iterator>
+  void writeValues(Iterator first, int count, BinaryBlockLayout<T> layout);
+  template<class Iterator>
+  void writeValues(Iterator first, int count, BinaryStringLayout layout);
+};
+
+/** @class ListBinaryReader
+ * @brief Reads back the values of a list of type T from a list file.
+ */
+template<class T>
+class ListBinaryReader
+{
+public:
+  // constructors
+  ListBinaryReader(const char* operation, const string& path);
+
+  // information about the values of the file
+  int getCount() const;
+
+  // reading the values of the file
+  bool readBlock(T* values);
+  template<class Store>
+  void readValues(Store store);
+
+private:
+  /// @brief the file being read
+  ifstream in;
+
+  /// @brief the name of the list operation loading the file
+  const char* operation;
+
+  /// @brief the path of the file being read
+  string path;
+
+  /// @brief the header read from the start of the file
+  ListBinaryHeader header;
+
+  // reading the parts of the list file
+  void checkHeader(uint64_t fileSize);
+  void readBytes(void* bytes, uint64_t size);
+  bool readBlock(T* values, BinaryBlockLayout<T> layout);
+  bool readBlock(T* values, BinaryStringLayout layout);
+  template<class Store>
+  void readValues(Store& store, BinaryBlockLayout<T> layout);
+  template<class Store>
+  void readValues(Store& store, BinaryStringLayout layout);
+};
+
+/** @brief Writer constructor
+ *
+ * Create the list file, replacing any file already at the path.
+ *
+ * @param operation The name of the list operation saving the file,
+ *   this must be a string literal.
+ * @param path The path of the file to write.
+ *
+ * @throws ListFileException If the file can not be created.
+ */
+template<class T>
+inline ListBinaryWriter<T>::ListBinaryWriter(const char* operation, const string& path)
+  : out(path, ios::binary | ios::trunc),
+    operation(operation),
+    path(path)
+{
+  if (not out)
+  {
+    throw ListFileException(operation, path, "could not create list file");
+  }
+}
+
+/** @brief Write list file
+ *
+ * Write the header and then the values to the file, and close it.
+ *
+ * @param first Iterator or pointer to the first value of the list.
+ * @param count The number of values of the list.
+ *
+ * @throws ListFileException If writing the file fails.
+ */
+template<class T>
+template<class Iterator>
+inline void ListBinaryWriter<T>::write(Iterator first, int count)
+{
+  writeValues(first, count, ListBinaryLayout<T>());
+
+  out.close();
+  if (not out)
+  {
+    throw ListFileException(operation, path, "could not write list file");
+  }
+}
+
+/** @brief Write header
+ *
+ * @param count The number of values of the list.
+ * @param dataSize The number of bytes of values, or of characters for
+ *   strings, that follow.
+ */
+template<class T>
+inline void ListBinaryWriter<T>::writeHeader(int count, uint64_t dataSize)
+{
+  ListBinaryHeader header = makeListBinaryHeader<T>(count, dataSize);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+/** @brief Write values
+ *
+ * Write values of a trivially copyable type as their raw bytes.  The
+ * values of an array based list are given by a pointer, and are written
+ * in a single block.
+ *
+ * @param first Iterator or pointer to the first value of the list.
+ * @param count The number of values of the list.
+ * @param layout Tag saying that the values are written as a block.
+ */
+template<class T>
+template<class Iterator>
+inline void ListBinaryWriter<T>::writeValues(Iterator first, int count, BinaryBlockLayout<T>)
+{
+  writeHeader(count, static_cast<uint64_t>(count) * sizeof(T));
+
+  if (count > 0 and is_pointer<Iterator>::value)
+  {
+    out.write(reinterpret_cast<const char*>(addressof(*first)), static_cast<streamsize>(count) * sizeof(T));
+    return;
+  }
+
+  for (int index = 0; index < count; index++, ++first)
+  {
+    out.write(reinterpret_cast<const char*>(addressof(*first)), sizeof(T));
+  }
+}
+
+/** @brief Write values
+ *
+ * Write strings as the table of the offset each string ends at in the
+ * blob, followed by the blob of all of their characters.  The strings
+ * are walked once to size the blob for the header, once for the table
+ * and once for the characters.
+ *
+ * @param first Iterator or pointer to the first string of the list.
+ * @param count The number of strings of the list.
+ * @param layout Tag saying that the values are strings.
+ */
+template<class T>
+template<class Iterator>
+inline void ListBinaryWriter<T>::writeValues(Iterator first, int count, BinaryStringLayout)
+{
+  uint64_t dataSize = 0;
+  Iterator current = first;
+  for (int index = 0; index < count; index++, ++current)
+  {
+    dataSize += current->size();
+  }
+  writeHeader(count, dataSize);
+
+  uint64_t end = 0;
+  current = first;
+  for (int index = 0; index < count; index++, ++current)
+  {
+    end += current->size();
+    out.write(reinterpret_cast<const char*>(&end), sizeof(end));
+  }
+
+  current = first;
+  for (int index = 0; index < count; index++, ++current)
+  {
+    out.write(current->data(), current->size());
+  }
+}
+
+/** @brief Reader constructor
+ *
+ * Open the list file and read its header, checking that the file holds
+ * a list of values of type T in a format that can be read, and that the
+ * whole list is actually there.
+ *
+ * @param operation The name of the list operation loading the file,
+ *   this must be a string literal.
+ * @param path The path of the file to read.
+ *
+ * @throws ListFileException If the file can not be opened, is not a
+ *   list file, or does not hold a list of values of type T.
+ */
+template<class T>
+inline ListBinaryReader<T>::ListBinaryReader(const char* operation, const string& path)
+  : in(path, ios::binary),
+    operation(operation),
+    path(path)
+{
+  if (not in)
+  {
+    throw ListFileException(operation, path, "could not open list file");
+  }
+
+  in.seekg(0, ios::end);
+  uint64_t fileSize = in.tellg();
+  in.seekg(0, ios::beg);
+
+  if (fileSize < sizeof(header))
+  {
+    throw ListFileException(operation, path, "not a list file");
+  }
+  readBytes(&header, sizeof(header));
+  checkHeader(fileSize);
+}
+
+/** @brief Check header
+ *
+ * Private helper to check that the header describes a list of values
+ * of type T that can be read, and that the file is exactly as long as
+ * the header says.
+ *
+ * @param fileSize The size of the whole file.
+ *
+ * @throws ListFileException If the header can not be used.
+ */
+template<class T>
+inline void ListBinaryReader<T>::checkHeader(uint64_t fileSize)
+{
+  const char* problem = findListBinaryHeaderProblem<T>(header);
+  if (problem != nullptr)
+  {
+    throw ListFileException(operation, path, problem);
+  }
+
+  // the values, and for strings the table of where each one ends, must
+  // fill the rest of the file exactly
+  uint64_t tableSize = (header.layout == BinaryStringLayout::id) ? header.count * sizeof(uint64_t) : 0;
+  uint64_t dataSize = (header.layout == BinaryStringLayout::id) ? header.dataSize : header.count * header.valueSize;
+  if (header.dataSize != dataSize or fileSize - sizeof(header) != tableSize + dataSize)
+  {
+    throw ListFileException(operation, path, "list file is truncated or corrupt");
+  }
+}
+
+/** @brief Count accessor
+ *
+ * @returns int Returns the number of values in the file.
+ */
+template<class T>
+inline int ListBinaryReader<T>::getCount() const
+{
+  return static_cast<int>(header.count);
+}
+
+/** @brief Read block
+ *
+ * Read all of the values straight into the raw storage of an array
+ * based list, if they are laid out in the file as a block of raw bytes.
+ * Nothing is read for values that have to be constructed one at a time.
+ *
+ * @param values Raw storage with room for getCount() values.
+ *
+ * @returns bool Returns true if the values were read, or false if they
+ *   need to be read with readValues() instead.
+ *
+ * @throws ListFileException If the values can not be read.
+ */
+template<class T>
+inline bool ListBinaryReader<T>::readBlock(T* values)
+{
+  return readBlock(values, ListBinaryLayout<T>());
+}
+
+/** @brief Read block
+ *
+ * @param values Raw storage with room for getCount() values.
+ * @param layout Tag saying that the values are laid out as a block.
+ *
+ * @returns bool Returns true, the values were read.
+ */
+template<class T>
+inline bool ListBinaryReader<T>::readBlock(T* values, BinaryBlockLayout<T>)
+{
+  readBytes(values, header.dataSize);
+  return true;
+}
+
+/** @brief Read block
+ *
+ * @param values Raw storage, left untouched.
+ * @param layout Tag saying that the values are strings.
+ *
+ * @returns bool Returns false, strings are never read as a block.
+ */
+template<class T>
+inline bool ListBinaryReader<T>::readBlock(T*, BinaryStringLayout)
+{
+  return false;
+}
+
+/** @brief Read values
+ *
+ * Read the values one at a time, moving each one into the list with
+ * the store function.
+ *
+ * @param store Function called with each value, as a T&&, in order.
+ *
+ * @throws ListFileException If the values can not be read.
+ */
+template<class T>
+template<class Store>
+inline void ListBinaryReader<T>::readValues(Store store)
+{
+  readValues(store, ListBinaryLayout<T>());
+}
+
+/** @brief Read values
+ *
+ * @param store Function called with each value, as a T&&, in order.
+ * @param layout Tag saying that the values are stored as raw bytes.
+ */
+template<class T>
+template<class Store>
+inline void ListBinaryReader<T>::readValues(Store& store, BinaryBlockLayout<T>)
+{
+  for (uint64_t index = 0; index < header.count; index++)
+  {
+    alignas(T) unsigned char bytes[sizeof(T)];
+    readBytes(bytes, sizeof(T));
+    store(move(*reinterpret_cast<T*>(bytes)));
+  }
+}
+
+/** @brief Read values
+ *
+ * Read the table of where each string ends and the blob of characters
+ * into one temporary buffer, allocated once, and construct each string
+ * from its part of the blob.
+ *
+ * @param store Function called with each string, as a T&&, in order.
+ * @param layout Tag saying that the values are strings.
+ */
+template<class T>
+template<class Store>
+inline void ListBinaryReader<T>::readValues(Store& store, BinaryStringLayout)
+{
+  uint64_t tableSize = header.count * sizeof(uint64_t);
+  unique_ptr<char[]> buffer(new char[tableSize + header.dataSize]);
+  readBytes(buffer.get(), tableSize + header.dataSize);
+  const char* blob = buffer.get() + tableSize;
+
+  uint64_t start = 0;
+  for (uint64_t index = 0; index < header.count; index++)
+  {
+    uint64_t end;
+    memcpy(&end, buffer.get() + index * sizeof(uint64_t), sizeof(end));
+    if (end < start or end > header.dataSize)
+    {
+      throw ListFileException(operation, path, "list file is truncated or corrupt");
+    }
+
+    store(string(blob + start, end - start));
+    start = end;
+  }
+}
+
+/** @brief Read bytes
+ *
+ * Private helper to read the next bytes of the file.
+ *
+ * @param bytes Where to read the bytes to.
+ * @param size The number of bytes to read.
+ *
+ * @throws ListFileException If the bytes can not be read.
+ */
+template<class T>
+inline void ListBinaryReader<T>::readBytes(void* bytes, uint64_t size)
+{
+  in.read(static_cast<char*>(bytes), size);
+  if (not in)
+  {
+    throw ListFileException(operation, path, "could not read list file");
+  }
+}
+
+#endif // define _LIST_BINARY_HPP_
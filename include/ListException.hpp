@@ -8,11 +8,21 @@
  * @date   June 1, 2021
  *
  * Declare all exceptions that can be generated and thrown by List
- * instances.
+ * instances.  The lists throw their exceptions with the facts of the
+ * failed operation, such as the size of the list and the index that
+ * was asked for, and the message describing them is only formatted if
+ * what() is actually called.  Code that catches these exceptions as a
+ * normal part of its work then pays nothing for building messages that
+ * are never read.
  */
 #ifndef _LIST_EXCEPTION_HPP_
 #define _LIST_EXCEPTION_HPP_
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <ostream>
 #include <string>
+#include <type_traits>
 using namespace std;
 
 /** @class ListEmptyException
@@ -27,12 +37,25 @@ class ListEmptyException : public exception
 {
 public:
   explicit ListEmptyException(const string& message);
+  ListEmptyException(const char* operation, int size);
   ~ListEmptyException();
   virtual const char* what() const throw();
 
+  // the facts of the failed operation
+  const char* getOperation() const;
+  int getSize() const;
+
 private:
-  /// Stores the particular message describing what caused the exception.
-  string message;
+  /// Stores the particular message describing what caused the exception,
+  /// formatted the first time it is asked for.
+  mutable string message;
+
+  /// @brief the name of the list operation that failed, such as
+  ///   "AList::getFront", always a string literal
+  const char* operation;
+
+  /// @brief the size of the list when the operation failed
+  int size;
 };
 
 /** @class ListMemoryBoundsException
@@ -46,31 +69,240 @@ class ListMemoryBoundsException : public exception
 {
 public:
   explicit ListMemoryBoundsException(const string& message);
+  ListMemoryBoundsException(const char* operation, int size, int index);
   ~ListMemoryBoundsException();
   virtual const char* what() const throw();
 
+  // the facts of the failed operation
+  const char* getOperation() const;
+  int getSize() const;
+  int getIndex() const;
+
 private:
-  /// Stores the particular message describing what caused the exception.
-  string message;
+  /// Stores the particular message describing what caused the exception,
+  /// formatted the first time it is asked for.
+  mutable string message;
+
+  /// @brief the name of the list operation that failed, such as
+  ///   "AList::operator[]", always a string literal
+  const char* operation;
+
+  /// @brief the size of the list when the operation failed
+  int size;
+
+  /// @brief the illegal index the operation was asked to access
+  int index;
 };
 
 /** @class ListValueNotFoundException
  * @brief Search for a value expected in list failed.
  *
  * Exception to be thrown by our List class if a search
- * for an expected value fails.
+ * for an expected value fails.  The value that was not found is kept
+ * by copying it into a small buffer inside of the exception, so
+ * throwing does not format or allocate anything for the usual small
+ * values.  Values too large for the buffer are left out of the message.
  *
  */
 class ListValueNotFoundException : public exception
 {
 public:
   explicit ListValueNotFoundException(const string& message);
+  template<class T>
+  ListValueNotFoundException(const char* operation, const T& value);
+  ListValueNotFoundException(const ListValueNotFoundException& other);
+  ListValueNotFoundException& operator=(const ListValueNotFoundException& rhs);
   ~ListValueNotFoundException();
   virtual const char* what() const throw();
 
+  // the facts of the failed operation
+  const char* getOperation() const;
+  bool hasValue() const;
+
+private:
+  /// @brief the largest value that is kept by the exception, large
+  ///   enough for a string
+  static const int VALUE_BYTES = 32;
+
+  /// Stores the particular message describing what caused the exception,
+  /// formatted the first time it is asked for.
+  mutable string message;
+
+  /// @brief the name of the list operation that failed, such as
+  ///   "AList::deleteValue", always a string literal
+  const char* operation;
+
+  /// @brief storage for a copy of the value that was not found
+  alignas(max_align_t) unsigned char valueBytes[VALUE_BYTES];
+
+  /// @brief functions to output, copy and destroy the kept value, all
+  ///   nullptr if the exception does not keep the value
+  void (*formatValue)(ostream& out, const void* value);
+  void (*copyValue)(void* destination, const void* source);
+  void (*destroyValue)(void* value);
+
+  // keeping a copy of the value that was not found
+  template<class T>
+  void keepValue(const T& value, true_type fits);
+  template<class T>
+  void keepValue(const T& value, false_type fits);
+  template<class T>
+  static void formatKeptValue(ostream& out, const void* value);
+  template<class T>
+  static void copyKeptValue(void* destination, const void* source);
+  template<class T>
+  static void destroyKeptValue(void* value);
+};
+
+/**
+ * @brief ListValueNotFoundException constructor
+ *
+ * Constructor for the exception thrown when the value an operation
+ * was asked to find is not in the list.  The value is copied into
+ * the exception if it fits, to be formatted only if the message is
+ * asked for.
+ *
+ * @param operation The name of the list operation that failed, this
+ *   must be a string literal.
+ * @param value The value that was not found.
+ */
+template<class T>
+ListValueNotFoundException::ListValueNotFoundException(const char* operation, const T& value)
+  : operation(operation),
+    formatValue(nullptr),
+    copyValue(nullptr),
+    destroyValue(nullptr)
+{
+  keepValue(value, integral_constant<bool, (sizeof(T) <= VALUE_BYTES and alignof(T) <= alignof(max_align_t))>());
+}
+
+/**
+ * @brief Keep value
+ *
+ * Copy a value that fits into the value buffer of the exception.
+ *
+ * @param value The value to copy into the exception.
+ * @param fits Tag saying that the value fits the buffer.
+ */
+template<class T>
+void ListValueNotFoundException::keepValue(const T& value, true_type)
+{
+  new (valueBytes) T(value);
+  formatValue = &formatKeptValue<T>;
+  copyValue = &copyKeptValue<T>;
+  destroyValue = &destroyKeptValue<T>;
+}
+
+/**
+ * @brief Keep value
+ *
+ * A value too large for the value buffer of the exception is not
+ * kept, and the message will not show it.
+ *
+ * @param value The value that is not kept.
+ * @param fits Tag saying that the value does not fit the buffer.
+ */
+template<class T>
+void ListValueNotFoundException::keepValue(const T&, false_type)
+{
+}
+
+/**
+ * @brief Format kept value
+ *
+ * @param out The stream to output the kept value on.
+ * @param value Pointer to the kept value of type T.
+ */
+template<class T>
+void ListValueNotFoundException::formatKeptValue(ostream& out, const void* value)
+{
+  out << *static_cast<const T*>(value);
+}
+
+/**
+ * @brief Copy kept value
+ *
+ * @param destination The value buffer of the new exception.
+ * @param source Pointer to the kept value of type T to copy.
+ */
+template<class T>
+void ListValueNotFoundException::copyKeptValue(void* destination, const void* source)
+{
+  new (destination) T(*static_cast<const T*>(source));
+}
+
+/**
+ * @brief Destroy kept value
+ *
+ * @param value Pointer to the kept value of type T to destroy.
+ */
+template<class T>
+void ListValueNotFoundException::destroyKeptValue(void* value)
+{
+  static_cast<T*>(value)->~T();
+}
+
+/** @class ListFileException
+ * @brief Saving or loading a list file failed.
+ *
+ * Exception to be thrown by our List class if a file of list
+ * values can not be opened, written or read, or does not hold a list
+ * of the expected type of value.
+ *
+ */
+class ListFileException : public exception
+{
+public:
+  ListFileException(const char* operation, const string& path, const char* problem);
+  ~ListFileException();
+  virtual const char* what() const throw();
+
+  // the facts of the failed operation
+  const char* getOperation() const;
+  const string& getPath() const;
+
+private:
+  /// Stores the particular message describing what caused the exception,
+  /// formatted the first time it is asked for.
+  mutable string message;
+
+  /// @brief the name of the list operation that failed, such as
+  ///   "AList::loadBinary", always a string literal
+  const char* operation;
+
+  /// @brief the path of the file that could not be saved or loaded
+  string path;
+
+  /// @brief what went wrong with the file, always a string literal
+  const char* problem;
+};
+
+/** @class ListReadOnlyException
+ * @brief Attempt to change a list that can not be changed.
+ *
+ * Exception to be thrown by a view of the values of another list or
+ * array if it is asked to insert or remove values, which only the
+ * owner of the values can do.
+ *
+ */
+class ListReadOnlyException : public exception
+{
+public:
+  explicit ListReadOnlyException(const char* operation);
+  ~ListReadOnlyException();
+  virtual const char* what() const throw();
+
+  // the facts of the failed operation
+  const char* getOperation() const;
+
 private:
-  /// Stores the particular message describing what caused the exception.
-  string message;
+  /// Stores the particular message describing what caused the exception,
+  /// formatted the first time it is asked for.
+  mutable string message;
+
+  /// @brief the name of the list operation that failed, such as
+  ///   "ListView::insertBack", always a string literal
+  const char* operation;
 };
 
-#endif // _LIST_EXCEPTION_HPP_
\ No newline at end of file
+#endif // _LIST_EXCEPTION_HPP_
@@ -0,0 +1,99 @@
+/** @file ListView.hpp
+ * @brief Non-owning view of the values of an array or AList.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * A ListView presents a block of values that belongs to someone else,
+ * a plain array, an AList, or a range of indexes of either, through the
+ * List interface.  Nothing is allocated or copied, the view is only a
+ * pointer to the first value and a size, so code that only reads a
+ * buffer can be handed a ListView rather than a copy of the buffer in a
+ * temporary AList.  Like the iterators of an AList, a view of an AList
+ * is only good until the list next grows or shrinks.
+ */
+#ifndef _LIST_VIEW_HPP_
+#define _LIST_VIEW_HPP_
+#include "AList.hpp"
+#include "AListIterator.hpp"
+#include "List.hpp"
+#include "ListException.hpp"
+#include <string>
+using namespace std;
+
+/** @class ListView
+ * @brief The ListView read only view of a contiguous block of values,
+ *   implementing the List interface.
+ *
+ * The values can be indexed, iterated over, compared and written out
+ * like those of any list, but the view can not insert or remove values,
+ * and those methods of the List interface throw a
+ * ListReadOnlyException.  Like a std::span, the values themselves are
+ * not const, and assigning to them through operator[] or an iterator
+ * changes the values of the array or list being viewed.
+ */
+template<class T>
+class ListView : public List<T>
+{
+public:
+  // constructors
+  ListView();                      // default constructor
+  ListView(int size, T values[]);  // array based constructor
+  template<int InlineN, class BoundsCheck>
+  ListView(AList<T, InlineN, BoundsCheck>& list);
+  template<int InlineN, class BoundsCheck>
+  ListView(AList<T, InlineN, BoundsCheck>& list, int first, int count);
+
+  // accessor and information methods
+  T getFront() const;
+  T getBack() const;
+  bool operator==(const List<T>& rhs) const;
+  T& operator[](int index) const;
+  ListView<T> subview(int first, int count) const;
+
+  // adding and removing values is not possible through a view, these
+  // all throw a ListReadOnlyException
+  void clear();
+  List<T>& insertBack(const T& value);
+  List<T>& insertBack(T&& value);
+  List<T>& operator>>(const T& value);
+  void deleteBack();
+  List<T>& insertFront(const T& value);
+  List<T>& insertFront(T&& value);
+  List<T>& operator<<(const T& value);
+  void deleteFront();
+  void deleteValue(const T& value);
+  void deleteIndex(int index);
+  List<T>& insertAt(int index, const T& value);
+  List<T>& insertAt(int index, T&& value);
+
+  // iterating over view the C++ way, using random access iterator
+  // objects and supporting range based iteration and <algorithm>
+  using value_type = T;
+  using iterator = AListIterator<T>;
+  using const_iterator = AListIterator<const T>;
+  iterator begin() const;
+  iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+protected:
+  // comparing values of lists, directly through our block of values
+  const T* contiguousValues() const;
+
+  // writing values out to a stream, walking through our own values
+  void writeValues(ListWriter<T>& writer, int first, int count) const;
+
+private:
+  /// @brief the first of the size values being viewed, owned by the
+  ///   array or list being viewed
+  T* values;
+};
+
+// template member definitions
+#include "ListView.ipp"
+
+#endif // define _LIST_VIEW_HPP_
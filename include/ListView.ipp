@@ -0,0 +1,469 @@
+/** @file ListView.ipp
+ * @brief Non-owning view of the values of an array or AList.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the ListView, which reads the values of a block of memory
+ * it does not own through the List interface.  Reading values works
+ * the same as for an AList, while every method that would insert or
+ * remove values throws a ListReadOnlyException.
+ *
+ * This file is included at the end of ListView.hpp and is not compiled
+ * on its own.
+ */
+#include "ListException.hpp"
+#include <string>
+using namespace std;
+
+/** @brief Default constructor
+ *
+ * Construct an empty view, of no values.
+ */
+template<class T>
+ListView<T>::ListView()
+{
+  this->size = 0;
+  values = nullptr;
+}
+
+/** @brief Standard constructor
+ *
+ * Construct a view of the values of an array.  The values are not
+ * copied, the array must outlive the view.  A range of the array is
+ * viewed by giving the address of its first value and its size.
+ *
+ * @param size The number of values of the array to view.
+ * @param values The array of values to view.
+ */
+template<class T>
+ListView<T>::ListView(int size, T values[])
+{
+  this->size = size;
+  this->values = values;
+}
+
+/** @brief List constructor
+ *
+ * Construct a view of all of the values of an AList.  The list is not
+ * const, since the values can be changed through the view.
+ *
+ * @param list The list whose values are viewed.
+ */
+template<class T>
+template<int InlineN, class BoundsCheck>
+ListView<T>::ListView(AList<T, InlineN, BoundsCheck>& list)
+{
+  this->size = list.getSize();
+  values = list.data();
+}
+
+/** @brief List range constructor
+ *
+ * Construct a view of count values of an AList, starting with the
+ * value at index first.
+ *
+ * @param list The list whose values are viewed.
+ * @param first The index of the first value to view.
+ * @param count The number of values to view.
+ *
+ * @throws ListMemoryBoundsException If the range of values does not
+ *   lie within the list.
+ */
+template<class T>
+template<int InlineN, class BoundsCheck>
+ListView<T>::ListView(AList<T, InlineN, BoundsCheck>& list, int first, int count)
+{
+  if ((first < 0) or (count < 0) or (first > list.getSize() - count))
+  {
+    throw ListMemoryBoundsException("ListView::ListView", list.getSize(), (first < 0 or count < 0) ? first : first + count - 1);
+  }
+
+  this->size = count;
+  values = list.data() + first;
+}
+
+/** @brief Access front of view
+ *
+ * Accessor method to get a copy of the item currently
+ * at the front of this view.
+ *
+ * @returns T Returns a copy of the front item of the
+ *   view.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access front item of an empty view, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T ListView<T>::getFront() const
+{
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("ListView::getFront", this->size);
+  }
+
+  return values[0];
+}
+
+/** @brief Access back of view
+ *
+ * Accessor method to get a copy of the item currently
+ * at the back of this view.
+ *
+ * @returns T Returns a copy of the back item of the
+ *   view.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access back item of an empty view, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T ListView<T>::getBack() const
+{
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("ListView::getBack", this->size);
+  }
+
+  return values[this->size - 1];
+}
+
+/** @brief Boolean equals operator
+ *
+ * Check if the values of this view are equal to those of the right
+ * hand side (rhs) list, which may be any kind of list or another view.
+ * The comparison is done by List<T>::equals(), using whichever
+ * list is able to walk through its values fastest.
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this view to.
+ *
+ * @returns bool true if the lists are equal, false if the are not.
+ */
+template<class T>
+bool ListView<T>::operator==(const List<T>& rhs) const
+{
+  return this->equals(rhs);
+}
+
+/** @brief Indexing operator
+ *
+ * Provide a way to index individual values in our view, the same as
+ * for an AList.  The reference returned is to the value in the array
+ * or list being viewed.
+ *
+ * @param index The index of the value it is desired to access from
+ *   this view.
+ *
+ * @returns T& Returns a reference to the requested value at the
+ *   requested index.
+ *
+ * @throws ListMemoryBoundsException if a request for an index beyond
+ *   the end of the view (or less than 0) is made.
+ */
+template<class T>
+T& ListView<T>::operator[](int index) const
+{
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("ListView::operator[]", this->size, index);
+  }
+
+  return values[index];
+}
+
+/** @brief Sub view
+ *
+ * Make a view of a range of the values of this view, viewing the same
+ * values without copying them.
+ *
+ * @param first The index of the first value to view.
+ * @param count The number of values to view.
+ *
+ * @returns ListView<T> Returns the view of the range.
+ *
+ * @throws ListMemoryBoundsException If the range of values does not
+ *   lie within this view.
+ */
+template<class T>
+ListView<T> ListView<T>::subview(int first, int count) const
+{
+  if ((first < 0) or (count < 0) or (first > this->size - count))
+  {
+    throw ListMemoryBoundsException("ListView::subview", this->size, (first < 0 or count < 0) ? first : first + count - 1);
+  }
+
+  return ListView<T>(count, values + first);
+}
+
+/** @brief Clear out view
+ *
+ * A view can not remove the values it views.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+void ListView<T>::clear()
+{
+  throw ListReadOnlyException("ListView::clear");
+}
+
+/** @brief Insert value on back
+ *
+ * A view can not insert values.
+ *
+ * @param value The value that is not inserted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+List<T>& ListView<T>::insertBack(const T&)
+{
+  throw ListReadOnlyException("ListView::insertBack");
+}
+
+/** @brief Insert value on back
+ *
+ * A view can not insert values.
+ *
+ * @param value The value that is not inserted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+List<T>& ListView<T>::insertBack(T&&)
+{
+  throw ListReadOnlyException("ListView::insertBack");
+}
+
+/** @brief Overload operator>> for insert on back
+ *
+ * A view can not insert values.
+ *
+ * @param value The value that is not inserted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+List<T>& ListView<T>::operator>>(const T&)
+{
+  throw ListReadOnlyException("ListView::operator>>");
+}
+
+/** @brief Delete back item
+ *
+ * A view can not remove values.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+void ListView<T>::deleteBack()
+{
+  throw ListReadOnlyException("ListView::deleteBack");
+}
+
+/** @brief Insert value on front
+ *
+ * A view can not insert values.
+ *
+ * @param value The value that is not inserted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+List<T>& ListView<T>::insertFront(const T&)
+{
+  throw ListReadOnlyException("ListView::insertFront");
+}
+
+/** @brief Insert value on front
+ *
+ * A view can not insert values.
+ *
+ * @param value The value that is not inserted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+List<T>& ListView<T>::insertFront(T&&)
+{
+  throw ListReadOnlyException("ListView::insertFront");
+}
+
+/** @brief Overload operator<< for insert on front
+ *
+ * A view can not insert values.
+ *
+ * @param value The value that is not inserted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+List<T>& ListView<T>::operator<<(const T&)
+{
+  throw ListReadOnlyException("ListView::operator<<");
+}
+
+/** @brief Delete front item
+ *
+ * A view can not remove values.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+void ListView<T>::deleteFront()
+{
+  throw ListReadOnlyException("ListView::deleteFront");
+}
+
+/** @brief Delete value(s)
+ *
+ * A view can not remove values.
+ *
+ * @param value The value that is not deleted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+void ListView<T>::deleteValue(const T&)
+{
+  throw ListReadOnlyException("ListView::deleteValue");
+}
+
+/** @brief Delete value at index
+ *
+ * A view can not remove values.
+ *
+ * @param index The index that is not deleted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+void ListView<T>::deleteIndex(int)
+{
+  throw ListReadOnlyException("ListView::deleteIndex");
+}
+
+/** @brief Insert value at index
+ *
+ * A view can not insert values.
+ *
+ * @param index The index the value is not inserted at.
+ * @param value The value that is not inserted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+List<T>& ListView<T>::insertAt(int, const T&)
+{
+  throw ListReadOnlyException("ListView::insertAt");
+}
+
+/** @brief Insert value at index
+ *
+ * A view can not insert values.
+ *
+ * @param index The index the value is not inserted at.
+ * @param value The value that is not inserted.
+ *
+ * @throws ListReadOnlyException Always.
+ */
+template<class T>
+List<T>& ListView<T>::insertAt(int, T&&)
+{
+  throw ListReadOnlyException("ListView::insertAt");
+}
+
+/** @brief Begin iterator
+ *
+ * Create and return an iterator pointing to the beginning of
+ * the values of this view, ready to be iterated over.
+ *
+ * @returns iterator returns a new random access iterator that keeps
+ *   track of iterating over the values.
+ */
+template<class T>
+typename ListView<T>::iterator ListView<T>::begin() const
+{
+  return iterator(values);
+}
+
+/** @brief End iterator
+ *
+ * Create and return an iterator pointing to one past the last value
+ * of this view.
+ *
+ * @returns iterator returns a new random access iterator pointing to
+ *   the end of the values.
+ */
+template<class T>
+typename ListView<T>::iterator ListView<T>::end() const
+{
+  return iterator(values + this->size);
+}
+
+/** @brief Const begin iterator
+ *
+ * Create and return an iterator pointing to the beginning of the
+ * values of this view, that only gives read access to them.
+ *
+ * @returns const_iterator returns a new random access iterator that
+ *   keeps track of iterating over the values.
+ */
+template<class T>
+typename ListView<T>::const_iterator ListView<T>::cbegin() const
+{
+  return const_iterator(values);
+}
+
+/** @brief Const end iterator
+ *
+ * Create and return an iterator pointing to one past the last value
+ * of this view, that only gives read access to the values.
+ *
+ * @returns const_iterator returns a new random access iterator
+ *   pointing to the end of the values.
+ */
+template<class T>
+typename ListView<T>::const_iterator ListView<T>::cend() const
+{
+  return const_iterator(values + this->size);
+}
+
+/** @brief Contiguous values
+ *
+ * The values of a view are contiguous, so comparisons with any other
+ * list of contiguous values compare the two blocks of values directly.
+ *
+ * @returns const T* Returns a pointer to the first of the size values.
+ */
+template<class T>
+const T* ListView<T>::contiguousValues() const
+{
+  return values;
+}
+
+/** @brief Write values to stream
+ *
+ * Write the given range of values to the output stream, separated by a
+ * comma and a space, indexing the viewed block of values directly
+ * rather than going through operator[] for each value.
+ *
+ * @param writer The stream or string to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write, at least 1.
+ */
+template<class T>
+void ListView<T>::writeValues(ListWriter<T>& writer, int first, int count) const
+{
+  writer.writeValue(values[first]);
+  for (int index = first + 1; index < first + count; index++)
+  {
+    writer.writeText(", ");
+    writer.writeValue(values[index]);
+  }
+}
@@ -0,0 +1,246 @@
+/** @file ListWriter.hpp
+ * @brief Destination for the text representation of a List.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * A ListWriter is where a list writes the representation of its values
+ * to, either an output stream or the end of a string.  Lists of the
+ * plain integer types are written to a string with std::to_chars,
+ * which formats straight into the memory of the string without the
+ * locale lookups and virtual calls an ostream makes for every number.
+ * The text is the same as an ostream in its default state produces.
+ * All of the members are defined here in the header so that they are
+ * inlined into the loops of the lists writing their values.
+ */
+#ifndef _LIST_WRITER_HPP_
+#define _LIST_WRITER_HPP_
+#include <charconv>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+using namespace std;
+
+/** @brief Fast formatted test
+ *
+ * True for the integer types that an ostream writes as plain decimal
+ * numbers, and that are therefore written with std::to_chars to a
+ * string.  bool and the character types are written differently by an
+ * ostream, so they are left out.
+ */
+template<class T>
+struct IsFastFormatted
+  : integral_constant<bool,
+                      is_same<T, short>::value or is_same<T, unsigned short>::value or
+                        is_same<T, int>::value or is_same<T, unsigned int>::value or
+                        is_same<T, long>::value or is_same<T, unsigned long>::value or
+                        is_same<T, long long>::value or is_same<T, unsigned long long>::value>
+{
+};
+
+/** @class ListWriter
+ * @brief Output stream or string that the values of a list of type T
+ *   are written to.
+ */
+template<class T>
+class ListWriter
+{
+public:
+  // constructors
+  explicit ListWriter(ostream& out);
+  explicit ListWriter(string& text);
+
+  // writing the parts of the representation of a list
+  void writeText(const char* text);
+  void writeSize(int size);
+  void writeValue(const T& value);
+
+  // estimating the length of the text of a value
+  static int digitCount(const T& value);
+
+private:
+  /// @brief the stream written to, or nullptr when writing to a string
+  ostream* out;
+
+  /// @brief the string appended to, or nullptr when writing to a stream
+  string* text;
+
+  // appending values to the string
+  template<class N>
+  void appendNumber(N number);
+  static int countCharacters(const T& value, true_type fast);
+  static int countCharacters(const T& value, false_type fast);
+  void appendValue(const T& value, true_type fast);
+  void appendValue(const T& value, false_type fast);
+};
+
+/** @brief Stream constructor
+ *
+ * Write to the given output stream, formatted by the stream itself.
+ *
+ * @param out The output stream to write to.
+ */
+template<class T>
+inline ListWriter<T>::ListWriter(ostream& out)
+  : out(&out),
+    text(nullptr)
+{
+}
+
+/** @brief String constructor
+ *
+ * Append to the end of the given string.  Room for the text should be
+ * reserved in the string beforehand, so that it is allocated once.
+ *
+ * @param text The string to append to.
+ */
+template<class T>
+inline ListWriter<T>::ListWriter(string& text)
+  : out(nullptr),
+    text(&text)
+{
+}
+
+/** @brief Write text
+ *
+ * @param text The fixed text to write, such as a separator.
+ */
+template<class T>
+inline void ListWriter<T>::writeText(const char* text)
+{
+  if (out != nullptr)
+  {
+    *out << text;
+  }
+  else
+  {
+    this->text->append(text);
+  }
+}
+
+/** @brief Write size
+ *
+ * @param size The size of the list to write.
+ */
+template<class T>
+inline void ListWriter<T>::writeSize(int size)
+{
+  if (out != nullptr)
+  {
+    *out << size;
+  }
+  else
+  {
+    appendNumber(size);
+  }
+}
+
+/** @brief Write value
+ *
+ * @param value The value of the list to write.
+ */
+template<class T>
+inline void ListWriter<T>::writeValue(const T& value)
+{
+  if (out != nullptr)
+  {
+    *out << value;
+  }
+  else
+  {
+    appendValue(value, IsFastFormatted<T>());
+  }
+}
+
+/** @brief Digit count
+ *
+ * Count the characters a fast formatted value is written with,
+ * including its sign.  Other types are counted as a single character,
+ * since their length can not be known without formatting them.
+ *
+ * @param value The value to count the characters of.
+ *
+ * @returns int Returns the number of characters of the value.
+ */
+template<class T>
+inline int ListWriter<T>::digitCount(const T& value)
+{
+  return countCharacters(value, IsFastFormatted<T>());
+}
+
+/** @brief Count characters
+ *
+ * @param value The plain integer to count the characters of.
+ * @param fast Tag saying that the value is fast formatted.
+ *
+ * @returns int Returns the number of characters of the value.
+ */
+template<class T>
+inline int ListWriter<T>::countCharacters(const T& value, true_type)
+{
+  char digits[numeric_limits<T>::digits10 + 3];
+  return to_chars(digits, digits + sizeof(digits), value).ptr - digits;
+}
+
+/** @brief Count characters
+ *
+ * @param value The value of another type, which is not counted.
+ * @param fast Tag saying that the value is not fast formatted.
+ *
+ * @returns int Returns 1, as a guess of the number of characters.
+ */
+template<class T>
+inline int ListWriter<T>::countCharacters(const T&, false_type)
+{
+  return 1;
+}
+
+/** @brief Append number
+ *
+ * Format a number directly onto the end of the string.
+ *
+ * @param number The integer to append.
+ */
+template<class T>
+template<class N>
+inline void ListWriter<T>::appendNumber(N number)
+{
+  char digits[numeric_limits<N>::digits10 + 3];
+  char* end = to_chars(digits, digits + sizeof(digits), number).ptr;
+  text->append(digits, end - digits);
+}
+
+/** @brief Append value
+ *
+ * Append a value of a plain integer type with to_chars.
+ *
+ * @param value The value to append.
+ * @param fast Tag saying that the value is fast formatted.
+ */
+template<class T>
+inline void ListWriter<T>::appendValue(const T& value, true_type)
+{
+  appendNumber(value);
+}
+
+/** @brief Append value
+ *
+ * Append a value of any other type by formatting it with a stream.
+ *
+ * @param value The value to append.
+ * @param fast Tag saying that the value is not fast formatted.
+ */
+template<class T>
+inline void ListWriter<T>::appendValue(const T& value, false_type)
+{
+  ostringstream formatted;
+  formatted << value;
+  text->append(formatted.str());
+}
+
+#endif // define _LIST_WRITER_HPP_
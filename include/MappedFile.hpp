@@ -0,0 +1,75 @@
+/** @file MappedFile.hpp
+ * @brief File mapped into memory, the storage of a file backed AList.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Declare the MappedFile, which maps the whole of a file into memory
+ * with mmap.  A writable file is mapped shared, so that storing to the
+ * memory changes the file, and it is grown or shrunk with ftruncate and
+ * mremap.  The kernel reads the pages of the file in as they are first
+ * touched and writes changed pages back on its own, so the file can be
+ * larger than physical memory.  A read only file is mapped private, so
+ * its pages are shared with the page cache until they are stored to,
+ * and those changes are never written back to the file.
+ */
+#ifndef _MAPPED_FILE_HPP_
+#define _MAPPED_FILE_HPP_
+#include <cstdint>
+#include <string>
+using namespace std;
+
+/** @class MappedFile
+ * @brief A file mapped into memory in its entirety.
+ *
+ * The file stays open and mapped for the lifetime of the MappedFile.
+ * Errors are thrown as a ListFileException naming the list operation
+ * that was using the file.
+ */
+class MappedFile
+{
+public:
+  // constructors and destructors
+  MappedFile(const char* operation, const string& path, bool readOnly);
+  MappedFile(const MappedFile& file) = delete;
+  ~MappedFile();
+
+  // assignment operators
+  MappedFile& operator=(const MappedFile& rhs) = delete;
+
+  // accessor and information methods
+  unsigned char* getData() const;
+  uint64_t getLength() const;
+  bool isReadOnly() const;
+  const string& getPath() const;
+
+  // changing the file
+  void resize(const char* operation, uint64_t length);
+  void sync(const char* operation);
+  bool close(uint64_t length);
+
+private:
+  /// @brief the path the file was opened with
+  string path;
+
+  /// @brief the descriptor of the open file, or -1 once it is closed
+  int descriptor;
+
+  /// @brief true if the file is mapped private and never written
+  bool readOnly;
+
+  /// @brief the start of the mapped memory, or nullptr while the file
+  ///   is empty and not mapped
+  unsigned char* data;
+
+  /// @brief the length of the file and of its mapping
+  uint64_t length;
+
+  // private member methods for managing the mapping
+  void unmap();
+};
+
+#endif // _MAPPED_FILE_HPP_
@@ -13,6 +13,8 @@
  */
 #ifndef _NODE_HPP_
 #define _NODE_HPP_
+#include <utility>
+using namespace std;
 
 /** Node
  * A simple Node structure type to be used to hold values
@@ -22,6 +24,15 @@ template<class T>
 struct Node
 {
 public:
+  /// @brief Construct a node linked to the given next node, with
+  ///   the value constructed in place from the remaining arguments.
+  template<class... Args>
+  Node(Node<T>* next, Args&&... args)
+    : value(forward<Args>(args)...),
+      next(next)
+  {
+  }
+
   /// @brief the actual date value of type T this node contains.
   T value;
 
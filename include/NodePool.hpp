@@ -0,0 +1,105 @@
+/** @file NodePool.hpp
+ * @brief Slab based pool allocator for the nodes of linked lists.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * A linked list allocates a node for every value it holds.  Asking the
+ * heap for each node separately is slow, and the nodes end up scattered
+ * all over memory.  The NodePool instead carves nodes out of large
+ * blocks of memory, called slabs, so that nodes allocated together sit
+ * next to each other in memory.  Nodes given back to the pool are kept
+ * on a free list, linked together through the memory of the free nodes
+ * themselves, and are handed out again before any new slab is needed.
+ */
+#ifndef _NODEPOOL_HPP_
+#define _NODEPOOL_HPP_
+#include <vector>
+using namespace std;
+
+/** @class NodePool
+ * @brief Pool allocator handing out raw memory for nodes of type
+ *   NodeType, carved out of larger slabs of memory.
+ *
+ * The pool only manages memory, the user of the pool constructs the
+ * node in the memory returned by allocate() and must destroy the node
+ * again before giving its memory back with deallocate().  Any other
+ * allocator used for the nodes of an LList needs to provide these same
+ * allocate(), deallocate() and release() methods, as well as reserve()
+ * if the list is loaded with loadBinary().
+ */
+template<class NodeType>
+class NodePool
+{
+public:
+  // constructors and destructors
+  NodePool();                                  // default constructor
+  NodePool(NodePool<NodeType>&& pool) noexcept; // move constructor
+  NodePool(const NodePool<NodeType>& pool) = delete;
+  ~NodePool(); // destructor
+
+  // assignment operators
+  NodePool<NodeType>& operator=(NodePool<NodeType>&& rhs) noexcept;
+  NodePool<NodeType>& operator=(const NodePool<NodeType>& rhs) = delete;
+
+  // accessor and information methods
+  int getSlabCount() const;
+  int getCapacity() const;
+  int getLiveCount() const;
+
+  // allocating and giving back memory for nodes
+  NodeType* allocate();
+  void deallocate(NodeType* node);
+  void release();
+  void reserve(int count);
+
+private:
+  /// @brief the size of the first slab allocated by the pool
+  static const int INITIAL_SLAB_SIZE = 8;
+
+  /// @brief each new slab is double the size of the last one, up to
+  ///   this maximum number of nodes
+  static const int MAX_SLAB_SIZE = 1024;
+
+  /// @brief A slot of a slab, large enough to hold a node.  While the
+  ///   slot is on the free list its memory holds the link to the next
+  ///   free slot instead.
+  union Slot
+  {
+    Slot* nextFree;
+    alignas(NodeType) unsigned char node[sizeof(NodeType)];
+  };
+
+  /// @brief A slab of slots allocated in one block from the heap.
+  struct Slab
+  {
+    Slot* slots;
+    int slabSize;
+  };
+
+  /// @brief all of the slabs currently owned by the pool, the last slab
+  ///   is the one new slots are carved from
+  vector<Slab> slabs;
+
+  /// @brief number of slots of the last slab that have not yet been
+  ///   handed out
+  int unusedCount;
+
+  /// @brief the front of the list of slots that were given back
+  Slot* freeList;
+
+  /// @brief the number of nodes currently handed out by the pool
+  int liveCount;
+
+  // private member methods for managing the pool internally
+  int nextSlabSize() const;
+  void allocateSlab(int slabSize);
+};
+
+// template member definitions
+#include "NodePool.ipp"
+
+#endif // define _NODEPOOL_HPP_
@@ -0,0 +1,282 @@
+/** @file NodePool.ipp
+ * @brief Slab based pool allocator for the nodes of linked lists.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implementation of the NodePool.  Slabs start out small so that short
+ * lists do not waste memory, and double in size up to a maximum as the
+ * pool keeps needing more nodes.  Allocation takes a slot from the free
+ * list if there is one, otherwise the next unused slot of the newest
+ * slab, so both allocation and deallocation are O(1).
+ *
+ * This file is included at the end of NodePool.hpp and is not compiled
+ * on its own.
+ */
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+using namespace std;
+
+/** @brief Default constructor
+ *
+ * Construct an empty pool.  No slabs are allocated until the first
+ * node is requested.
+ */
+template<class NodeType>
+NodePool<NodeType>::NodePool()
+{
+  unusedCount = 0;
+  freeList = nullptr;
+  liveCount = 0;
+}
+
+/** @brief Move constructor
+ *
+ * Construct this pool by taking over the slabs of the given pool, which
+ * is left as an empty pool.  Nodes handed out by the other pool now
+ * belong to this pool and must be given back to it.
+ *
+ * @param pool The other pool whose slabs we are to take over.
+ */
+template<class NodeType>
+NodePool<NodeType>::NodePool(NodePool<NodeType>&& pool) noexcept
+  : slabs(move(pool.slabs))
+{
+  unusedCount = pool.unusedCount;
+  freeList = pool.freeList;
+  liveCount = pool.liveCount;
+
+  pool.slabs.clear();
+  pool.unusedCount = 0;
+  pool.freeList = nullptr;
+  pool.liveCount = 0;
+}
+
+/** @brief Class destructor
+ *
+ * Give all of the slabs of the pool back to the heap.  Any nodes
+ * still living in the pool must already have been destroyed.
+ */
+template<class NodeType>
+NodePool<NodeType>::~NodePool()
+{
+  release();
+}
+
+/** @brief Move assignment operator
+ *
+ * Give back the slabs of this pool and take over the slabs of the
+ * right hand side pool, which is left as an empty pool.
+ *
+ * @param rhs The other pool whose slabs we are to take over.
+ *
+ * @returns NodePool<NodeType>& Returns a reference to this pool after
+ *   the assignment.
+ */
+template<class NodeType>
+NodePool<NodeType>& NodePool<NodeType>::operator=(NodePool<NodeType>&& rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    release();
+
+    slabs = move(rhs.slabs);
+    unusedCount = rhs.unusedCount;
+    freeList = rhs.freeList;
+    liveCount = rhs.liveCount;
+
+    rhs.slabs.clear();
+    rhs.unusedCount = 0;
+    rhs.freeList = nullptr;
+    rhs.liveCount = 0;
+  }
+
+  return *this;
+}
+
+/** @brief Slab count accessor
+ *
+ * Accessor method to get the number of slabs the pool currently
+ * holds from the heap.
+ *
+ * @returns int Returns the number of slabs of the pool.
+ */
+template<class NodeType>
+int NodePool<NodeType>::getSlabCount() const
+{
+  return slabs.size();
+}
+
+/** @brief Capacity accessor
+ *
+ * Accessor method to get the total number of nodes that fit in all
+ * of the slabs of the pool.
+ *
+ * @returns int Returns the number of node slots of the pool.
+ */
+template<class NodeType>
+int NodePool<NodeType>::getCapacity() const
+{
+  int capacity = 0;
+  for (const Slab& slab : slabs)
+  {
+    capacity += slab.slabSize;
+  }
+  return capacity;
+}
+
+/** @brief Live count accessor
+ *
+ * Accessor method to get the number of nodes that have been handed
+ * out by the pool and not yet given back.
+ *
+ * @returns int Returns the number of live nodes of the pool.
+ */
+template<class NodeType>
+int NodePool<NodeType>::getLiveCount() const
+{
+  return liveCount;
+}
+
+/** @brief Allocate node
+ *
+ * Hand out raw memory for one node.  A slot given back earlier is
+ * reused first, otherwise the next unused slot of the newest slab is
+ * carved off, allocating a new slab when the newest one is used up.
+ * No node is constructed, the caller constructs the node in place.
+ *
+ * @returns NodeType* Returns a pointer to uninitialized memory for a node.
+ */
+template<class NodeType>
+NodeType* NodePool<NodeType>::allocate()
+{
+  Slot* slot;
+  if (freeList != nullptr)
+  {
+    // reuse the most recently freed slot
+    slot = freeList;
+    freeList = freeList->nextFree;
+  }
+  else
+  {
+    if (unusedCount == 0)
+    {
+      allocateSlab(nextSlabSize());
+    }
+
+    // carve the next unused slot off of the newest slab
+    const Slab& slab = slabs.back();
+    slot = slab.slots + (slab.slabSize - unusedCount);
+    unusedCount--;
+  }
+
+  liveCount++;
+  return reinterpret_cast<NodeType*>(slot->node);
+}
+
+/** @brief Deallocate node
+ *
+ * Give the memory of a node back to the pool by pushing it onto the
+ * free list.  The node must have been handed out by this pool, and
+ * must already have been destroyed.
+ *
+ * @param node The node whose memory is given back to the pool.
+ */
+template<class NodeType>
+void NodePool<NodeType>::deallocate(NodeType* node)
+{
+  Slot* slot = reinterpret_cast<Slot*>(node);
+  slot->nextFree = freeList;
+  freeList = slot;
+  liveCount--;
+}
+
+/** @brief Release all memory
+ *
+ * Give all of the slabs of the pool back to the heap at once, leaving
+ * an empty pool.  All nodes handed out by the pool must already have
+ * been destroyed, so a list can destroy its values and then release
+ * the memory of all of its nodes with a handful of deallocations.
+ */
+template<class NodeType>
+void NodePool<NodeType>::release()
+{
+  for (const Slab& slab : slabs)
+  {
+    allocator<Slot>().deallocate(slab.slots, slab.slabSize);
+  }
+
+  slabs.clear();
+  unusedCount = 0;
+  freeList = nullptr;
+  liveCount = 0;
+}
+
+/** @brief Reserve nodes
+ *
+ * Make sure the pool can hand out the given number of nodes without
+ * going back to the heap more than once.  If the newest slab does not
+ * have that many unused slots left, a single slab of exactly count
+ * slots is allocated, no matter the maximum slab size, so that a list
+ * of a known size gets all of its nodes from one block of memory.  The
+ * unused slots of the slab that was newest before are not handed out
+ * again until the pool is released, so this is best called on an
+ * empty pool.
+ *
+ * @param count The number of nodes that are about to be allocated.
+ */
+template<class NodeType>
+void NodePool<NodeType>::reserve(int count)
+{
+  if (count > unusedCount)
+  {
+    allocateSlab(count);
+  }
+}
+
+/** @brief Next slab size
+ *
+ * Private member method to decide the size of the next slab.  The
+ * first slab is small, each following slab is double the size of the
+ * last, up to the maximum slab size.
+ *
+ * @returns int Returns the number of slots of the next slab.
+ */
+template<class NodeType>
+int NodePool<NodeType>::nextSlabSize() const
+{
+  if (slabs.empty())
+  {
+    return INITIAL_SLAB_SIZE;
+  }
+
+  return min(2 * slabs.back().slabSize, static_cast<int>(MAX_SLAB_SIZE));
+}
+
+/** @brief Allocate slab
+ *
+ * Private member method to get a new slab of slots from the heap,
+ * which becomes the slab new slots are carved from.
+ *
+ * @param slabSize The number of slots of the new slab.
+ */
+template<class NodeType>
+void NodePool<NodeType>::allocateSlab(int slabSize)
+{
+  // make room to remember the slab before allocating it, so we can not
+  // lose track of the slab if growing the vector throws
+  if (slabs.size() == slabs.capacity())
+  {
+    slabs.reserve(2 * slabs.size() + 1);
+  }
+  Slab slab;
+  slab.slots = allocator<Slot>().allocate(slabSize);
+  slab.slabSize = slabSize;
+  slabs.push_back(slab);
+  unusedCount = slabSize;
+}
@@ -0,0 +1,218 @@
+/** @file RList.hpp
+ * @brief Concrete ring buffer based implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using a growable circular buffer.
+ * Like the AList, values are kept in a dynamically allocated block of
+ * memory that doubles in size when it becomes full.  But the front of
+ * the list is not fixed at index 0 of the block, the list can wrap
+ * around the end of the block back to its beginning.  Thus insertion
+ * and removal at both the front and the back of the list are O(1)
+ * (amortized for insertion), and indexing is still O(1).  Insertion
+ * or removal in the middle still requires shifting of items, but we
+ * only ever need to shift the shorter side of the list.
+ */
+#ifndef _RLIST_HPP_
+#define _RLIST_HPP_
+#include "List.hpp"
+#include "RListIterator.hpp"
+#include <new>
+#include <string>
+#include <utility>
+using namespace std;
+
+/** @class RList
+ * @brief The RList concrete ring buffer based implemention of the
+ *   List interface.
+ *
+ * Concrete implementation of List abstraction using a circular
+ * array based implementation.
+ */
+template<class T>
+class RList : public List<T>
+{
+public:
+  // constructors and destructors
+  RList();                              // default constructor
+  RList(int size, T values[]);          // array based constructor
+  RList(const RList<T>& otherList);     // copy constructor
+  RList(RList<T>&& otherList) noexcept; // move constructor
+  ~RList();                             // destructor
+
+  // assignment operators
+  RList<T>& operator=(const RList<T>& rhs);
+  RList<T>& operator=(RList<T>&& rhs) noexcept;
+
+  // accessor and information methods
+  int getAllocationSize() const;
+  T getFront() const;
+  T getBack() const;
+  bool operator==(const List<T>& rhs) const;
+  T& operator[](int index) const;
+
+  // adding, accessing and removing values from the list
+  void clear();
+  List<T>& insertBack(const T& value);
+  List<T>& insertBack(T&& value);
+  List<T>& operator>>(const T& value);
+  void deleteBack();
+  List<T>& insertFront(const T& value);
+  List<T>& insertFront(T&& value);
+  List<T>& operator<<(const T& value);
+  void deleteFront();
+  void deleteValue(const T& value);
+  void deleteIndex(int index);
+  List<T>& insertAt(int index, const T& value);
+  List<T>& insertAt(int index, T&& value);
+
+  // constructing new values directly in the list storage
+  template<class... Args>
+  T& emplaceBack(Args&&... args);
+  template<class... Args>
+  T& emplaceFront(Args&&... args);
+
+  // iterating over list the C++ way, using forward iterator objects
+  // and supporting range based iteration and <algorithm>
+  using value_type = T;
+  using iterator = RListIterator<T>;
+  using const_iterator = RListIterator<const T>;
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+protected:
+  // writing values out to a stream, indexing our own values directly
+  void writeValues(ListWriter<T>& writer, int first, int count) const;
+
+private:
+  /// @brief private constant, initial allocation size for empty lists
+  ///   to grow to
+  const int INITIAL_ALLOCATION_SIZE = 10;
+
+  /// @brief the current amount of allocated memory being
+  ///   managed by/for this list of values
+  int allocationSize;
+
+  /// @brief the index into the block of values where the front
+  ///   value of the list currently lives
+  int frontIndex;
+
+  /// @brief The circular block of values.  The list occupies size
+  ///   slots beginning at frontIndex, wrapping around to index 0
+  ///   when it passes the end of the block.  The block is raw storage,
+  ///   only the slots occupied by the list hold constructed values.
+  T* values;
+
+  // private member methods for managing the List internally
+  int slot(int index) const;
+  void growListIfNeeded();
+  void copyValues(const T* source, int count);
+  static T* allocateValues(int allocationSize);
+  static void deallocateValues(T* values, int allocationSize);
+};
+
+/** @brief Map list index to block slot
+ *
+ * Private helper to find the slot in our circular block of values that
+ * holds the value at the given index of the list.  The list can wrap
+ * around the end of the block, so we subtract the allocation size
+ * instead of using the more expensive modulus operator.
+ *
+ * @param index The index into the list, from 0 up to the allocation size.
+ *
+ * @returns int Returns the slot in the block of values for the index.
+ */
+template<class T>
+inline int RList<T>::slot(int index) const
+{
+  int slot = frontIndex + index;
+  if (slot >= allocationSize)
+  {
+    slot -= allocationSize;
+  }
+  return slot;
+}
+
+/** @brief Emplace value on back
+ *
+ * Construct a new value at the end of this List from the given
+ * constructor arguments.  The arguments are perfectly forwarded to
+ * the constructor of T, so an rvalue argument is moved rather than
+ * copied into the list.
+ *
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns T& Returns a reference to the newly constructed value now
+ *   at the back of this list.
+ */
+template<class T>
+template<class... Args>
+T& RList<T>::emplaceBack(Args&&... args)
+{
+  if (this->size < allocationSize)
+  {
+    // there is room, construct the value directly in the next free slot
+    new (values + slot(this->size)) T(forward<Args>(args)...);
+  }
+  else
+  {
+    // construct the value before growing, the arguments may refer to
+    // values in our current block of memory
+    T value(forward<Args>(args)...);
+    growListIfNeeded();
+    new (values + slot(this->size)) T(move(value));
+  }
+  this->size++;
+
+  return values[slot(this->size - 1)];
+}
+
+/** @brief Emplace value on front
+ *
+ * Construct a new value at the beginning of this List from the given
+ * constructor arguments.  The front of the list simply moves back by
+ * one slot, wrapping around to the end of the block if needed, so no
+ * values are shifted and this is an O(1) operation.
+ *
+ * @param args The arguments to forward to the constructor of T.
+ *
+ * @returns T& Returns a reference to the newly constructed value now
+ *   at the front of this list.
+ */
+template<class T>
+template<class... Args>
+T& RList<T>::emplaceFront(Args&&... args)
+{
+  if (this->size < allocationSize)
+  {
+    // there is room, construct the value directly in the slot before the front
+    int newFront = (frontIndex == 0 ? allocationSize : frontIndex) - 1;
+    new (values + newFront) T(forward<Args>(args)...);
+    frontIndex = newFront;
+  }
+  else
+  {
+    // construct the value before growing, the arguments may refer to
+    // values in our current block of memory
+    T value(forward<Args>(args)...);
+    growListIfNeeded();
+    frontIndex = allocationSize - 1;
+    new (values + frontIndex) T(move(value));
+  }
+  this->size++;
+
+  return values[frontIndex];
+}
+
+// template member definitions
+#include "RList.ipp"
+
+#endif // define _RLIST_HPP_
@@ -0,0 +1,932 @@
+/** @file RList.ipp
+ * @brief Concrete ring buffer based implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using a growable circular buffer.
+ * The list occupies a run of slots of a dynamically allocated block
+ * of memory beginning at the front index, and wraps around the end of
+ * the block back to slot 0.  Inserting or removing at either end
+ * only moves the front index or the size, so these are O(1), though
+ * insertion takes O(n) relocations and a memory allocation if the
+ * block needs to grow.  Removing from the middle shifts whichever
+ * side of the removed value is shorter.
+ *
+ * This file is included at the end of RList.hpp and is not compiled on
+ * its own.
+ */
+#include "ListException.hpp"
+#include "RListIterator.hpp"
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/** @brief Default constructor
+ *
+ * Construct an empty list.  The empty list will have no allocated memory
+ * nor any values.
+ */
+template<class T>
+RList<T>::RList()
+{
+  // Empty list has no values nor any allocated memory
+  // associated with it
+  this->size = 0;
+  allocationSize = 0;
+  frontIndex = 0;
+  values = nullptr;
+}
+
+/** @brief Standard constructor
+ *
+ * Construct a list of values from a (statically) defined and provided
+ * array of values.  We simply allocate a block of memory dynamically
+ * large enough to hold the values, then copy the values from the input
+ * parameter into our own block of values, with the front of the list
+ * at the beginning of the block.
+ *
+ * @param size The size of the input values were are given as well as the
+ *   size of the new list we are to construct.
+ * @param values The (static) array of values to use to construct
+ *   this List values with.
+ */
+template<class T>
+RList<T>::RList(int size, T values[])
+{
+  this->size = 0;
+  allocationSize = size;
+  frontIndex = 0;
+  this->values = allocateValues(allocationSize);
+
+  // copy construct the values from the input paramter into our new block
+  copyValues(values, size);
+}
+
+/** @brief Copy constructor
+ *
+ * Provide a copy constructor for the RList class, making a copy of
+ * the values from the given input list into a new RList instance.
+ * The copy is unwrapped, the front of the new list is at the beginning
+ * of its block, and the block is exactly large enough for the values.
+ *
+ * @param list The other List type we are to make a copy of in this
+ *   constructor.
+ */
+template<class T>
+RList<T>::RList(const RList<T>& list)
+{
+  this->size = 0;
+  allocationSize = list.size;
+  frontIndex = 0;
+  values = allocateValues(allocationSize);
+
+  // the other list is at most 2 runs of values, from its front up to the
+  // end of its block, then wrapping around from slot 0
+  int firstRun = list.size;
+  if (list.frontIndex + firstRun > list.allocationSize)
+  {
+    firstRun = list.allocationSize - list.frontIndex;
+  }
+  copyValues(list.values + list.frontIndex, firstRun);
+  copyValues(list.values, list.size - firstRun);
+}
+
+/** @brief Move constructor
+ *
+ * Construct this list by taking over the block of memory of the
+ * given list, which is left as an empty list.  No values are
+ * copied.
+ *
+ * @param list The other List whose values we are to take over.
+ */
+template<class T>
+RList<T>::RList(RList<T>&& list) noexcept
+{
+  // take over the values and allocation of the other list
+  this->size = list.size;
+  allocationSize = list.allocationSize;
+  frontIndex = list.frontIndex;
+  values = list.values;
+
+  // the other list is now empty and no longer owns the memory
+  list.size = 0;
+  list.allocationSize = 0;
+  list.frontIndex = 0;
+  list.values = nullptr;
+}
+
+/** @brief Class destructor
+ *
+ * Destructor for the List class.  Invoke the clear of this concrete
+ * class to destroy the values and deallocate the block of memory.
+ */
+template<class T>
+RList<T>::~RList()
+{
+  // call clear to do actual work to deallocate any allocation
+  // before we destruct
+  this->clear();
+}
+
+/** @brief Copy assignment operator
+ *
+ * Replace the values of this list with a copy of the values of
+ * the right hand side list.  The copy is made first, so that
+ * this list is left unchanged if the copy fails.
+ *
+ * @param rhs The other List we are to make a copy of.
+ *
+ * @returns RList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+RList<T>& RList<T>::operator=(const RList<T>& rhs)
+{
+  if (this != &rhs)
+  {
+    // copy into a temporary then move the copy into this list
+    RList<T> copy(rhs);
+    *this = move(copy);
+  }
+
+  return *this;
+}
+
+/** @brief Move assignment operator
+ *
+ * Release the values of this list and take over the block of
+ * memory of the right hand side list, which is left as an
+ * empty list.
+ *
+ * @param rhs The other List whose values we are to take over.
+ *
+ * @returns RList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+RList<T>& RList<T>::operator=(RList<T>&& rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    // give back our own memory before taking over the other list
+    clear();
+
+    this->size = rhs.size;
+    allocationSize = rhs.allocationSize;
+    frontIndex = rhs.frontIndex;
+    values = rhs.values;
+
+    rhs.size = 0;
+    rhs.allocationSize = 0;
+    rhs.frontIndex = 0;
+    rhs.values = nullptr;
+  }
+
+  return *this;
+}
+
+/** @brief Allocation size accessor
+ *
+ * Accessor method to get the current amount of memory allocated
+ * by and being managed by this list.
+ *
+ * @returns int Returns the current allocation size of the
+ *   list of values.
+ */
+template<class T>
+int RList<T>::getAllocationSize() const
+{
+  return allocationSize;
+}
+
+/** @brief Access front of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the front of this list.
+ *
+ * @returns T Returns a copy of the front item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access front item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T RList<T>::getFront() const
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("RList::getFront", this->size);
+  }
+
+  // otherwise safe to return the front item
+  return values[frontIndex];
+}
+
+/** @brief Access back of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the back of this list.
+ *
+ * @returns T Returns a copy of the back item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access back item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T RList<T>::getBack() const
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("RList::getBack", this->size);
+  }
+
+  // otherwise safe to return the back item
+  return values[slot(this->size - 1)];
+}
+
+/** @brief Write values to stream
+ *
+ * Write the given range of values to the output stream, separated by a
+ * comma and a space, indexing its ring of values directly rather than
+ * going through operator[] for each value.
+ *
+ * @param writer The stream or string to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write, at least 1.
+ */
+template<class T>
+void RList<T>::writeValues(ListWriter<T>& writer, int first, int count) const
+{
+  writer.writeValue(values[slot(first)]);
+  for (int index = first + 1; index < first + count; index++)
+  {
+    writer.writeText(", ");
+    writer.writeValue(values[slot(index)]);
+  }
+}
+
+/** @brief Boolean equals operator
+ *
+ * Check if this List is equal to the right hand side (rhs)
+ * list.  The lists are equal if their sizes are equal, and if
+ * all elements in both lists are equal.
+ * The comparison is done by List<T>::equals(), using whichever
+ * list is able to walk through its values fastest.
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this List to.
+ *
+ * @returns bool true if the lists are equal, false if the are not.
+ */
+template<class T>
+bool RList<T>::operator==(const List<T>& rhs) const
+{
+  // the list that can walk through its own values does the comparing
+  return this->equals(rhs);
+}
+
+/** @brief Indexing operator
+ *
+ * Provide a way to index individual values of the list.  The list
+ * index is mapped to its slot in the circular block, so this is
+ * still an O(1) operation.  We also provide bounds checking to ensure
+ * no illegal access beyond the list bounds is attempted.
+ *
+ * @param index The index of the value it is desired to access from
+ *   this List.
+ *
+ * @returns T& Returns a reference to the requested List item at
+ *   the requested index.
+ *
+ * @throws ListMemoryBoundsException if a request for an index beyond
+ *   the end of the list (or less than 0) is made.
+ */
+template<class T>
+T& RList<T>::operator[](int index) const
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("RList::operator[]", this->size, index);
+  }
+
+  // otherwise it is safe to return the reference to this value
+  return values[slot(index)];
+}
+
+/** @brief Clear out list
+ *
+ * Clear or empty out the list.  Return the list back
+ * to an empty list.
+ */
+template<class T>
+void RList<T>::clear()
+{
+  // destroy the live values, which may wrap around the end of the block
+  for (int index = 0; index < this->size; index++)
+  {
+    values[slot(index)].~T();
+  }
+
+  // if values is not null, it points to a dynamic block of memory, so
+  // deallocate that block.
+  if (values != nullptr)
+  {
+    deallocateValues(values, allocationSize);
+    values = nullptr;
+  }
+
+  // make sure size and allocation are both reading as 0 now
+  this->size = 0;
+  allocationSize = 0;
+  frontIndex = 0;
+}
+
+/** @brief Insert value on back
+ *
+ * Append the indicated value to the end of this List of values.  This
+ * method will grow the list allocation if needed to accomodate
+ * appending the new value.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& RList<T>::insertBack(const T& value)
+{
+  emplaceBack(value);
+  return *this;
+}
+
+/** @brief Insert moved value on back
+ *
+ * Append the indicated value to the end of this List of values,
+ * moving the value into the list instead of copying it.
+ *
+ * @param value The value to move onto the end of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& RList<T>::insertBack(T&& value)
+{
+  emplaceBack(move(value));
+  return *this;
+}
+
+/** @brief Overload operator>> to append
+ *
+ * Overload the operator>> to perform append operation.  Implementation
+ * is actually done by the insertBack() member function.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& RList<T>::operator>>(const T& value)
+{
+  return insertBack(value);
+}
+
+/** @brief Delete back item
+ *
+ * Delete the item from the back of the list.  This is an O(1)
+ * operation, the back value is destroyed and the size reduced.
+ */
+template<class T>
+void RList<T>::deleteBack()
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("RList::deleteBack", this->size);
+  }
+
+  // destroy the back value and reduce size by 1
+  values[slot(this->size - 1)].~T();
+  this->size -= 1;
+}
+
+/** @brief Insert value on front
+ *
+ * Prepend the indicated value to the beginning of this List of values.
+ * Unlike the AList no values need to be shifted, the front of the list
+ * simply moves back 1 slot in the circular block.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& RList<T>::insertFront(const T& value)
+{
+  emplaceFront(value);
+  return *this;
+}
+
+/** @brief Insert moved value on front
+ *
+ * Prepend the indicated value to the beginning of this List of
+ * values, moving the value into the list instead of copying it.
+ *
+ * @param value The value to move onto the beginning of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& RList<T>::insertFront(T&& value)
+{
+  emplaceFront(move(value));
+  return *this;
+}
+
+/** @brief Overload operator<< to prepend
+ *
+ * Overload the operator<< to perform prepend operation.  Implementation
+ * is actually done by the insertFront() member function.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& RList<T>::operator<<(const T& value)
+{
+  return insertFront(value);
+}
+
+/** @brief Delete front item
+ *
+ * Delete the item from the front of the list.  The front value is
+ * destroyed and the front of the list moves up 1 slot in the circular
+ * block, so this is an O(1) operation.
+ */
+template<class T>
+void RList<T>::deleteFront()
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("RList::deleteFront", this->size);
+  }
+
+  // destroy the front value and advance the front to the next slot
+  values[frontIndex].~T();
+  frontIndex = slot(1);
+  this->size -= 1;
+}
+
+/** @brief Delete value(s)
+ *
+ * Delete the value from the list.  This method will delete all
+ * instances of the value from this list that it finds.  If the list
+ * does not conatin the value, then an exception is thrown.  The values
+ * are removed in a single O(n) pass around the ring, each value that
+ * is kept is moved towards the front at most once to close up the
+ * holes left by removed values.
+ *
+ * @param value The value to deleted from this list.
+ *
+ * @throws ListValueNotFoundException If we are asked to delete a value
+ *   that does not exist, we thrown an exception instead of silently
+ *   ignoring this condition.
+ */
+template<class T>
+void RList<T>::deleteValue(const T& value)
+{
+  // kept is the number of values kept so far, they live in the
+  // slots of the first kept indexes of the list
+  int kept = 0;
+  for (int index = 0; index < this->size; index++)
+  {
+    if (values[slot(index)] == value)
+    {
+      continue;
+    }
+
+    // close up any hole left by removed values
+    if (kept != index)
+    {
+      values[slot(kept)] = move(values[slot(index)]);
+    }
+    kept++;
+  }
+
+  // if we didn't find a value to delete, let the caller know there
+  // may have been a problem
+  if (kept == this->size)
+  {
+    throw ListValueNotFoundException("RList::deleteValue", value);
+  }
+
+  // the slots past the kept values were moved from or removed
+  for (int index = kept; index < this->size; index++)
+  {
+    values[slot(index)].~T();
+  }
+  this->size = kept;
+}
+
+/** @brief Delete value at index
+ *
+ * Delete the value from the indicated index in this list.  The values
+ * on the shorter side of the index are shifted over the removed value,
+ * so removal is O(1) near either end and at worst O(n/2) in the middle.
+ *
+ * @param index The index of the value in the list to be removed.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+void RList<T>::deleteIndex(int index)
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("RList::deleteIndex", this->size, index);
+  }
+
+  if (index < this->size / 2)
+  {
+    // closer to the front, shift the front values up by 1 index
+    for (; index > 0; index--)
+    {
+      values[slot(index)] = move(values[slot(index - 1)]);
+    }
+
+    // the old front slot was moved from and is no longer live
+    values[frontIndex].~T();
+    frontIndex = slot(1);
+  }
+  else
+  {
+    // closer to the back, shift the back values down by 1 index
+    for (; index < this->size - 1; index++)
+    {
+      values[slot(index)] = move(values[slot(index + 1)]);
+    }
+
+    // the old back slot was moved from and is no longer live
+    values[slot(this->size - 1)].~T();
+  }
+
+  // update size of the list after removing 1 item
+  this->size--;
+}
+
+/** @brief Insert value at index
+ *
+ * Insert the indicated value into this list so that it ends up at the
+ * given index.  The values on the shorter side of the index are shifted
+ * to make room, so insertion is O(1) near either end and at worst O(n/2)
+ * in the middle.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to insert into the list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& RList<T>::insertAt(int index, const T& value)
+{
+  return insertAt(index, T(value));
+}
+
+/** @brief Insert moved value at index
+ *
+ * Insert the indicated value into this list at the given index,
+ * moving the value into the list instead of copying it.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to move into the list.
+ *
+ * @returns List& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& RList<T>::insertAt(int index, T&& value)
+{
+  // the index can be 1 past the back, which appends the value
+  if ((index < 0) or (index > this->size))
+  {
+    throw ListMemoryBoundsException("RList::insertAt", this->size, index);
+  }
+
+  if (index == 0)
+  {
+    emplaceFront(move(value));
+    return *this;
+  }
+  if (index == this->size)
+  {
+    emplaceBack(move(value));
+    return *this;
+  }
+
+  // take the value before growing, it may refer to a value in our
+  // current block of memory
+  T newValue(move(value));
+  growListIfNeeded();
+
+  if (index < this->size / 2)
+  {
+    // closer to the front, move the front back 1 slot and shift the
+    // values before the index down into it
+    frontIndex = (frontIndex == 0 ? allocationSize : frontIndex) - 1;
+    new (values + frontIndex) T(move(values[slot(1)]));
+    for (int current = 1; current < index; current++)
+    {
+      values[slot(current)] = move(values[slot(current + 1)]);
+    }
+  }
+  else
+  {
+    // closer to the back, shift the values from the index up by 1
+    new (values + slot(this->size)) T(move(values[slot(this->size - 1)]));
+    for (int current = this->size - 1; current > index; current--)
+    {
+      values[slot(current)] = move(values[slot(current - 1)]);
+    }
+  }
+  this->size++;
+  values[slot(index)] = move(newValue);
+
+  return *this;
+}
+
+/** @brief Begin iterator
+ *
+ * Create and return an iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns iterator returns a new forward iterator that keeps track
+ *   of iterating over the list items.
+ */
+template<class T>
+typename RList<T>::iterator RList<T>::begin()
+{
+  return iterator(0, frontIndex, allocationSize, values);
+}
+
+/** @brief End iterator
+ *
+ * Return an iterator pointing to one past the end of this list,
+ * which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns iterator returns a new forward iterator that points to
+ *   the end of the list.
+ */
+template<class T>
+typename RList<T>::iterator RList<T>::end()
+{
+  return iterator(this->size, frontIndex, allocationSize, values);
+}
+
+/** @brief Begin iterator of constant list
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename RList<T>::const_iterator RList<T>::begin() const
+{
+  return const_iterator(0, frontIndex, allocationSize, values);
+}
+
+/** @brief End iterator of constant list
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename RList<T>::const_iterator RList<T>::end() const
+{
+  return const_iterator(this->size, frontIndex, allocationSize, values);
+}
+
+/** @brief Constant begin iterator
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename RList<T>::const_iterator RList<T>::cbegin() const
+{
+  return const_iterator(0, frontIndex, allocationSize, values);
+}
+
+/** @brief Constant end iterator
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename RList<T>::const_iterator RList<T>::cend() const
+{
+  return const_iterator(this->size, frontIndex, allocationSize, values);
+}
+
+/** @brief Grow list allocation
+ *
+ * Private member method that will increase the memory allocation if
+ * the list is currently at capacity.  To do this, we double the
+ * current allocation and relocate the values in list order to the
+ * beginning of the new block, unwrapping the list so that its front
+ * is at slot 0 again.  If relocating a value throws, the list is
+ * left unchanged.
+ */
+template<class T>
+void RList<T>::growListIfNeeded()
+{
+  // if size is still less than what we have allocated, we still have room
+  // to grow at least one or more items in sizes
+  if (this->size < allocationSize)
+  {
+    return;
+  }
+
+  // otherwise size is equal to our allocation, double the size of our allocation
+  // to accommodate future growth, or make size 10 initially by default if
+  // an empty list is being grown
+  int newAllocationSize;
+  if (allocationSize == 0)
+  {
+    newAllocationSize = INITIAL_ALLOCATION_SIZE;
+  }
+  else
+  {
+    newAllocationSize = 2 * allocationSize;
+  }
+
+  // dynamically allocate a new block of raw memory of the new size
+  T* newValues = allocateValues(newAllocationSize);
+
+  // relocate the values in list order to the new block of memory, a
+  // trivially copyable value can simply have its bytes copied in at
+  // most 2 runs
+  if constexpr (is_trivially_copyable<T>::value)
+  {
+    if (this->size > 0)
+    {
+      int firstRun = allocationSize - frontIndex;
+      memcpy(newValues, values + frontIndex, sizeof(T) * firstRun);
+      memcpy(newValues + firstRun, values, sizeof(T) * (this->size - firstRun));
+    }
+  }
+  else
+  {
+    int index = 0;
+    try
+    {
+      for (; index < this->size; index++)
+      {
+        new (newValues + index) T(move_if_noexcept(values[slot(index)]));
+      }
+    }
+    catch (...)
+    {
+      // undo the partial relocation, the original values are still intact
+      destroy(newValues, newValues + index);
+      deallocateValues(newValues, newAllocationSize);
+      throw;
+    }
+
+    // we don't need the old values anymore
+    for (index = 0; index < this->size; index++)
+    {
+      values[slot(index)].~T();
+    }
+  }
+
+  // be good managers of memory and return the old block to the heap
+  if (values != nullptr)
+  {
+    deallocateValues(values, allocationSize);
+  }
+
+  // now make sure we are using the new block of memory going forward for this
+  // list, with the front of the list back at the beginning of the block
+  values = newValues;
+  allocationSize = newAllocationSize;
+  frontIndex = 0;
+}
+
+/** @brief Copy values onto back
+ *
+ * Private member method to copy construct the given values into the
+ * uninitialized slots following the back of this list.  This is only
+ * used by constructors while the list is not wrapped, and the
+ * allocation must already be large enough to hold the values.  If a
+ * copy throws, the list is cleared and our block of memory is given back.
+ *
+ * @param source The array of values to copy from.
+ * @param count The number of values to copy.
+ */
+template<class T>
+void RList<T>::copyValues(const T* source, int count)
+{
+  try
+  {
+    uninitialized_copy_n(source, count, values + this->size);
+  }
+  catch (...)
+  {
+    // uninitialized_copy_n already destroyed any partial copies
+    clear();
+    throw;
+  }
+  this->size += count;
+}
+
+/** @brief Allocate raw storage
+ *
+ * Private helper to allocate an uninitialized block of memory large
+ * enough to hold the requested number of values.  No values are
+ * constructed in the block.
+ *
+ * @param allocationSize The number of values the block should hold.
+ *
+ * @returns T* Returns a pointer to the new block, or nullptr when
+ *   an empty allocation is requested.
+ */
+template<class T>
+T* RList<T>::allocateValues(int allocationSize)
+{
+  if (allocationSize == 0)
+  {
+    return nullptr;
+  }
+
+  return allocator<T>().allocate(allocationSize);
+}
+
+/** @brief Deallocate raw storage
+ *
+ * Private helper to give a block of memory obtained from
+ * allocateValues() back to the heap.  Any values that were constructed
+ * in the block must already have been destroyed.
+ *
+ * @param values The block of memory to deallocate.
+ * @param allocationSize The number of values the block was allocated for.
+ */
+template<class T>
+void RList<T>::deallocateValues(T* values, int allocationSize)
+{
+  allocator<T>().deallocate(values, allocationSize);
+}
@@ -0,0 +1,83 @@
+/** @file RListIterator.hpp
+ * @brief Concrete Iterator for RList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Definition of concrete RListIterator to iterate over
+ * RList<T> instances.
+ */
+#ifndef _RLIST_ITERATOR_HPP_
+#define _RLIST_ITERATOR_HPP_
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+using namespace std;
+
+/** @class RListIterator
+ * @brief The forward iterator for ring buffer lists
+ *
+ * Iterate over the values of a RList<T> in list order, following
+ * the list as it wraps around the end of the circular block of values.
+ * An RListIterator<T> gives access to modify the values, an
+ * RListIterator<const T> is the const_iterator of the list and only
+ * gives read access.  These are standard iterators, so they work with
+ * range based iteration as well as with the <algorithm> library.
+ */
+template<class T>
+class RListIterator
+{
+public:
+  // standard iterator traits
+  using iterator_category = forward_iterator_tag;
+  using value_type = remove_const_t<T>;
+  using difference_type = ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  // constructors
+  RListIterator();
+  RListIterator(int index, int frontIndex, int allocationSize, T* values);
+  template<class U, class = enable_if_t<is_same<const U, T>::value>>
+  RListIterator(const RListIterator<U>& other);
+
+  // accessing the current value
+  reference operator*() const;
+  pointer operator->() const;
+
+  // moving the iterator
+  RListIterator<T>& operator++();
+  RListIterator<T> operator++(int);
+
+  // comparing iterators, mutable and const iterators can be mixed
+  template<class U>
+  bool operator==(const RListIterator<U>& rhs) const;
+  template<class U>
+  bool operator!=(const RListIterator<U>& rhs) const;
+
+private:
+  /// The RList<T> class copies the current pointer
+  ///   to the list values when this iterator is
+  ///   created
+  T* values;
+  /// The slot of the block of values holding the front of the list
+  int frontIndex;
+  /// The size of the circular block of values, where the list
+  ///   wraps back around to slot 0
+  int allocationSize;
+  /// Current index to the point we currently are at
+  ///   in iterating through this RList
+  int current;
+
+  // the const iterator is built from and compared to the mutable one
+  template<class U>
+  friend class RListIterator;
+};
+
+// template member definitions
+#include "RListIterator.ipp"
+
+#endif // define _RLIST_ITERATOR_HPP_
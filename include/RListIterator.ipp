@@ -0,0 +1,170 @@
+/** @file RListIterator.ipp
+ * @brief Concrete Iterator for RList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the standard forward iterator over concrete RList<T>
+ * instances.
+ *
+ * This file is included at the end of RListIterator.hpp and is not
+ * compiled on its own.
+ */
+#include <string>
+using namespace std;
+
+/** @brief Default constructor
+ *
+ * Default constructor, iterator will not be iterating over
+ * anything if constructed using the default constructor.
+ */
+template<class T>
+RListIterator<T>::RListIterator()
+{
+  values = nullptr;
+  frontIndex = 0;
+  allocationSize = 0;
+  current = -1;
+}
+
+/** @brief Standard constructor
+ *
+ * Standard constructor, the index parameter indicates beginning
+ * index of the list to begin iterating over.
+ *
+ * @param index The index of the list where we should start
+ *   iterating at.
+ * @param frontIndex The slot of the block of values that holds
+ *   the front of the list.
+ * @param allocationSize The size of the circular block of values.
+ * @param values The (pointer to) the block of values of the list.
+ *   We keep a copy of the start of the block for this iterator to use.
+ */
+template<class T>
+RListIterator<T>::RListIterator(int index, int frontIndex, int allocationSize, T* values)
+{
+  this->current = index;
+  this->frontIndex = frontIndex;
+  this->allocationSize = allocationSize;
+  this->values = values;
+}
+
+/** @brief Converting constructor
+ *
+ * A mutable iterator can be turned into a const iterator to the same
+ * value, but not the other way around.
+ *
+ * @param other The mutable iterator to convert.
+ */
+template<class T>
+template<class U, class>
+RListIterator<T>::RListIterator(const RListIterator<U>& other)
+{
+  this->current = other.current;
+  this->frontIndex = other.frontIndex;
+  this->allocationSize = other.allocationSize;
+  this->values = other.values;
+}
+
+/** @brief Overload dereference operator
+ *
+ * Overload the dereference operator* for the RListIterator.
+ * This method makes it easy/convenient to access the info
+ * that the iterator is currently pointing two.  This is the
+ * standard way that C++ accesses values during iteration of
+ * the container.
+ *
+ * @returns reference Returns a reference to the value currently being
+ *   pointed to by this iterator.
+ */
+template<class T>
+typename RListIterator<T>::reference RListIterator<T>::operator*() const
+{
+  // wrap around the end of the block back to slot 0
+  int slot = frontIndex + current;
+  if (slot >= allocationSize)
+  {
+    slot -= allocationSize;
+  }
+  return values[slot];
+}
+
+/** @brief Overload member access operator
+ *
+ * @returns pointer Returns a pointer to the value currently being
+ *   pointed to by this iterator.
+ */
+template<class T>
+typename RListIterator<T>::pointer RListIterator<T>::operator->() const
+{
+  return &**this;
+}
+
+/** @brief Overload pre increment operator
+ *
+ * Overload the pre increment operator++.  This is defined to cause the
+ * iterator to move to the next item in the list we are iterating over.
+ *
+ * @returns RListIterator<T>& We need to return ourself after incrementing
+ *   the iterator to the next value of the list we are iterating over.
+ */
+template<class T>
+RListIterator<T>& RListIterator<T>::operator++()
+{
+  current++;
+
+  return *this;
+}
+
+/** @brief Overload post increment operator
+ *
+ * @returns RListIterator<T> Returns a copy of ourself from before we
+ *   were moved to the next value.
+ */
+template<class T>
+RListIterator<T> RListIterator<T>::operator++(int)
+{
+  RListIterator<T> before(*this);
+  current++;
+
+  return before;
+}
+
+/** @brief Overload boolean equality operator
+ *
+ * Overload the boolean operator== to check for equivalence.  This is
+ * needed to create loops and test if we are done yet or not iterating
+ * over the list by testing if the iterator is == the end() iterator item.
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators are both pointing to the same
+ *   value of the iteration, false otherwise.
+ */
+template<class T>
+template<class U>
+bool RListIterator<T>::operator==(const RListIterator<U>& rhs) const
+{
+  return current == rhs.current;
+}
+
+/** @brief Overload boolean not equal operator
+ *
+ * Overload the boolean operator!= to check for nonequivalance.  This is
+ * needed to create loops and test if we are done yet or not iterating
+ * over the list by testing if the iterator is != the end() iterator item.
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators are not pointing to the same
+ *   value of the iteration, false otherwise.
+ */
+template<class T>
+template<class U>
+bool RListIterator<T>::operator!=(const RListIterator<U>& rhs) const
+{
+  return current != rhs.current;
+}
@@ -0,0 +1,56 @@
+/** @file SkipEntry.hpp
+ * @brief Definition of the SkipEntry class used by SkipIndex lanes.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Definition of SkipEntry class used by the SkipIndex positional
+ * index of LList linked lists.  Simplifies inclusion circular
+ * references to put this structure definition in its own file.
+ */
+#ifndef _SKIP_ENTRY_HPP_
+#define _SKIP_ENTRY_HPP_
+#include "Node.hpp"
+using namespace std;
+
+/** SkipEntry
+ * An entry of one of the express lanes of a SkipIndex.  The entry
+ * stands on a node of the linked list, and records how many nodes of
+ * the list it is to the node the next entry of the same lane stands
+ * on.  A node that has an entry in a lane has entries in all of the
+ * lanes below it as well.
+ */
+template<class T>
+struct SkipEntry
+{
+public:
+  /// @brief Construct an entry standing on the given node, on top of
+  ///   the entry for the same node in the lane below.
+  SkipEntry(Node<T>* node, SkipEntry<T>* down)
+    : node(node),
+      span(0),
+      next(nullptr),
+      down(down)
+  {
+  }
+
+  /// @brief the node of the linked list this entry stands on
+  Node<T>* node;
+
+  /// @brief the number of list nodes from the node of this entry to the
+  ///   node of the next entry of the lane, or 0 for the last entry
+  int span;
+
+  /// @brief the next entry of the same lane, or nullptr if this is
+  ///   the last entry of the lane
+  SkipEntry<T>* next;
+
+  /// @brief the entry for the same node in the lane below, or nullptr
+  ///   in the lowest lane
+  SkipEntry<T>* down;
+};
+
+#endif // define _SKIP_ENTRY_HPP_
@@ -0,0 +1,111 @@
+/** @file SkipIndex.hpp
+ * @brief Skip list positional index over the nodes of an LList.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Finding the node at an index of a singly linked list means walking
+ * the list from the front, which is O(n).  A SkipIndex adds express
+ * lanes on top of the linked list, like the levels of a skip list.
+ * Every node of the list gets an entry in the lowest lane with
+ * probability 1/4, every node in a lane gets an entry in the next lane
+ * up with probability 1/4, and so on.  Each entry records how many
+ * nodes it spans to the next entry of its lane, so a search can run
+ * along the top lane and drop down a lane whenever the next step would
+ * overshoot the index.  This finds the node at any index, and keeps
+ * the index up to date as nodes are inserted and removed, in expected
+ * O(log n).  The linked list itself is left exactly as it is.
+ */
+#ifndef _SKIP_INDEX_HPP_
+#define _SKIP_INDEX_HPP_
+#include "Node.hpp"
+#include "NodePool.hpp"
+#include "SkipEntry.hpp"
+using namespace std;
+
+/** @class SkipIndex
+ * @brief Express lanes over the nodes of a singly linked list.
+ *
+ * The index is told about every node inserted into or removed from the
+ * list, by the index of the node in the list.  A disabled index ignores
+ * all of this and finds nothing, so a list only pays for the index when
+ * it is enabled.  Inserting or removing the front node of the list
+ * does not touch any entries unless the node has entries of its own,
+ * so it stays O(1) in the expected case.
+ */
+template<class T>
+class SkipIndex
+{
+public:
+  /// @brief the number of nodes it is cheaper to just walk down the list
+  ///   than to search the lanes for
+  static const int SHORT_WALK = 8;
+
+  // constructors and destructors
+  SkipIndex();                                  // default constructor
+  SkipIndex(SkipIndex<T>&& index) noexcept;     // move constructor
+  SkipIndex(const SkipIndex<T>& index) = delete;
+  ~SkipIndex(); // destructor
+
+  // assignment operators
+  SkipIndex<T>& operator=(SkipIndex<T>&& rhs) noexcept;
+  SkipIndex<T>& operator=(const SkipIndex<T>& rhs) = delete;
+
+  // accessor and information methods
+  bool isEnabled() const;
+  int getLaneCount() const;
+  Node<T>* find(int index, int& nodeIndex) const;
+
+  // turning the index on and off
+  void enable(Node<T>* front);
+  void disable();
+
+  // keeping the index up to date as the list changes
+  void insert(int index, Node<T>* node);
+  void remove(int index);
+  void clear();
+
+private:
+  /// @brief the most lanes the index will ever have, enough for lists of
+  ///   4^16 nodes
+  static const int MAX_LANES = 16;
+
+  /// @brief true if the index is kept up to date and used
+  bool enabled;
+
+  /// @brief the number of lanes that currently have entries
+  int laneCount;
+
+  /// @brief the first entry of each lane
+  SkipEntry<T>* laneFront[MAX_LANES];
+
+  /// @brief the index of the node of the first entry of each lane,
+  ///   relative to frontShift
+  int laneFrontIndex[MAX_LANES];
+
+  /// @brief the number of nodes inserted at the front less the number
+  ///   removed, which moves the first entries of all lanes at once
+  int frontShift;
+
+  /// @brief the state of the pseudo random generator that decides how
+  ///   many lanes a new node gets entries in
+  unsigned int randomState;
+
+  /// @brief the pool that the memory for the entries comes from
+  NodePool<SkipEntry<T>> entryPool;
+
+  // private member methods for managing the lanes
+  int randomHeight();
+  int frontIndexOf(int lane) const;
+  void search(int limit, SkipEntry<T>* previous[], int previousIndex[]) const;
+  SkipEntry<T>* newEntry(Node<T>* node, SkipEntry<T>* down);
+  void deleteEntry(SkipEntry<T>* entry);
+};
+
+// template member definitions
+#include "SkipIndex.ipp"
+
+#endif // define _SKIP_INDEX_HPP_
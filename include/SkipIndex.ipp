@@ -0,0 +1,518 @@
+/** @file SkipIndex.ipp
+ * @brief Skip list positional index over the nodes of an LList.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implementation of the SkipIndex express lanes.  The lanes are kept
+ * with relative positions only: each entry knows the number of nodes
+ * to the next entry of its lane, and only the first entry of each lane
+ * knows its index in the list.  Inserting or removing a node only
+ * changes the span of the entry right before it in each lane, and the
+ * first entries of all lanes are moved together by frontShift when a
+ * node is inserted or removed at the front of the list.
+ *
+ * This file is included at the end of SkipIndex.hpp and is not
+ * compiled on its own.
+ */
+#include "Node.hpp"
+#include "SkipEntry.hpp"
+#include <algorithm>
+#include <new>
+#include <string>
+#include <utility>
+using namespace std;
+
+/** @brief Default constructor
+ *
+ * Construct a disabled index without any lanes.
+ */
+template<class T>
+SkipIndex<T>::SkipIndex()
+{
+  enabled = false;
+  laneCount = 0;
+  frontShift = 0;
+  randomState = 2463534242u;
+  fill(laneFront, laneFront + MAX_LANES, nullptr);
+  fill(laneFrontIndex, laneFrontIndex + MAX_LANES, 0);
+}
+
+/** @brief Move constructor
+ *
+ * Construct this index by taking over the lanes of the given index,
+ * which is left as a disabled index without any lanes.  The entry
+ * pool is moved along with the lanes, since the entries live in the
+ * memory it manages.
+ *
+ * @param index The other index whose lanes we are to take over.
+ */
+template<class T>
+SkipIndex<T>::SkipIndex(SkipIndex<T>&& index) noexcept
+  : entryPool(move(index.entryPool))
+{
+  enabled = index.enabled;
+  laneCount = index.laneCount;
+  frontShift = index.frontShift;
+  randomState = index.randomState;
+  copy(index.laneFront, index.laneFront + MAX_LANES, laneFront);
+  copy(index.laneFrontIndex, index.laneFrontIndex + MAX_LANES, laneFrontIndex);
+
+  index.enabled = false;
+  index.laneCount = 0;
+  index.frontShift = 0;
+  fill(index.laneFront, index.laneFront + MAX_LANES, nullptr);
+}
+
+/** @brief Class destructor
+ *
+ * The entries need no destruction, so the entry pool can just give
+ * their memory back to the heap.
+ */
+template<class T>
+SkipIndex<T>::~SkipIndex()
+{
+}
+
+/** @brief Move assignment operator
+ *
+ * Give back the entries of this index and take over the lanes of the
+ * right hand side index, which is left as a disabled index.
+ *
+ * @param rhs The other index whose lanes we are to take over.
+ *
+ * @returns SkipIndex<T>& Returns a reference to this index after the
+ *   assignment.
+ */
+template<class T>
+SkipIndex<T>& SkipIndex<T>::operator=(SkipIndex<T>&& rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    entryPool = move(rhs.entryPool);
+    enabled = rhs.enabled;
+    laneCount = rhs.laneCount;
+    frontShift = rhs.frontShift;
+    randomState = rhs.randomState;
+    copy(rhs.laneFront, rhs.laneFront + MAX_LANES, laneFront);
+    copy(rhs.laneFrontIndex, rhs.laneFrontIndex + MAX_LANES, laneFrontIndex);
+
+    rhs.enabled = false;
+    rhs.laneCount = 0;
+    rhs.frontShift = 0;
+    fill(rhs.laneFront, rhs.laneFront + MAX_LANES, nullptr);
+  }
+
+  return *this;
+}
+
+/** @brief Enabled accessor
+ *
+ * @returns bool Returns true if the index is kept up to date and used
+ *   to find nodes.
+ */
+template<class T>
+bool SkipIndex<T>::isEnabled() const
+{
+  return enabled;
+}
+
+/** @brief Lane count accessor
+ *
+ * @returns int Returns the number of express lanes the index
+ *   currently has.
+ */
+template<class T>
+int SkipIndex<T>::getLaneCount() const
+{
+  return laneCount;
+}
+
+/** @brief Find node near index
+ *
+ * Search the lanes for the node closest to the given index that has an
+ * entry of its own, without going past the index.  The caller walks
+ * the rest of the way down the list from there, which is only a few
+ * nodes in the expected case.
+ *
+ * @param index The index of the node that is wanted.
+ * @param nodeIndex Returns the index of the node that is found.
+ *
+ * @returns Node<T>* Returns the node found, or nullptr if the index is
+ *   disabled or no node at or before the index has an entry.
+ */
+template<class T>
+Node<T>* SkipIndex<T>::find(int index, int& nodeIndex) const
+{
+  if (not enabled or laneCount == 0)
+  {
+    return nullptr;
+  }
+
+  SkipEntry<T>* previous[MAX_LANES];
+  int previousIndex[MAX_LANES];
+  search(index + 1, previous, previousIndex);
+  if (previous[0] == nullptr)
+  {
+    return nullptr;
+  }
+
+  nodeIndex = previousIndex[0];
+  return previous[0]->node;
+}
+
+/** @brief Enable index
+ *
+ * Turn the index on, building the lanes for all of the nodes currently
+ * in the list in a single O(n) walk down the list.
+ *
+ * @param front The front node of the list to index.
+ */
+template<class T>
+void SkipIndex<T>::enable(Node<T>* front)
+{
+  clear();
+  enabled = true;
+
+  // the last entry of each lane, where the next entry is linked on
+  SkipEntry<T>* laneBack[MAX_LANES];
+  int laneBackIndex[MAX_LANES];
+
+  try
+  {
+    int index = 0;
+    for (Node<T>* node = front; node != nullptr; node = node->next)
+    {
+      int height = randomHeight();
+      SkipEntry<T>* below = nullptr;
+      for (int lane = 0; lane < height; lane++)
+      {
+        SkipEntry<T>* entry = newEntry(node, below);
+        if (lane < laneCount)
+        {
+          laneBack[lane]->next = entry;
+          laneBack[lane]->span = index - laneBackIndex[lane];
+        }
+        else
+        {
+          laneFront[lane] = entry;
+          laneFrontIndex[lane] = index;
+          laneCount++;
+        }
+        laneBack[lane] = entry;
+        laneBackIndex[lane] = index;
+        below = entry;
+      }
+      index++;
+    }
+  }
+  catch (const bad_alloc&)
+  {
+    // the list works without the index, it is just slower
+    disable();
+  }
+}
+
+/** @brief Disable index
+ *
+ * Turn the index off, giving back the memory of all of the entries.
+ */
+template<class T>
+void SkipIndex<T>::disable()
+{
+  clear();
+  enabled = false;
+}
+
+/** @brief Insert node
+ *
+ * Update the lanes for a node that was inserted into the list.  The
+ * node gets entries in a random number of lanes, linked in after the
+ * last entry before the index in each lane.  In lanes the node does not
+ * get an entry in, the entry before the index now spans one more node.
+ * Nothing has to change for a node inserted at the front that gets no
+ * entries, besides frontShift.  If there is not enough memory for the
+ * new entries the index disables itself.
+ *
+ * @param index The index of the inserted node in the list.
+ * @param node The node that was inserted.
+ */
+template<class T>
+void SkipIndex<T>::insert(int index, Node<T>* node)
+{
+  if (not enabled)
+  {
+    return;
+  }
+
+  int height = randomHeight();
+  if (index == 0 and height == 0)
+  {
+    frontShift++;
+    return;
+  }
+
+  SkipEntry<T>* previous[MAX_LANES];
+  int previousIndex[MAX_LANES];
+  search(index, previous, previousIndex);
+
+  try
+  {
+    SkipEntry<T>* below = nullptr;
+    for (int lane = 0; lane < max(laneCount, height); lane++)
+    {
+      // a new lane starts out empty
+      if (lane >= laneCount)
+      {
+        previous[lane] = nullptr;
+        previousIndex[lane] = -1;
+      }
+      SkipEntry<T>* before = previous[lane];
+
+      if (lane < height)
+      {
+        SkipEntry<T>* entry = newEntry(node, below);
+        if (before == nullptr)
+        {
+          entry->next = laneFront[lane];
+          if (entry->next != nullptr)
+          {
+            entry->span = frontIndexOf(lane) + 1 - index;
+          }
+          laneFront[lane] = entry;
+          laneFrontIndex[lane] = index - frontShift;
+        }
+        else
+        {
+          entry->next = before->next;
+          if (entry->next != nullptr)
+          {
+            entry->span = previousIndex[lane] + before->span + 1 - index;
+          }
+          before->next = entry;
+          before->span = index - previousIndex[lane];
+        }
+        below = entry;
+      }
+      else if (before == nullptr)
+      {
+        // the first entry of the lane is one node further back
+        if (laneFront[lane] != nullptr)
+        {
+          laneFrontIndex[lane]++;
+        }
+      }
+      else if (before->next != nullptr)
+      {
+        before->span++;
+      }
+    }
+    laneCount = max(laneCount, height);
+  }
+  catch (const bad_alloc&)
+  {
+    // the list works without the index, it is just slower
+    disable();
+  }
+}
+
+/** @brief Remove node
+ *
+ * Update the lanes for a node that is removed from the list.  Entries
+ * standing on the node are unlinked from their lanes, with the entry
+ * before them taking over their span.  In the other lanes the entry
+ * before the index now spans one node less.  Nothing has to change for
+ * a front node without entries, besides frontShift.
+ *
+ * @param index The index of the removed node in the list.
+ */
+template<class T>
+void SkipIndex<T>::remove(int index)
+{
+  if (not enabled)
+  {
+    return;
+  }
+
+  // a node with entries has one in the lowest lane
+  if (index == 0 and (laneCount == 0 or frontIndexOf(0) != 0))
+  {
+    frontShift--;
+    return;
+  }
+
+  SkipEntry<T>* previous[MAX_LANES];
+  int previousIndex[MAX_LANES];
+  search(index, previous, previousIndex);
+
+  for (int lane = 0; lane < laneCount; lane++)
+  {
+    SkipEntry<T>* before = previous[lane];
+    SkipEntry<T>* entry = (before == nullptr) ? laneFront[lane] : before->next;
+    if (entry == nullptr)
+    {
+      continue;
+    }
+
+    int entryIndex = (before == nullptr) ? frontIndexOf(lane) : previousIndex[lane] + before->span;
+    if (entryIndex == index)
+    {
+      // unlink the entry standing on the removed node
+      if (before == nullptr)
+      {
+        laneFront[lane] = entry->next;
+        laneFrontIndex[lane] = index + entry->span - 1 - frontShift;
+      }
+      else
+      {
+        before->next = entry->next;
+        before->span = (entry->next == nullptr) ? 0 : before->span + entry->span - 1;
+      }
+      deleteEntry(entry);
+    }
+    else if (before == nullptr)
+    {
+      laneFrontIndex[lane]--;
+    }
+    else
+    {
+      before->span--;
+    }
+  }
+
+  // drop lanes that no longer have any entries
+  while (laneCount > 0 and laneFront[laneCount - 1] == nullptr)
+  {
+    laneCount--;
+  }
+}
+
+/** @brief Clear index
+ *
+ * Remove all of the lanes, for a list that has been emptied.  The
+ * index stays enabled if it was.
+ */
+template<class T>
+void SkipIndex<T>::clear()
+{
+  entryPool.release();
+  laneCount = 0;
+  frontShift = 0;
+  fill(laneFront, laneFront + MAX_LANES, nullptr);
+}
+
+/** @brief Random height
+ *
+ * Private helper to decide how many lanes a new node gets entries in.
+ * Each pair of random bits that are both 0 adds a lane, so a node gets
+ * at least k lanes with probability 1/4^k.
+ *
+ * @returns int Returns the number of lanes, from 0 up to MAX_LANES.
+ */
+template<class T>
+int SkipIndex<T>::randomHeight()
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+
+  unsigned int bits = randomState;
+  int height = 0;
+  while (height < MAX_LANES and (bits & 3) == 0)
+  {
+    height++;
+    bits >>= 2;
+  }
+
+  return height;
+}
+
+/** @brief Front index of lane
+ *
+ * Private helper to get the index in the list of the node the first
+ * entry of the lane stands on.
+ *
+ * @param lane The lane, which must have a first entry.
+ *
+ * @returns int Returns the index of the first entry of the lane.
+ */
+template<class T>
+int SkipIndex<T>::frontIndexOf(int lane) const
+{
+  return laneFrontIndex[lane] + frontShift;
+}
+
+/** @brief Search lanes
+ *
+ * Private helper to find, in every lane, the last entry standing on a
+ * node with an index less than the limit.  The search starts on the
+ * top lane and runs along each lane as far as it can before dropping
+ * down to the next lane.
+ *
+ * @param limit The search stops before any node with this index or more.
+ * @param previous Returns the last entry before the limit for each
+ *   lane, or nullptr if the first entry of the lane is not before it.
+ * @param previousIndex Returns the index of the node of each entry
+ *   returned in previous.
+ */
+template<class T>
+void SkipIndex<T>::search(int limit, SkipEntry<T>* previous[], int previousIndex[]) const
+{
+  SkipEntry<T>* entry = nullptr;
+  int entryIndex = -1;
+  for (int lane = laneCount - 1; lane >= 0; lane--)
+  {
+    if (entry != nullptr)
+    {
+      entry = entry->down;
+    }
+    else if (laneFront[lane] != nullptr and frontIndexOf(lane) < limit)
+    {
+      entry = laneFront[lane];
+      entryIndex = frontIndexOf(lane);
+    }
+
+    // run along the lane while the next entry is still before the limit
+    while (entry != nullptr and entry->next != nullptr and entryIndex + entry->span < limit)
+    {
+      entryIndex += entry->span;
+      entry = entry->next;
+    }
+
+    previous[lane] = entry;
+    previousIndex[lane] = entryIndex;
+  }
+}
+
+/** @brief New entry
+ *
+ * Private helper to get memory for a new entry from the entry pool,
+ * and construct the entry in it.
+ *
+ * @param node The node the entry stands on.
+ * @param down The entry for the same node in the lane below.
+ *
+ * @returns SkipEntry<T>* Returns a pointer to the new entry.
+ */
+template<class T>
+SkipEntry<T>* SkipIndex<T>::newEntry(Node<T>* node, SkipEntry<T>* down)
+{
+  return new (entryPool.allocate()) SkipEntry<T>(node, down);
+}
+
+/** @brief Delete entry
+ *
+ * Private helper to give the memory of an unlinked entry back to the
+ * entry pool.
+ *
+ * @param entry The entry to delete.
+ */
+template<class T>
+void SkipIndex<T>::deleteEntry(SkipEntry<T>* entry)
+{
+  entry->~SkipEntry<T>();
+  entryPool.deallocate(entry);
+}
@@ -0,0 +1,331 @@
+/** @file StaticList.hpp
+ * @brief Statically dispatched facade over concrete List types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Every operation of the List<T> interface is virtual, so a call
+ * through a List<T>& goes through the vtable, and even a call on an
+ * AList<int> object usually does, since the compiler cannot be sure
+ * it is not really some subclass of AList.  A StaticList wraps a
+ * reference to a list of a known concrete type and calls the members
+ * of that exact type with a qualified name, which the compiler always
+ * compiles to a direct call, and can inline wherever the definition of
+ * the member is visible.  Code that is generic over the kind of list
+ * can be written as a template taking a StaticList<ListType>, while
+ * code that needs to pick the kind of list at run time keeps using
+ * List<T>&.
+ */
+#ifndef _STATIC_LIST_HPP_
+#define _STATIC_LIST_HPP_
+#include "List.hpp"
+#include <string>
+#include <utility>
+using namespace std;
+
+/** @class StaticList
+ * @brief Non-virtual view of a list of concrete type ListType.
+ *
+ * The ListType must be a concrete List that provides the standard
+ * value_type and iterator types, such as AList<T> and LList<T>.  The
+ * StaticList does not own the list, it only forwards to it, so it is
+ * cheap to copy and pass by value.
+ */
+template<class ListType>
+class StaticList
+{
+public:
+  // types of the wrapped list
+  using value_type = typename ListType::value_type;
+  using iterator = typename ListType::iterator;
+  using const_iterator = typename ListType::const_iterator;
+
+  // constructors
+  explicit StaticList(ListType& list);
+
+  // accessor and information methods
+  ListType& getList() const;
+  int getSize() const;
+  bool isEmpty() const;
+  value_type getFront() const;
+  value_type getBack() const;
+  string str() const;
+  value_type& operator[](int index) const;
+
+  // adding, accessing and removing values from the list
+  void clear() const;
+  const StaticList<ListType>& insertBack(const value_type& value) const;
+  const StaticList<ListType>& insertBack(value_type&& value) const;
+  void deleteBack() const;
+  const StaticList<ListType>& insertFront(const value_type& value) const;
+  const StaticList<ListType>& insertFront(value_type&& value) const;
+  void deleteFront() const;
+  void deleteValue(const value_type& value) const;
+  void deleteIndex(int index) const;
+  const StaticList<ListType>& insertAt(int index, const value_type& value) const;
+  const StaticList<ListType>& insertAt(int index, value_type&& value) const;
+
+  // iterating over the wrapped list
+  iterator begin() const;
+  iterator end() const;
+
+private:
+  /// @brief the concrete list all of the operations are forwarded to
+  ListType& list;
+};
+
+/** @brief Make static list
+ *
+ * Convenience function to wrap a concrete list in a StaticList,
+ * deducing the type of the list.
+ *
+ * @param list The concrete list to wrap.
+ *
+ * @returns StaticList<ListType> Returns the facade over the list.
+ */
+template<class ListType>
+inline StaticList<ListType> staticList(ListType& list)
+{
+  return StaticList<ListType>(list);
+}
+
+/** @brief Standard constructor
+ *
+ * Wrap the given concrete list.  The list must outlive the facade.
+ *
+ * @param list The concrete list that operations are forwarded to.
+ */
+template<class ListType>
+inline StaticList<ListType>::StaticList(ListType& list)
+  : list(list)
+{
+}
+
+/** @brief List accessor
+ *
+ * @returns ListType& Returns the wrapped concrete list.
+ */
+template<class ListType>
+inline ListType& StaticList<ListType>::getList() const
+{
+  return list;
+}
+
+/** @brief Size accessor
+ *
+ * @returns int Returns the current size of the wrapped list.
+ */
+template<class ListType>
+inline int StaticList<ListType>::getSize() const
+{
+  return list.getSize();
+}
+
+/** @brief Check if empty list
+ *
+ * @returns bool Returns true if the wrapped list is empty.
+ */
+template<class ListType>
+inline bool StaticList<ListType>::isEmpty() const
+{
+  return list.isEmpty();
+}
+
+/** @brief Access front of list
+ *
+ * @returns value_type Returns a copy of the front value of the list.
+ */
+template<class ListType>
+inline typename StaticList<ListType>::value_type StaticList<ListType>::getFront() const
+{
+  return list.ListType::getFront();
+}
+
+/** @brief Access back of list
+ *
+ * @returns value_type Returns a copy of the back value of the list.
+ */
+template<class ListType>
+inline typename StaticList<ListType>::value_type StaticList<ListType>::getBack() const
+{
+  return list.ListType::getBack();
+}
+
+/** @brief List to string
+ *
+ * @returns string Returns the string representation of the list.
+ */
+template<class ListType>
+inline string StaticList<ListType>::str() const
+{
+  return list.ListType::str();
+}
+
+/** @brief Indexing operator
+ *
+ * @param index The index of the value to access.
+ *
+ * @returns value_type& Returns a reference to the value at the index.
+ */
+template<class ListType>
+inline typename StaticList<ListType>::value_type& StaticList<ListType>::operator[](int index) const
+{
+  return list.ListType::operator[](index);
+}
+
+/** @brief Clear out list
+ *
+ * Remove all of the values of the wrapped list.
+ */
+template<class ListType>
+inline void StaticList<ListType>::clear() const
+{
+  list.ListType::clear();
+}
+
+/** @brief Insert value on back
+ *
+ * @param value The value to append to the list.
+ *
+ * @returns const StaticList<ListType>& Returns this facade, so that
+ *   insertions can be chained.
+ */
+template<class ListType>
+inline const StaticList<ListType>& StaticList<ListType>::insertBack(const value_type& value) const
+{
+  list.ListType::insertBack(value);
+  return *this;
+}
+
+/** @brief Insert moved value on back
+ *
+ * @param value The value to move to the back of the list.
+ *
+ * @returns const StaticList<ListType>& Returns this facade, so that
+ *   insertions can be chained.
+ */
+template<class ListType>
+inline const StaticList<ListType>& StaticList<ListType>::insertBack(value_type&& value) const
+{
+  list.ListType::insertBack(move(value));
+  return *this;
+}
+
+/** @brief Delete back item
+ */
+template<class ListType>
+inline void StaticList<ListType>::deleteBack() const
+{
+  list.ListType::deleteBack();
+}
+
+/** @brief Insert value on front
+ *
+ * @param value The value to prepend to the list.
+ *
+ * @returns const StaticList<ListType>& Returns this facade, so that
+ *   insertions can be chained.
+ */
+template<class ListType>
+inline const StaticList<ListType>& StaticList<ListType>::insertFront(const value_type& value) const
+{
+  list.ListType::insertFront(value);
+  return *this;
+}
+
+/** @brief Insert moved value on front
+ *
+ * @param value The value to move to the front of the list.
+ *
+ * @returns const StaticList<ListType>& Returns this facade, so that
+ *   insertions can be chained.
+ */
+template<class ListType>
+inline const StaticList<ListType>& StaticList<ListType>::insertFront(value_type&& value) const
+{
+  list.ListType::insertFront(move(value));
+  return *this;
+}
+
+/** @brief Delete front item
+ */
+template<class ListType>
+inline void StaticList<ListType>::deleteFront() const
+{
+  list.ListType::deleteFront();
+}
+
+/** @brief Delete value(s)
+ *
+ * @param value The value to delete all instances of from the list.
+ */
+template<class ListType>
+inline void StaticList<ListType>::deleteValue(const value_type& value) const
+{
+  list.ListType::deleteValue(value);
+}
+
+/** @brief Delete value at index
+ *
+ * @param index The index of the value to remove.
+ */
+template<class ListType>
+inline void StaticList<ListType>::deleteIndex(int index) const
+{
+  list.ListType::deleteIndex(index);
+}
+
+/** @brief Insert value at index
+ *
+ * @param index The index the new value should have.
+ * @param value The value to insert into the list.
+ *
+ * @returns const StaticList<ListType>& Returns this facade, so that
+ *   insertions can be chained.
+ */
+template<class ListType>
+inline const StaticList<ListType>& StaticList<ListType>::insertAt(int index, const value_type& value) const
+{
+  list.ListType::insertAt(index, value);
+  return *this;
+}
+
+/** @brief Insert moved value at index
+ *
+ * @param index The index the new value should have.
+ * @param value The value to move into the list.
+ *
+ * @returns const StaticList<ListType>& Returns this facade, so that
+ *   insertions can be chained.
+ */
+template<class ListType>
+inline const StaticList<ListType>& StaticList<ListType>::insertAt(int index, value_type&& value) const
+{
+  list.ListType::insertAt(index, move(value));
+  return *this;
+}
+
+/** @brief Begin iterator
+ *
+ * @returns iterator Returns an iterator to the front of the list.
+ */
+template<class ListType>
+inline typename StaticList<ListType>::iterator StaticList<ListType>::begin() const
+{
+  return list.begin();
+}
+
+/** @brief End iterator
+ *
+ * @returns iterator Returns an iterator past the back of the list.
+ */
+template<class ListType>
+inline typename StaticList<ListType>::iterator StaticList<ListType>::end() const
+{
+  return list.end();
+}
+
+#endif // define _STATIC_LIST_HPP_
@@ -0,0 +1,127 @@
+/** @file TList.hpp
+ * @brief Concrete implicit treap implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using an implicit treap, a randomly
+ * balanced binary tree whose in order walk gives the values of the
+ * list.  Every node knows the number of values in its subtree, so the
+ * value at an index is found by a single walk down the tree.  This
+ * makes indexing, inserting and deleting at any index O(log n), where
+ * the array and linked list implementations need O(n) for at least
+ * one of these.  A list can also be split in two at any index, and two
+ * lists concatenated, in O(log n).
+ */
+#ifndef _TLIST_HPP_
+#define _TLIST_HPP_
+#include "DLList.hpp"
+#include "List.hpp"
+#include "TListIterator.hpp"
+#include "TNode.hpp"
+#include <string>
+using namespace std;
+
+/** @class TList
+ * @brief The TList concrete implicit treap implemention of the List
+ *   interface.
+ *
+ * Concrete implementation of List abstraction using an implicit treap.
+ * Nodes are allocated on their own rather than from a pool owned by
+ * the list, since split() and concat() hand nodes over from one list
+ * to another.
+ */
+template<class T>
+class TList : public List<T>
+{
+public:
+  // constructors and destructors
+  TList();                              // default constructor
+  TList(int size, T values[]);          // array based constructor
+  TList(const TList<T>& otherList);     // copy constructor
+  TList(TList<T>&& otherList) noexcept; // move constructor
+  ~TList();                             // destructor
+
+  // assignment operators
+  TList<T>& operator=(const TList<T>& rhs);
+  TList<T>& operator=(TList<T>&& rhs) noexcept;
+
+  // accessor and information methods
+  T getFront() const;
+  T getBack() const;
+  bool operator==(const List<T>& rhs) const;
+  T& operator[](int index) const;
+
+  // adding, accessing and removing values from the list
+  void clear();
+  List<T>& insertBack(const T& value);
+  List<T>& insertBack(T&& value);
+  List<T>& operator>>(const T& value);
+  void deleteBack();
+  List<T>& insertFront(const T& value);
+  List<T>& insertFront(T&& value);
+  List<T>& operator<<(const T& value);
+  void deleteFront();
+  void deleteValue(const T& value);
+  void deleteIndex(int index);
+  List<T>& insertAt(int index, const T& value);
+  List<T>& insertAt(int index, T&& value);
+
+  // cutting and joining whole lists
+  TList<T> split(int index);
+  void concat(TList<T>&& otherList);
+
+  // iterating over list the C++ way, using forward iterator objects
+  // and supporting range based iteration and <algorithm>
+  using value_type = T;
+  using iterator = TListIterator<T>;
+  using const_iterator = TListIterator<const T>;
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+protected:
+  // comparing values of lists, walking through our own values
+  bool hasFastIndexing() const;
+  bool equalValues(const List<T>& rhs) const;
+  int compareValues(const List<T>& rhs) const;
+
+  // writing values out to a stream, walking through our own values
+  void writeValues(ListWriter<T>& writer, int first, int count) const;
+
+private:
+  /// @brief pointer to the root node of the tree, or nullptr for an
+  ///   empty list
+  TNode<T>* root;
+
+  /// @brief the state of the pseudo random generator the priorities
+  ///   of new nodes come from
+  unsigned int randomState;
+
+  // private member methods for managing the nodes of the tree
+  unsigned int nextPriority();
+  void setRoot(TNode<T>* node);
+  TNode<T>* nodeAt(int index) const;
+  TNode<T>* firstNode() const;
+  template<class Iterator>
+  bool equalValuesWalking(Iterator rhsCurrent) const;
+  template<class Iterator>
+  int compareValuesWalking(Iterator rhsCurrent, int rhsSize) const;
+  static int countOf(TNode<T>* node);
+  static void update(TNode<T>* node);
+  static void splitTree(TNode<T>* node, int index, TNode<T>*& left, TNode<T>*& right);
+  static TNode<T>* mergeTrees(TNode<T>* left, TNode<T>* right);
+  static TNode<T>* removeMatching(TNode<T>* node, const T& value, int& removed);
+  static void deleteTree(TNode<T>* node);
+};
+
+// template member definitions
+#include "TList.ipp"
+
+#endif // define _TLIST_HPP_
@@ -0,0 +1,1117 @@
+/** @file TList.ipp
+ * @brief Concrete implicit treap implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using an implicit treap.  All of the
+ * ways of changing the list come down to the two basic treap
+ * operations.  splitTree() cuts a tree into the values before an index
+ * and the values from the index on, and mergeTrees() joins two trees
+ * holding consecutive runs of values back together, letting the node
+ * with the higher priority become the root.  Since priorities are
+ * random, the expected depth of the tree is O(log n), and so is the
+ * expected time of both operations.
+ *
+ * This file is included at the end of TList.hpp and is not compiled on
+ * its own.
+ */
+#include "ListException.hpp"
+#include "TListIterator.hpp"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+using namespace std;
+
+/** @brief Default constructor
+ *
+ * Construct an empty list.  The empty list will have no allocated memory
+ * nor any values.
+ */
+template<class T>
+TList<T>::TList()
+{
+  // Empty list has size 0 and no root node
+  this->size = 0;
+  root = nullptr;
+  randomState = 2463534242u;
+}
+
+/** @brief Standard constructor
+ *
+ * Construct a list of values from a (statically) defined and provided
+ * array of values.
+ *
+ * @param size The size of the input values were are given as well as the
+ *   size of the new list we are to construct.
+ * @param values The (static) array of values to use to construct
+ *   this List values with.
+ */
+template<class T>
+TList<T>::TList(int size, T values[])
+{
+  this->size = 0;
+  root = nullptr;
+  randomState = 2463534242u;
+
+  for (int index = 0; index < size; index++)
+  {
+    insertBack(values[index]);
+  }
+}
+
+/** @brief Copy constructor
+ *
+ * Provide a copy constructor for the List class.  The copy gets new
+ * nodes of its own holding copies of the values of the given list.
+ *
+ * @param list The other List type we are to make a copy of in this
+ *   constructor.
+ */
+template<class T>
+TList<T>::TList(const TList<T>& list)
+{
+  this->size = 0;
+  root = nullptr;
+  randomState = 2463534242u;
+
+  for (TNode<T>* node = list.firstNode(); node != nullptr; node = node->successor())
+  {
+    insertBack(node->value);
+  }
+}
+
+/** @brief Move constructor
+ *
+ * Construct this list by taking over the tree of the given list,
+ * which is left as an empty list.
+ *
+ * @param list The other List whose tree we are to take over.
+ */
+template<class T>
+TList<T>::TList(TList<T>&& list) noexcept
+{
+  // take over the tree of the other list
+  this->size = list.size;
+  root = list.root;
+  randomState = list.randomState;
+
+  // the other list is now empty and no longer owns the nodes
+  list.size = 0;
+  list.root = nullptr;
+}
+
+/** @brief Class destructor
+ *
+ * Destructor for the List class.  Invoke the clear of the list to
+ * give back the memory of the nodes.
+ */
+template<class T>
+TList<T>::~TList()
+{
+  this->clear();
+}
+
+/** @brief Copy assignment operator
+ *
+ * Replace the values of this list with a copy of the values of
+ * the right hand side list.  The copy is made first, so that
+ * this list is left unchanged if the copy fails.
+ *
+ * @param rhs The other List we are to make a copy of.
+ *
+ * @returns TList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+TList<T>& TList<T>::operator=(const TList<T>& rhs)
+{
+  if (this != &rhs)
+  {
+    // copy into a temporary then move the copy into this list
+    TList<T> copy(rhs);
+    *this = move(copy);
+  }
+
+  return *this;
+}
+
+/** @brief Move assignment operator
+ *
+ * Release the nodes of this list and take over the tree of the
+ * right hand side list, which is left as an empty list.
+ *
+ * @param rhs The other List whose tree we are to take over.
+ *
+ * @returns TList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+TList<T>& TList<T>::operator=(TList<T>&& rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    // give back our own nodes before taking over the other list
+    clear();
+
+    this->size = rhs.size;
+    root = rhs.root;
+
+    rhs.size = 0;
+    rhs.root = nullptr;
+  }
+
+  return *this;
+}
+
+/** @brief Access front of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the front of this list.
+ *
+ * @returns T Returns a copy of the front item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access front item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T TList<T>::getFront() const
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("TList::getFront", this->size);
+  }
+
+  return firstNode()->value;
+}
+
+/** @brief Access back of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the back of this list.
+ *
+ * @returns T Returns a copy of the back item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access back item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T TList<T>::getBack() const
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("TList::getBack", this->size);
+  }
+
+  return nodeAt(this->size - 1)->value;
+}
+
+/** @brief Write values to stream
+ *
+ * Write the given range of values to the output stream, separated by a
+ * comma and a space, walking the tree in order from the first value
+ * rather than going through operator[] for each value.
+ *
+ * @param writer The stream or string to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write, at least 1.
+ */
+template<class T>
+void TList<T>::writeValues(ListWriter<T>& writer, int first, int count) const
+{
+  // find the first node once, then continue the in order walk of the
+  // tree from it
+  TNode<T>* node = nodeAt(first);
+  writer.writeValue(node->value);
+  for (int written = 1; written < count; written++)
+  {
+    node = node->successor();
+    writer.writeText(", ");
+    writer.writeValue(node->value);
+  }
+}
+
+/** @brief Boolean equals operator
+ *
+ * Check if this List is equal to the right hand side (rhs)
+ * list.  The lists are equal if their sizes are equal, and if
+ * all elements in both lists are equal.
+ * The comparison is done by List<T>::equals(), using whichever
+ * list is able to walk through its values fastest.
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this List to.
+ *
+ * @returns bool true if the lists are equal, false if the are not.
+ */
+template<class T>
+bool TList<T>::operator==(const List<T>& rhs) const
+{
+  // the list that can walk through its own values does the comparing
+  return this->equals(rhs);
+}
+
+/** @brief Fast indexing check
+ *
+ * Indexing a treap walks down from the root for every index, so
+ * stepping through its values by index is O(n log n).  We say so to
+ * have comparisons walk our nodes instead.
+ *
+ * @returns bool Always false for tree based lists.
+ */
+template<class T>
+bool TList<T>::hasFastIndexing() const
+{
+  return false;
+}
+
+/** @brief Check values for equality
+ *
+ * Check that the values of this list are equal to the values of the
+ * rhs list, which has the same size as this list.  We walk our nodes
+ * in order while stepping through the rhs list in lockstep.  If the
+ * rhs list is a treap or a doubly linked list, neither of which can be
+ * indexed in order quickly, it is walked with its own iterators,
+ * otherwise it is indexed in order.
+ *
+ * @param rhs The other list of the same size to compare values with.
+ *
+ * @returns bool true if all values of the lists are equal.
+ */
+template<class T>
+bool TList<T>::equalValues(const List<T>& rhs) const
+{
+  const TList<T>* tree = dynamic_cast<const TList<T>*>(&rhs);
+  if (tree != nullptr)
+  {
+    return equalValuesWalking(tree->begin());
+  }
+  const DLList<T>* linked = dynamic_cast<const DLList<T>*>(&rhs);
+  if (linked != nullptr)
+  {
+    return equalValuesWalking(linked->begin());
+  }
+
+  int index = 0;
+  for (TNode<T>* current = firstNode(); current != nullptr; current = current->successor())
+  {
+    if (not(current->value == rhs[index]))
+    {
+      return false;
+    }
+    index++;
+  }
+
+  return true;
+}
+
+/** @brief Compare values
+ *
+ * Compare the values of this list with the rhs list in lexicographic
+ * order.  Like equalValues(), we walk our nodes and the rhs list in
+ * lockstep, walking a treap or doubly linked list with its own
+ * iterators rather than indexing it.
+ *
+ * @param rhs The other list on the right hand side of the comparison.
+ *
+ * @returns int Returns a negative value, 0 or a positive value if this
+ *   list orders before, the same as or after the rhs list.
+ */
+template<class T>
+int TList<T>::compareValues(const List<T>& rhs) const
+{
+  const TList<T>* tree = dynamic_cast<const TList<T>*>(&rhs);
+  if (tree != nullptr)
+  {
+    return compareValuesWalking(tree->begin(), rhs.getSize());
+  }
+  const DLList<T>* linked = dynamic_cast<const DLList<T>*>(&rhs);
+  if (linked != nullptr)
+  {
+    return compareValuesWalking(linked->begin(), rhs.getSize());
+  }
+
+  int index = 0;
+  for (TNode<T>* current = firstNode(); current != nullptr and index < rhs.getSize(); current = current->successor())
+  {
+    const T& rhsValue = rhs[index];
+    if (current->value < rhsValue)
+    {
+      return -1;
+    }
+    if (rhsValue < current->value)
+    {
+      return 1;
+    }
+    index++;
+  }
+
+  // all values compared are equal, so the shorter list comes first
+  return this->size - rhs.getSize();
+}
+
+/** @brief Indexing operator
+ *
+ * Provide a way to index individual values of the list.  The node
+ * is found by a single walk down the tree, which is O(log n).
+ *
+ * @param index The index of the value it is desired to access from
+ *   this List.
+ *
+ * @returns T& Returns a reference to the requested List item at
+ *   the requested index.
+ *
+ * @throws ListMemoryBoundsException if a request for an index beyond
+ *   the end of the list (or less than 0) is made.
+ */
+template<class T>
+T& TList<T>::operator[](int index) const
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("TList::operator[]", this->size, index);
+  }
+
+  return nodeAt(index)->value;
+}
+
+/** @brief Clear out list
+ *
+ * Clear or empty out the list.  Return the list back to an empty
+ * list, giving back the memory of all of the nodes of the tree.
+ */
+template<class T>
+void TList<T>::clear()
+{
+  deleteTree(root);
+
+  // make sure size is now 0 and there is no more tree
+  this->size = 0;
+  root = nullptr;
+}
+
+/** @brief Insert value on back
+ *
+ * Append the indicated value to the end of this List of values.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& TList<T>::insertBack(const T& value)
+{
+  return insertAt(this->size, value);
+}
+
+/** @brief Insert moved value on back
+ *
+ * Append the indicated value to the end of this List of values,
+ * moving the value into the list instead of copying it.
+ *
+ * @param value The value to move to the end of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& TList<T>::insertBack(T&& value)
+{
+  return insertAt(this->size, move(value));
+}
+
+/** @brief Overload operator>> to append
+ *
+ * Overload the operator>> to perform append operation.  Implementation
+ * is actually done by the insertBack() member function.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& TList<T>::operator>>(const T& value)
+{
+  return insertBack(value);
+}
+
+/** @brief Delete back item
+ *
+ * Delete the item from the back of the list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   delete back item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+void TList<T>::deleteBack()
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("TList::deleteBack", this->size);
+  }
+
+  deleteIndex(this->size - 1);
+}
+
+/** @brief Insert value on front
+ *
+ * Prepend the indicated value to the beginning of this List of
+ * values.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& TList<T>::insertFront(const T& value)
+{
+  return insertAt(0, value);
+}
+
+/** @brief Insert moved value on front
+ *
+ * Prepend the indicated value to the beginning of this List of
+ * values, moving the value into the list instead of copying it.
+ *
+ * @param value The value to move to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& TList<T>::insertFront(T&& value)
+{
+  return insertAt(0, move(value));
+}
+
+/** @brief Overload operator<< to prepend
+ *
+ * Overload the operator<< to perform prepend operation.  Implementation
+ * is actually done by the insertFront() member function.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& TList<T>::operator<<(const T& value)
+{
+  return insertFront(value);
+}
+
+/** @brief Delete front item
+ *
+ * Delete the item from the front of the list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   delete front item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+void TList<T>::deleteFront()
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("TList::deleteFront", this->size);
+  }
+
+  deleteIndex(0);
+}
+
+/** @brief Delete value(s)
+ *
+ * Delete the value from the list.  This method will delete all
+ * instances of the value from this list that it finds.  The whole
+ * tree is visited once, and each removed node is replaced by the merge
+ * of its two subtrees.  If the list does not conatin the value, then
+ * an exception is thrown.
+ *
+ * @param value The value to deleted from this list.
+ *
+ * @throws ListValueNotFoundException If we are asked to delete a value
+ *   that does not exist, we thrown an exception instead of silently
+ *   ignoring this condition.
+ */
+template<class T>
+void TList<T>::deleteValue(const T& value)
+{
+  int removed = 0;
+  setRoot(removeMatching(root, value, removed));
+
+  // if we didn't find a value to delete, let the caller know there
+  // may have been a problem
+  if (removed == 0)
+  {
+    throw ListValueNotFoundException("TList::deleteValue", value);
+  }
+}
+
+/** @brief Delete value at index
+ *
+ * Delete the value from the indicated index in this list.  The tree
+ * is split around the node holding the value, and the trees before
+ * and after it are merged back together, which is O(log n).
+ *
+ * @param index The index of the value in the list to be removed.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+void TList<T>::deleteIndex(int index)
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("TList::deleteIndex", this->size, index);
+  }
+
+  TNode<T>* before;
+  TNode<T>* node;
+  TNode<T>* after;
+  splitTree(root, index, before, after);
+  splitTree(after, 1, node, after);
+
+  delete node;
+  setRoot(mergeTrees(before, after));
+}
+
+/** @brief Insert value at index
+ *
+ * Insert the indicated value into this list so that it ends up at
+ * the given index.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to insert into the list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so
+ *   that the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& TList<T>::insertAt(int index, const T& value)
+{
+  return insertAt(index, T(value));
+}
+
+/** @brief Insert moved value at index
+ *
+ * Insert the indicated value into this list at the given index,
+ * moving the value into the list instead of copying it.  The tree is
+ * split at the index and the two halves are merged back together with
+ * the new node in between, which is O(log n).
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to move into the list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so
+ *   that the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& TList<T>::insertAt(int index, T&& value)
+{
+  // the index can be 1 past the back, which appends the value
+  if ((index < 0) or (index > this->size))
+  {
+    throw ListMemoryBoundsException("TList::insertAt", this->size, index);
+  }
+
+  TNode<T>* node = new TNode<T>(nextPriority(), move(value));
+
+  TNode<T>* before;
+  TNode<T>* after;
+  splitTree(root, index, before, after);
+  setRoot(mergeTrees(mergeTrees(before, node), after));
+
+  return *this;
+}
+
+/** @brief Split list
+ *
+ * Cut this list in two at the given index.  This list keeps the values
+ * before the index, and the values from the index on are moved into a
+ * new list that is returned.  No values are copied or moved, the nodes
+ * holding them are handed over to the new list, so this is O(log n).
+ *
+ * @param index The index of the first value to move into the new list,
+ *   from 0 up to and including the current size of the list.
+ *
+ * @returns TList<T> Returns the list of values cut off of the back of
+ *   this list.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+TList<T> TList<T>::split(int index)
+{
+  if ((index < 0) or (index > this->size))
+  {
+    throw ListMemoryBoundsException("TList::split", this->size, index);
+  }
+
+  TList<T> backList;
+  backList.randomState = nextPriority();
+
+  TNode<T>* before;
+  TNode<T>* after;
+  splitTree(root, index, before, after);
+  setRoot(before);
+  backList.setRoot(after);
+
+  return backList;
+}
+
+/** @brief Concatenate lists
+ *
+ * Append all of the values of the other list to the back of this
+ * list, leaving the other list empty.  The nodes of the other list are
+ * handed over to this list, so this is O(log n).
+ *
+ * @param otherList The list whose values are to be appended to this
+ *   list.
+ */
+template<class T>
+void TList<T>::concat(TList<T>&& otherList)
+{
+  if (this == &otherList)
+  {
+    return;
+  }
+
+  setRoot(mergeTrees(root, otherList.root));
+
+  otherList.size = 0;
+  otherList.root = nullptr;
+}
+
+/** @brief Begin iterator
+ *
+ * Create and return an iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns iterator returns a new forward iterator that keeps track
+ *   of iterating over the list items.
+ */
+template<class T>
+typename TList<T>::iterator TList<T>::begin()
+{
+  return iterator(firstNode());
+}
+
+/** @brief End iterator
+ *
+ * Return an iterator pointing to one past the end of this list,
+ * which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns iterator returns a new forward iterator that points to
+ *   the end of the list.
+ */
+template<class T>
+typename TList<T>::iterator TList<T>::end()
+{
+  return iterator(nullptr);
+}
+
+/** @brief Begin iterator of constant list
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename TList<T>::const_iterator TList<T>::begin() const
+{
+  return const_iterator(firstNode());
+}
+
+/** @brief End iterator of constant list
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename TList<T>::const_iterator TList<T>::end() const
+{
+  return const_iterator(nullptr);
+}
+
+/** @brief Constant begin iterator
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename TList<T>::const_iterator TList<T>::cbegin() const
+{
+  return const_iterator(firstNode());
+}
+
+/** @brief Constant end iterator
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename TList<T>::const_iterator TList<T>::cend() const
+{
+  return const_iterator(nullptr);
+}
+
+/** @brief Next priority
+ *
+ * Private helper to draw the random priority for a new node, using a
+ * xorshift pseudo random generator.  The priorities only need to be
+ * unpredictable by the order values are inserted in, not secure.
+ *
+ * @returns unsigned int Returns the priority for the next new node.
+ */
+template<class T>
+unsigned int TList<T>::nextPriority()
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+/** @brief Set root
+ *
+ * Private helper to make the given tree the tree of this list, after
+ * a split or merge, and update the size of the list to match.
+ *
+ * @param node The root node of the new tree of this list.
+ */
+template<class T>
+void TList<T>::setRoot(TNode<T>* node)
+{
+  root = node;
+  if (root != nullptr)
+  {
+    root->parent = nullptr;
+  }
+  this->size = countOf(root);
+}
+
+/** @brief Find node at index
+ *
+ * Private helper to find the node holding the value at the given
+ * index.  At each node the count of its left subtree tells us if the
+ * index is in the left subtree, at the node itself, or in the right
+ * subtree.
+ *
+ * @param index The index of the value to find, must be a valid index
+ *   of this list.
+ *
+ * @returns TNode<T>* Returns a pointer to the node holding the index.
+ */
+template<class T>
+TNode<T>* TList<T>::nodeAt(int index) const
+{
+  TNode<T>* node = root;
+  while (true)
+  {
+    int leftCount = countOf(node->left);
+    if (index < leftCount)
+    {
+      node = node->left;
+    }
+    else if (index == leftCount)
+    {
+      return node;
+    }
+    else
+    {
+      index -= leftCount + 1;
+      node = node->right;
+    }
+  }
+}
+
+/** @brief First node
+ *
+ * Private helper to find the node holding the front value of the list.
+ *
+ * @returns TNode<T>* Returns a pointer to the front node, or nullptr
+ *   if the list is empty.
+ */
+template<class T>
+TNode<T>* TList<T>::firstNode() const
+{
+  return (root == nullptr) ? nullptr : root->leftmost();
+}
+
+/** @brief Check values for equality walking
+ *
+ * Private helper to check our values against those of another list of
+ * the same size, stepping through it with one of its iterators, so
+ * that every value of both lists is visited only once.
+ *
+ * @param rhsCurrent An iterator at the first value of the other list.
+ *
+ * @returns bool true if all values of the lists are equal.
+ */
+template<class T>
+template<class Iterator>
+bool TList<T>::equalValuesWalking(Iterator rhsCurrent) const
+{
+  for (TNode<T>* current = firstNode(); current != nullptr; current = current->successor())
+  {
+    if (not(current->value == *rhsCurrent))
+    {
+      return false;
+    }
+    ++rhsCurrent;
+  }
+
+  return true;
+}
+
+/** @brief Compare values walking
+ *
+ * Private helper to compare our values with those of another list in
+ * lexicographic order, stepping through it with one of its iterators.
+ *
+ * @param rhsCurrent An iterator at the first value of the other list.
+ * @param rhsSize The number of values of the other list.
+ *
+ * @returns int Returns a negative value, 0 or a positive value if this
+ *   list orders before, the same as or after the other list.
+ */
+template<class T>
+template<class Iterator>
+int TList<T>::compareValuesWalking(Iterator rhsCurrent, int rhsSize) const
+{
+  int index = 0;
+  for (TNode<T>* current = firstNode(); current != nullptr and index < rhsSize; current = current->successor())
+  {
+    if (current->value < *rhsCurrent)
+    {
+      return -1;
+    }
+    if (*rhsCurrent < current->value)
+    {
+      return 1;
+    }
+    ++rhsCurrent;
+    index++;
+  }
+
+  // all values compared are equal, so the shorter list comes first
+  return this->size - rhsSize;
+}
+
+/** @brief Count of subtree
+ *
+ * Private helper to get the number of values in a subtree, which is 0
+ * for an empty subtree.
+ *
+ * @param node The root node of the subtree, or nullptr.
+ *
+ * @returns int Returns the number of values in the subtree.
+ */
+template<class T>
+int TList<T>::countOf(TNode<T>* node)
+{
+  return (node == nullptr) ? 0 : node->count;
+}
+
+/** @brief Update node
+ *
+ * Private helper to bring the count of a node up to date after its
+ * children were changed, and make sure the children know this node
+ * is their parent.
+ *
+ * @param node The node whose children were changed.
+ */
+template<class T>
+void TList<T>::update(TNode<T>* node)
+{
+  node->count = countOf(node->left) + 1 + countOf(node->right);
+  if (node->left != nullptr)
+  {
+    node->left->parent = node;
+  }
+  if (node->right != nullptr)
+  {
+    node->right->parent = node;
+  }
+}
+
+/** @brief Split tree
+ *
+ * Private helper to cut a tree into a tree of the values before the
+ * given index and a tree of the values from the index on.  Only the
+ * nodes on the path down to the index are changed.
+ *
+ * @param node The root of the tree to split.
+ * @param index The number of values that go into the left tree.
+ * @param left Returns the root of the tree of values before the index.
+ * @param right Returns the root of the tree of values from the index on.
+ */
+template<class T>
+void TList<T>::splitTree(TNode<T>* node, int index, TNode<T>*& left, TNode<T>*& right)
+{
+  if (node == nullptr)
+  {
+    left = nullptr;
+    right = nullptr;
+    return;
+  }
+
+  int leftCount = countOf(node->left);
+  if (index <= leftCount)
+  {
+    // the node and its right subtree all go into the right tree
+    splitTree(node->left, index, left, node->left);
+    right = node;
+  }
+  else
+  {
+    // the node and its left subtree all go into the left tree
+    splitTree(node->right, index - leftCount - 1, node->right, right);
+    left = node;
+  }
+  update(node);
+}
+
+/** @brief Merge trees
+ *
+ * Private helper to join two trees, where all of the values of the
+ * left tree come before all of the values of the right tree.  The root
+ * with the higher priority becomes the root of the merged tree, and
+ * the other tree is merged into its inner subtree.
+ *
+ * @param left The root of the tree of the values that come first.
+ * @param right The root of the tree of the values that come after.
+ *
+ * @returns TNode<T>* Returns the root of the merged tree.
+ */
+template<class T>
+TNode<T>* TList<T>::mergeTrees(TNode<T>* left, TNode<T>* right)
+{
+  if (left == nullptr)
+  {
+    return right;
+  }
+  if (right == nullptr)
+  {
+    return left;
+  }
+
+  if (left->priority > right->priority)
+  {
+    left->right = mergeTrees(left->right, right);
+    update(left);
+    return left;
+  }
+  else
+  {
+    right->left = mergeTrees(left, right->left);
+    update(right);
+    return right;
+  }
+}
+
+/** @brief Remove matching values
+ *
+ * Private helper to delete all nodes holding the given value from a
+ * tree.  Both subtrees are cleaned up first, then the node itself is
+ * replaced by the merge of its subtrees if it holds the value.
+ *
+ * @param node The root of the tree to remove the value from.
+ * @param value The value to remove.
+ * @param removed Incremented for every node that is removed.
+ *
+ * @returns TNode<T>* Returns the root of the tree that is left.
+ */
+template<class T>
+TNode<T>* TList<T>::removeMatching(TNode<T>* node, const T& value, int& removed)
+{
+  if (node == nullptr)
+  {
+    return nullptr;
+  }
+
+  node->left = removeMatching(node->left, value, removed);
+  node->right = removeMatching(node->right, value, removed);
+
+  if (node->value == value)
+  {
+    TNode<T>* merged = mergeTrees(node->left, node->right);
+    delete node;
+    removed++;
+    return merged;
+  }
+
+  update(node);
+  return node;
+}
+
+/** @brief Delete tree
+ *
+ * Private helper to give back the memory of all of the nodes of a
+ * tree.
+ *
+ * @param node The root of the tree to delete.
+ */
+template<class T>
+void TList<T>::deleteTree(TNode<T>* node)
+{
+  if (node == nullptr)
+  {
+    return;
+  }
+
+  deleteTree(node->left);
+  deleteTree(node->right);
+  delete node;
+}
@@ -0,0 +1,75 @@
+/** @file TListIterator.hpp
+ * @brief Concrete Iterator for TList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Definition of concrete TListIterator to iterate over
+ * TList<T> instances.
+ */
+#ifndef _TLIST_ITERATOR_HPP_
+#define _TLIST_ITERATOR_HPP_
+#include "TNode.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+using namespace std;
+
+/** @class TListIterator
+ * @brief The forward iterator for implicit treap lists
+ *
+ * Iterate over the values of a TList<T> in list order, which is the
+ * in order walk of the nodes of the tree.  A TListIterator<T> gives
+ * access to modify the values, a TListIterator<const T> is the
+ * const_iterator of the list and only gives read access.  These are
+ * standard iterators, so they work with range based iteration as well
+ * as with the <algorithm> library.
+ */
+template<class T>
+class TListIterator
+{
+public:
+  // standard iterator traits
+  using iterator_category = forward_iterator_tag;
+  using value_type = remove_const_t<T>;
+  using difference_type = ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  // constructors
+  TListIterator();
+  TListIterator(TNode<value_type>* node);
+  template<class U, class = enable_if_t<is_same<const U, T>::value>>
+  TListIterator(const TListIterator<U>& other);
+
+  // accessing the current value
+  reference operator*() const;
+  pointer operator->() const;
+
+  // moving the iterator
+  TListIterator<T>& operator++();
+  TListIterator<T> operator++(int);
+
+  // comparing iterators, mutable and const iterators can be mixed
+  template<class U>
+  bool operator==(const TListIterator<U>& rhs) const;
+  template<class U>
+  bool operator!=(const TListIterator<U>& rhs) const;
+
+private:
+  /// @brief pointer to the node holding the current value of
+  ///   the iteration, or nullptr once past the end of the list
+  TNode<value_type>* node;
+
+  // the const iterator is built from and compared to the mutable one
+  template<class U>
+  friend class TListIterator;
+};
+
+// template member definitions
+#include "TListIterator.ipp"
+
+#endif // define _TLIST_ITERATOR_HPP_
@@ -0,0 +1,159 @@
+/** @file TListIterator.ipp
+ * @brief Concrete Iterator for TList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implementation of concrete TListIterator to iterate over
+ * TList<T> instances.
+ *
+ * This file is included at the end of TListIterator.hpp and is not
+ * compiled on its own.
+ */
+#include <string>
+using namespace std;
+
+/**
+ * @brief Default constructor
+ *
+ * Default constructor, iterator will not be iterating over
+ * anything if constructed using the default constructor.
+ */
+template<class T>
+TListIterator<T>::TListIterator()
+{
+  node = nullptr;
+}
+
+/**
+ * @brief Standard constructor
+ *
+ * Standard constructor, we are given the node holding the value we
+ * are to begin iteration with.
+ *
+ * @param node A pointer to the TNode<T> holding the value at the
+ *   start of this iteration, or nullptr for the end of the list.
+ */
+template<class T>
+TListIterator<T>::TListIterator(TNode<value_type>* node)
+{
+  this->node = node;
+}
+
+/**
+ * @brief Converting constructor
+ *
+ * A mutable iterator can be turned into a const iterator to the same
+ * value, but not the other way around.
+ *
+ * @param other The mutable iterator to convert.
+ */
+template<class T>
+template<class U, class>
+TListIterator<T>::TListIterator(const TListIterator<U>& other)
+{
+  this->node = other.node;
+}
+
+/**
+ * @brief Overload dereference operator
+ *
+ * Overload the dereference operator* for the TListIterator.
+ * This method makes it easy/convenient to access the info
+ * that the iterator is currently pointing two.
+ *
+ * @returns reference Returns a reference to the value currently being
+ *   pointed to by this iterator.
+ */
+template<class T>
+typename TListIterator<T>::reference TListIterator<T>::operator*() const
+{
+  return node->value;
+}
+
+/**
+ * @brief Overload member access operator
+ *
+ * @returns pointer Returns a pointer to the value currently being
+ *   pointed to by this iterator.
+ */
+template<class T>
+typename TListIterator<T>::pointer TListIterator<T>::operator->() const
+{
+  return &**this;
+}
+
+/**
+ * @brief Overload increment operator
+ *
+ * Overload the pre increment operator++.  This is defined to cause the
+ * iterator to move to the node holding the next value of the list, which
+ * is the leftmost node of the right subtree, or else the first ancestor
+ * whose left subtree we are leaving.
+ *
+ * @returns TListIterator<T>& We need to return ourself after incrementing
+ *   the iterator to the next value of the list we are iterating over.
+ */
+template<class T>
+TListIterator<T>& TListIterator<T>::operator++()
+{
+  node = node->successor();
+
+  return *this;
+}
+
+/**
+ * @brief Overload post increment operator
+ *
+ * @returns TListIterator<T> Returns a copy of ourself from before we
+ *   were moved to the next value.
+ */
+template<class T>
+TListIterator<T> TListIterator<T>::operator++(int)
+{
+  TListIterator<T> before(*this);
+  ++*this;
+
+  return before;
+}
+
+/**
+ * @brief Overload boolean equality operator
+ *
+ * Overload the boolean operator== to check for equivalence.  This is
+ * needed to create loops and test if we are done yet or not iterating
+ * over the list by testing if the iterator is == the end() iterator item.
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators are both pointing to the same
+ *   value of the iteration, false otherwise.
+ */
+template<class T>
+template<class U>
+bool TListIterator<T>::operator==(const TListIterator<U>& rhs) const
+{
+  return node == rhs.node;
+}
+
+/**
+ * @brief Overload boolean not equal operator
+ *
+ * Overload the boolean operator!= to check for nonequivalance.  This is
+ * needed to create loops and test if we are done yet or not iterating
+ * over the list by testing if the iterator is != the end() iterator item.
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators are not pointing to the same
+ *   value of the iteration, false otherwise.
+ */
+template<class T>
+template<class U>
+bool TListIterator<T>::operator!=(const TListIterator<U>& rhs) const
+{
+  return not(*this == rhs);
+}
@@ -0,0 +1,95 @@
+/** @file TNode.hpp
+ * @brief Definition of the TNode class used by TList treap lists.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Definition of TNode class used by TList implicit treap list
+ * implementations and supporting iteration classes.  Simplifies
+ * inclusion circular references to put this structure definition in
+ * its own file.
+ */
+#ifndef _TNODE_HPP_
+#define _TNODE_HPP_
+#include <utility>
+using namespace std;
+
+/** TNode
+ * A node of an implicit treap.  The nodes form a binary tree in which
+ * the values are kept in list order by an in order walk of the tree.
+ * Rather than a key, each node keeps the count of values in the
+ * subtree it is the root of, which is all that is needed to find the
+ * value at any index.  The random priority of a node keeps the tree
+ * balanced, the priority of a node is never less than the priorities
+ * of its children.
+ */
+template<class T>
+struct TNode
+{
+public:
+  /// @brief Construct a leaf node with the given priority, with the
+  ///   value constructed in place from the remaining arguments.
+  template<class... Args>
+  TNode(unsigned int priority, Args&&... args)
+    : value(forward<Args>(args)...),
+      priority(priority),
+      count(1),
+      left(nullptr),
+      right(nullptr),
+      parent(nullptr)
+  {
+  }
+
+  /// @brief the node holding the first value of the subtree this node
+  ///   is the root of.
+  TNode<T>* leftmost()
+  {
+    TNode<T>* node = this;
+    while (node->left != nullptr)
+    {
+      node = node->left;
+    }
+    return node;
+  }
+
+  /// @brief the node holding the value after the value of this node
+  ///   in the list, or nullptr if this node holds the back value.
+  TNode<T>* successor()
+  {
+    if (right != nullptr)
+    {
+      return right->leftmost();
+    }
+
+    // climb until we come up out of a left subtree
+    TNode<T>* node = this;
+    while (node->parent != nullptr and node->parent->right == node)
+    {
+      node = node->parent;
+    }
+    return node->parent;
+  }
+
+  /// @brief the actual date value of type T this node contains.
+  T value;
+
+  /// @brief the random priority of this node in the treap
+  unsigned int priority;
+
+  /// @brief the number of values in the subtree this node is the root of
+  int count;
+
+  /// @brief the root of the subtree of values before this value
+  TNode<T>* left;
+
+  /// @brief the root of the subtree of values after this value
+  TNode<T>* right;
+
+  /// @brief the node this node is a child of, or nullptr for the root
+  TNode<T>* parent;
+};
+
+#endif // define _TNODE_HPP_
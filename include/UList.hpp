@@ -0,0 +1,128 @@
+/** @file UList.hpp
+ * @brief Concrete unrolled linked list implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using an unrolled linked list.  This
+ * is a doubly linked list where every node holds a small block of
+ * values rather than a single value.  Values that are next to each
+ * other in the list are mostly next to each other in memory, so
+ * walking the list is nearly as fast as for the array based AList,
+ * and a lot less memory is spent on links than for the LList.  Yet
+ * inserting or removing in the middle of the list only shifts the
+ * values of a single block.  A full node is split in two when a value
+ * is inserted into it, and a node that becomes less than half full is
+ * merged with a neighbor when the two fit into one node.
+ */
+#ifndef _ULIST_HPP_
+#define _ULIST_HPP_
+#include "List.hpp"
+#include "NodePool.hpp"
+#include "UListIterator.hpp"
+#include "UNode.hpp"
+#include <string>
+using namespace std;
+
+/** @class UList
+ * @brief The UList concrete unrolled linked list implemention of the
+ *   List interface.
+ *
+ * Concrete implementation of List abstraction using a doubly linked
+ * list of nodes that each hold a block of values.  The memory for the
+ * nodes of the list comes from a NodePool owned by the list.
+ */
+template<class T>
+class UList : public List<T>
+{
+public:
+  // constructors and destructors
+  UList();                              // default constructor
+  UList(int size, T values[]);          // array based constructor
+  UList(const UList<T>& otherList);     // copy constructor
+  UList(UList<T>&& otherList) noexcept; // move constructor
+  ~UList();                             // destructor
+
+  // assignment operators
+  UList<T>& operator=(const UList<T>& rhs);
+  UList<T>& operator=(UList<T>&& rhs) noexcept;
+
+  // accessor and information methods
+  int getNodeCount() const;
+  T getFront() const;
+  T getBack() const;
+  bool operator==(const List<T>& rhs) const;
+  T& operator[](int index) const;
+
+  // adding, accessing and removing values from the list
+  void clear();
+  List<T>& insertBack(const T& value);
+  List<T>& insertBack(T&& value);
+  List<T>& operator>>(const T& value);
+  void deleteBack();
+  List<T>& insertFront(const T& value);
+  List<T>& insertFront(T&& value);
+  List<T>& operator<<(const T& value);
+  void deleteFront();
+  void deleteValue(const T& value);
+  void deleteIndex(int index);
+  List<T>& insertAt(int index, const T& value);
+  List<T>& insertAt(int index, T&& value);
+
+  // iterating over list the C++ way, using forward iterator objects
+  // and supporting range based iteration and <algorithm>
+  using value_type = T;
+  using iterator = UListIterator<T>;
+  using const_iterator = UListIterator<const T>;
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+protected:
+  // writing values out to a stream, indexing our own values directly
+  void writeValues(ListWriter<T>& writer, int first, int count) const;
+
+private:
+  /// @brief pointer to the front or first node of the linked list.
+  UNode<T>* front;
+
+  /// @brief pointer to the back or last node of the linked list.
+  UNode<T>* back;
+
+  /// @brief the number of nodes currently linked into the list
+  int nodeCount;
+
+  /// @brief the pool that the memory for the nodes of this list
+  ///   comes from
+  NodePool<UNode<T>> nodePool;
+
+  /// @brief the node that was found by the last positional access of
+  ///   the list, or nullptr if there is no remembered position.  Walks
+  ///   to later indexes start from here instead of from the front.
+  mutable UNode<T>* cursor;
+
+  /// @brief the index in the list of the first value of the cursor node
+  mutable int cursorStart;
+
+  // private member methods for managing the nodes of the list
+  UNode<T>* nodeAt(int index, int& offset) const;
+  T* makeRoomAt(int index);
+  void removeAt(UNode<T>* node, int offset);
+  void mergeIfNeeded(UNode<T>* node);
+  void mergeWithNext(UNode<T>* node);
+  UNode<T>* linkNewNode(UNode<T>* prev, UNode<T>* next);
+  void unlinkNode(UNode<T>* node);
+  void invalidateCursor();
+  static void relocateValues(T* source, int count, T* destination);
+};
+
+// template member definitions
+#include "UList.ipp"
+
+#endif // define _ULIST_HPP_
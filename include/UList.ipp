@@ -0,0 +1,1093 @@
+/** @file UList.ipp
+ * @brief Concrete unrolled linked list implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the List abstraction using an unrolled linked list.  Each
+ * node holds a block of up to UNode<T>::CAPACITY values.  Values are
+ * appended to the back node until it is full, so a list built up from
+ * the back has completely full nodes.  Inserting into the middle of a
+ * full node splits it into two half full nodes, and removing values
+ * merges a node that is less than half full into a neighbor if the
+ * two fit into a single node, so nodes stay reasonably full.  Finding
+ * the node for an index walks whole nodes at a time, from whichever of
+ * the front, the back or the last accessed node is closest.
+ *
+ * This file is included at the end of UList.hpp and is not compiled on
+ * its own.
+ */
+#include "ListException.hpp"
+#include "UListIterator.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/** @brief Default constructor
+ *
+ * Construct an empty list.  The empty list will have no allocated memory
+ * nor any values.
+ */
+template<class T>
+UList<T>::UList()
+{
+  // Empty list has size 0, no nodes and both front and back are null
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+  nodeCount = 0;
+  invalidateCursor();
+}
+
+/** @brief Standard constructor
+ *
+ * Construct a list of values from a (statically) defined and provided
+ * array of values.  The values are appended one by one, which fills
+ * each node completely before the next one is started.
+ *
+ * @param size The size of the input values were are given as well as the
+ *   size of the new list we are to construct.
+ * @param values The (static) array of values to use to construct
+ *   this List values with.
+ */
+template<class T>
+UList<T>::UList(int size, T values[])
+{
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+  nodeCount = 0;
+  invalidateCursor();
+
+  for (int index = 0; index < size; index++)
+  {
+    insertBack(values[index]);
+  }
+}
+
+/** @brief Copy constructor
+ *
+ * Provide a copy constructor for the List class.  The copy gets new
+ * nodes of its own, from its own node pool, holding copies of the
+ * values of the given list.  The values are appended in order, so the
+ * nodes of the copy are completely full.
+ *
+ * @param list The other List type we are to make a copy of in this
+ *   constructor.
+ */
+template<class T>
+UList<T>::UList(const UList<T>& list)
+{
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+  nodeCount = 0;
+  invalidateCursor();
+
+  for (UNode<T>* node = list.front; node != nullptr; node = node->next)
+  {
+    for (int offset = 0; offset < node->count; offset++)
+    {
+      insertBack(node->values()[offset]);
+    }
+  }
+}
+
+/** @brief Move constructor
+ *
+ * Construct this list by taking over the nodes of the given list,
+ * which is left as an empty list.  The node pool is moved along with
+ * the nodes, since the nodes live in the memory it manages.
+ *
+ * @param list The other List whose nodes we are to take over.
+ */
+template<class T>
+UList<T>::UList(UList<T>&& list) noexcept
+  : nodePool(move(list.nodePool))
+{
+  // take over the nodes of the other list
+  this->size = list.size;
+  front = list.front;
+  back = list.back;
+  nodeCount = list.nodeCount;
+  invalidateCursor();
+
+  // the other list is now empty and no longer owns the nodes
+  list.size = 0;
+  list.front = nullptr;
+  list.back = nullptr;
+  list.nodeCount = 0;
+  list.invalidateCursor();
+}
+
+/** @brief Class destructor
+ *
+ * Destructor for the List class.  Invoke the clear of the list to
+ * destroy the values and give back the memory of the nodes.
+ */
+template<class T>
+UList<T>::~UList()
+{
+  this->clear();
+}
+
+/** @brief Copy assignment operator
+ *
+ * Replace the values of this list with a copy of the values of
+ * the right hand side list.  The copy is made first, so that
+ * this list is left unchanged if the copy fails.
+ *
+ * @param rhs The other List we are to make a copy of.
+ *
+ * @returns UList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+UList<T>& UList<T>::operator=(const UList<T>& rhs)
+{
+  if (this != &rhs)
+  {
+    // copy into a temporary then move the copy into this list
+    UList<T> copy(rhs);
+    *this = move(copy);
+  }
+
+  return *this;
+}
+
+/** @brief Move assignment operator
+ *
+ * Release the nodes of this list and take over the nodes of the
+ * right hand side list, which is left as an empty list.
+ *
+ * @param rhs The other List whose nodes we are to take over.
+ *
+ * @returns UList<T>& Returns a reference to this list after the
+ *   assignment.
+ */
+template<class T>
+UList<T>& UList<T>::operator=(UList<T>&& rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    // give back our own nodes before taking over the other list
+    clear();
+
+    this->size = rhs.size;
+    front = rhs.front;
+    back = rhs.back;
+    nodeCount = rhs.nodeCount;
+    nodePool = move(rhs.nodePool);
+
+    rhs.size = 0;
+    rhs.front = nullptr;
+    rhs.back = nullptr;
+    rhs.nodeCount = 0;
+    rhs.invalidateCursor();
+  }
+
+  return *this;
+}
+
+/** @brief Node count accessor
+ *
+ * Accessor method to get the number of nodes the values of this list
+ * are currently spread over.
+ *
+ * @returns int Returns the number of nodes of the list.
+ */
+template<class T>
+int UList<T>::getNodeCount() const
+{
+  return nodeCount;
+}
+
+/** @brief Access front of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the front of this list.
+ *
+ * @returns T Returns a copy of the front item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access front item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T UList<T>::getFront() const
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("UList::getFront", this->size);
+  }
+
+  return front->values()[0];
+}
+
+/** @brief Access back of list
+ *
+ * Accessor method to get a copy of the item currently
+ * at the back of this list.
+ *
+ * @returns T Returns a copy of the back item of the
+ *   list.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   access back item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+T UList<T>::getBack() const
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("UList::getBack", this->size);
+  }
+
+  return back->values()[back->count - 1];
+}
+
+/** @brief Write values to stream
+ *
+ * Write the given range of values to the output stream, separated by a
+ * comma and a space, walking the blocks from the first value rather
+ * than going through operator[] for each value.
+ *
+ * @param writer The stream or string to write the values to.
+ * @param first The index of the first value to write.
+ * @param count The number of values to write, at least 1.
+ */
+template<class T>
+void UList<T>::writeValues(ListWriter<T>& writer, int first, int count) const
+{
+  // find the block holding the first value once, then walk on through
+  // the blocks
+  int offset;
+  UNode<T>* node = nodeAt(first, offset);
+  writer.writeValue(node->values()[offset]);
+  for (int written = 1; written < count; written++)
+  {
+    offset++;
+    if (offset == node->count)
+    {
+      node = node->next;
+      offset = 0;
+    }
+    writer.writeText(", ");
+    writer.writeValue(node->values()[offset]);
+  }
+}
+
+/** @brief Boolean equals operator
+ *
+ * Check if this List is equal to the right hand side (rhs)
+ * list.  The lists are equal if their sizes are equal, and if
+ * all elements in both lists are equal.
+ * The comparison is done by List<T>::equals(), using whichever
+ * list is able to walk through its values fastest.
+ *
+ * @param rhs The other list on the right hand side of the
+ *   boolean comparison that we are comparing this List to.
+ *
+ * @returns bool true if the lists are equal, false if the are not.
+ */
+template<class T>
+bool UList<T>::operator==(const List<T>& rhs) const
+{
+  // the list that can walk through its own values does the comparing
+  return this->equals(rhs);
+}
+
+/** @brief Indexing operator
+ *
+ * Provide a way to index individual values of the list.  The node
+ * holding the index is found by walking whole nodes at a time, and
+ * the node found is remembered so that accessing the list at
+ * increasing indexes is O(1) for each access.
+ *
+ * @param index The index of the value it is desired to access from
+ *   this List.
+ *
+ * @returns T& Returns a reference to the requested List item at
+ *   the requested index.
+ *
+ * @throws ListMemoryBoundsException if a request for an index beyond
+ *   the end of the list (or less than 0) is made.
+ */
+template<class T>
+T& UList<T>::operator[](int index) const
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("UList::operator[]", this->size, index);
+  }
+
+  int offset;
+  UNode<T>* node = nodeAt(index, offset);
+  return node->values()[offset];
+}
+
+/** @brief Clear out list
+ *
+ * Clear or empty out the list.  Return the list back to an empty
+ * list.  The values of each node are destroyed, then the node pool
+ * gives the memory of all of the nodes back to the heap at once.
+ */
+template<class T>
+void UList<T>::clear()
+{
+  if (not is_trivially_destructible<T>::value)
+  {
+    for (UNode<T>* node = front; node != nullptr; node = node->next)
+    {
+      destroy(node->values(), node->values() + node->count);
+    }
+  }
+  nodePool.release();
+
+  // make sure size is now 0 and there are no more nodes
+  this->size = 0;
+  front = nullptr;
+  back = nullptr;
+  nodeCount = 0;
+  invalidateCursor();
+}
+
+/** @brief Insert value on back
+ *
+ * Append the indicated value to the end of this List of values.
+ * The value goes into the back node, or a new back node once the
+ * back node is full, so this is O(1).
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& UList<T>::insertBack(const T& value)
+{
+  return insertAt(this->size, value);
+}
+
+/** @brief Insert moved value on back
+ *
+ * Append the indicated value to the end of this List of values,
+ * moving the value into the list instead of copying it.
+ *
+ * @param value The value to move to the end of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& UList<T>::insertBack(T&& value)
+{
+  return insertAt(this->size, move(value));
+}
+
+/** @brief Overload operator>> to append
+ *
+ * Overload the operator>> to perform append operation.  Implementation
+ * is actually done by the insertBack() member function.
+ *
+ * @param value The value to append to the end of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& UList<T>::operator>>(const T& value)
+{
+  return insertBack(value);
+}
+
+/** @brief Delete back item
+ *
+ * Delete the item from the back of the list.  Removing the last value
+ * of the back node shifts nothing, so this is O(1).
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   delete back item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+void UList<T>::deleteBack()
+{
+  // make sure list is not empty before we try and access
+  // the back item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("UList::deleteBack", this->size);
+  }
+
+  removeAt(back, back->count - 1);
+}
+
+/** @brief Insert value on front
+ *
+ * Prepend the indicated value to the beginning of this List of
+ * values.  Only the values of the front node are shifted, so this is
+ * O(1) for a fixed node capacity.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& UList<T>::insertFront(const T& value)
+{
+  return insertAt(0, value);
+}
+
+/** @brief Insert moved value on front
+ *
+ * Prepend the indicated value to the beginning of this List of
+ * values, moving the value into the list instead of copying it.
+ *
+ * @param value The value to move to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& UList<T>::insertFront(T&& value)
+{
+  return insertAt(0, move(value));
+}
+
+/** @brief Overload operator<< to prepend
+ *
+ * Overload the operator<< to perform prepend operation.  Implementation
+ * is actually done by the insertFront() member function.
+ *
+ * @param value The value to prepend to the beginning of the current list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so that
+ *   the result can be used in further List operator expressions.
+ */
+template<class T>
+List<T>& UList<T>::operator<<(const T& value)
+{
+  return insertFront(value);
+}
+
+/** @brief Delete front item
+ *
+ * Delete the item from the front of the list.  Only the values of the
+ * front node are shifted, so this is O(1) for a fixed node capacity.
+ *
+ * @throws ListEmptyException If an attempt is made to
+ *   delete front item of an empty list, this exception
+ *   is generated and thrown instead.
+ */
+template<class T>
+void UList<T>::deleteFront()
+{
+  // make sure list is not empty before we try and access
+  // the front item
+  if (this->isEmpty())
+  {
+    throw ListEmptyException("UList::deleteFront", this->size);
+  }
+
+  removeAt(front, 0);
+}
+
+/** @brief Delete value(s)
+ *
+ * Delete the value from the list.  This method will delete all
+ * instances of the value from this list that it finds.  Each block is
+ * compacted in a single pass, then neighboring nodes that fit into one
+ * node are merged, so this is O(n) no matter how many values are
+ * removed.  If the list does not conatin the value, then an exception
+ * is thrown.
+ *
+ * @param value The value to deleted from this list.
+ *
+ * @throws ListValueNotFoundException If we are asked to delete a value
+ *   that does not exist, we thrown an exception instead of silently
+ *   ignoring this condition.
+ */
+template<class T>
+void UList<T>::deleteValue(const T& value)
+{
+  int removed = 0;
+  invalidateCursor();
+
+  // compact the values of each block, dropping nodes that become empty
+  UNode<T>* node = front;
+  while (node != nullptr)
+  {
+    T* values = node->values();
+    int kept = 0;
+    for (int offset = 0; offset < node->count; offset++)
+    {
+      if (values[offset] == value)
+      {
+        values[offset].~T();
+        removed++;
+      }
+      else
+      {
+        if (kept != offset)
+        {
+          relocateValues(values + offset, 1, values + kept);
+        }
+        kept++;
+      }
+    }
+    node->count = kept;
+
+    UNode<T>* next = node->next;
+    if (node->count == 0)
+    {
+      unlinkNode(node);
+    }
+    node = next;
+  }
+  this->size -= removed;
+
+  // if we didn't find a value to delete, let the caller know there
+  // may have been a problem
+  if (removed == 0)
+  {
+    throw ListValueNotFoundException("UList::deleteValue", value);
+  }
+
+  // merge the remaining nodes wherever neighbors fit into one node
+  for (node = front; node != nullptr; node = node->next)
+  {
+    while (node->next != nullptr and node->count + node->next->count <= UNode<T>::CAPACITY)
+    {
+      mergeWithNext(node);
+    }
+  }
+}
+
+/** @brief Delete value at index
+ *
+ * Delete the value from the indicated index in this list.  Only the
+ * values after it in the same node are shifted.
+ *
+ * @param index The index of the value in the list to be removed.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+void UList<T>::deleteIndex(int index)
+{
+  // first check that the requsted index is legally
+  // within the bounds of the current size of our list
+  if ((index < 0) or (index >= this->size))
+  {
+    throw ListMemoryBoundsException("UList::deleteIndex", this->size, index);
+  }
+
+  int offset;
+  UNode<T>* node = nodeAt(index, offset);
+  removeAt(node, offset);
+}
+
+/** @brief Insert value at index
+ *
+ * Insert the indicated value into this list so that it ends up at
+ * the given index.  Only the values after it in the same node are
+ * shifted, splitting the node first if it is full.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to insert into the list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so
+ *   that the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& UList<T>::insertAt(int index, const T& value)
+{
+  return insertAt(index, T(value));
+}
+
+/** @brief Insert moved value at index
+ *
+ * Insert the indicated value into this list at the given index,
+ * moving the value into the list instead of copying it.
+ *
+ * @param index The index the new value should have, from 0 up to and
+ *   including the current size of the list.
+ * @param value The value to move into the list.
+ *
+ * @returns List<T>& Returns a reference to this List instance, so
+ *   that the result can be used in further List operator expressions.
+ *
+ * @throws ListMemoryBoundsException If an index is given below the
+ *   beginning of the list or past the end we will throw a bounds
+ *   exception for the illegal memory access attempt.
+ */
+template<class T>
+List<T>& UList<T>::insertAt(int index, T&& value)
+{
+  // the index can be 1 past the back, which appends the value
+  if ((index < 0) or (index > this->size))
+  {
+    throw ListMemoryBoundsException("UList::insertAt", this->size, index);
+  }
+
+  new (makeRoomAt(index)) T(move(value));
+
+  return *this;
+}
+
+/** @brief Begin iterator
+ *
+ * Create and return an iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns iterator returns a new forward iterator that keeps track
+ *   of iterating over the list items.
+ */
+template<class T>
+typename UList<T>::iterator UList<T>::begin()
+{
+  return iterator(front, 0);
+}
+
+/** @brief End iterator
+ *
+ * Return an iterator pointing to one past the end of this list,
+ * which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns iterator returns a new forward iterator that points to
+ *   the end of the list.
+ */
+template<class T>
+typename UList<T>::iterator UList<T>::end()
+{
+  return iterator(nullptr, 0);
+}
+
+/** @brief Begin iterator of constant list
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename UList<T>::const_iterator UList<T>::begin() const
+{
+  return const_iterator(front, 0);
+}
+
+/** @brief End iterator of constant list
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, used when iterating over a const list.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename UList<T>::const_iterator UList<T>::end() const
+{
+  return const_iterator(nullptr, 0);
+}
+
+/** @brief Constant begin iterator
+ *
+ * Create and return a const iterator pointing to the beginning of
+ * this list of items, ready to be iterated over.
+ *
+ * @returns const_iterator returns a new forward iterator that only
+ *   gives read access to the list items.
+ */
+template<class T>
+typename UList<T>::const_iterator UList<T>::cbegin() const
+{
+  return const_iterator(front, 0);
+}
+
+/** @brief Constant end iterator
+ *
+ * Return a const iterator pointing to one past the end of this
+ * list, which is used to detect we are at the end of the list when
+ * iterating.
+ *
+ * @returns const_iterator returns a new forward iterator that points
+ *   to the end of the list.
+ */
+template<class T>
+typename UList<T>::const_iterator UList<T>::cend() const
+{
+  return const_iterator(nullptr, 0);
+}
+
+/** @brief Find node at index
+ *
+ * Private helper to find the node holding the value at the given
+ * index, and the offset of the value in the block of that node.  We
+ * start from whichever of the front, the back or the remembered
+ * cursor node is closest to the index, and walk whole nodes at a time
+ * from there.  The node found becomes the new cursor.  Since the
+ * cursor is updated by const accessors, a list must not be accessed
+ * by index from several threads at once.
+ *
+ * @param index The index of the value to find, must be a valid index
+ *   of this list.
+ * @param offset Returns the offset of the value in the block of the
+ *   node that is found.
+ *
+ * @returns UNode<T>* Returns a pointer to the node holding the index.
+ */
+template<class T>
+UNode<T>* UList<T>::nodeAt(int index, int& offset) const
+{
+  // pick the closest place to start walking from
+  UNode<T>* node = front;
+  int start = 0;
+  int distance = index;
+  if (this->size - index < distance)
+  {
+    node = back;
+    start = this->size - back->count;
+    distance = this->size - index;
+  }
+  if (cursor != nullptr and abs(index - cursorStart) < distance)
+  {
+    node = cursor;
+    start = cursorStart;
+  }
+
+  // walk back or forward until we reach the node holding the index
+  while (index < start)
+  {
+    node = node->prev;
+    start -= node->count;
+  }
+  while (index >= start + node->count)
+  {
+    start += node->count;
+    node = node->next;
+  }
+
+  // remember where we are for the next access
+  cursor = node;
+  cursorStart = start;
+  offset = index - start;
+  return node;
+}
+
+/** @brief Make room at index
+ *
+ * Private helper to open up an uninitialized slot for a new value at
+ * the given index, updating the counts so that the caller only has to
+ * construct the new value in the slot.  If the node the value belongs
+ * in is full, the value goes into the previous node when inserting at
+ * the start of a node and the previous node has room, or into a new
+ * node when inserting at either end of the node.  Otherwise the full
+ * node is split in half.
+ *
+ * @param index The index the new value will have, from 0 up to and
+ *   including the current size of the list.
+ *
+ * @returns T* Returns a pointer to the uninitialized slot.
+ */
+template<class T>
+T* UList<T>::makeRoomAt(int index)
+{
+  const int CAPACITY = UNode<T>::CAPACITY;
+
+  // find the node and offset the new value belongs at, appending goes
+  // at the end of the back node
+  UNode<T>* node;
+  int offset;
+  if (front == nullptr)
+  {
+    node = linkNewNode(nullptr, nullptr);
+    offset = 0;
+  }
+  else if (index == this->size)
+  {
+    node = back;
+    offset = back->count;
+  }
+  else
+  {
+    node = nodeAt(index, offset);
+  }
+
+  // the positions of values after an inserted value all change, only
+  // appending leaves the cursor valid
+  if (index != this->size)
+  {
+    invalidateCursor();
+  }
+
+  if (node->count == CAPACITY)
+  {
+    if (offset == 0 and node->prev != nullptr and node->prev->count < CAPACITY)
+    {
+      // the value can go on the end of the previous node instead
+      node = node->prev;
+      offset = node->count;
+    }
+    else if (offset == node->count)
+    {
+      node = linkNewNode(node, node->next);
+      offset = 0;
+    }
+    else if (offset == 0)
+    {
+      node = linkNewNode(node->prev, node);
+    }
+    else
+    {
+      // split the full node, moving its upper half into a new node
+      UNode<T>* newNode = linkNewNode(node, node->next);
+      int half = CAPACITY / 2;
+      relocateValues(node->values() + half, CAPACITY - half, newNode->values());
+      newNode->count = CAPACITY - half;
+      node->count = half;
+
+      if (offset > half)
+      {
+        node = newNode;
+        offset -= half;
+      }
+    }
+  }
+
+  // shift the values after the offset up to open the slot
+  T* values = node->values();
+  relocateValues(values + offset, node->count - offset, values + offset + 1);
+  node->count++;
+  this->size++;
+
+  return values + offset;
+}
+
+/** @brief Remove value at offset of node
+ *
+ * Private helper to destroy the value at the given offset of the block
+ * of the node, shift the values after it down, and merge the node with
+ * a neighbor if it has become less than half full.
+ *
+ * @param node The node holding the value to remove.
+ * @param offset The offset of the value in the block of the node.
+ */
+template<class T>
+void UList<T>::removeAt(UNode<T>* node, int offset)
+{
+  T* values = node->values();
+  values[offset].~T();
+  relocateValues(values + offset + 1, node->count - offset - 1, values + offset);
+  node->count--;
+  this->size--;
+
+  invalidateCursor();
+  mergeIfNeeded(node);
+}
+
+/** @brief Merge node if needed
+ *
+ * Private helper called after a value is removed from a node.  An
+ * empty node is removed from the list.  A node that is less than half
+ * full is merged with its next or previous neighbor, if the values of
+ * both fit into a single node.
+ *
+ * @param node The node a value was removed from.
+ */
+template<class T>
+void UList<T>::mergeIfNeeded(UNode<T>* node)
+{
+  const int CAPACITY = UNode<T>::CAPACITY;
+
+  if (node->count == 0)
+  {
+    unlinkNode(node);
+  }
+  else if (node->count < CAPACITY / 2)
+  {
+    if (node->next != nullptr and node->count + node->next->count <= CAPACITY)
+    {
+      mergeWithNext(node);
+    }
+    else if (node->prev != nullptr and node->prev->count + node->count <= CAPACITY)
+    {
+      mergeWithNext(node->prev);
+    }
+  }
+}
+
+/** @brief Merge node with next
+ *
+ * Private helper to move all of the values of the next node onto the
+ * end of the block of the given node, and remove the emptied next node
+ * from the list.  The values of both nodes must fit into one node.
+ *
+ * @param node The node to merge its next node into.
+ */
+template<class T>
+void UList<T>::mergeWithNext(UNode<T>* node)
+{
+  UNode<T>* next = node->next;
+  relocateValues(next->values(), next->count, node->values() + node->count);
+  node->count += next->count;
+  next->count = 0;
+  unlinkNode(next);
+}
+
+/** @brief Link new node
+ *
+ * Private helper to get a new empty node from the node pool and link
+ * it into the list between the given nodes.
+ *
+ * @param prev The node the new node comes after, or nullptr to make
+ *   the new node the front of the list.
+ * @param next The node the new node comes before, or nullptr to make
+ *   the new node the back of the list.
+ *
+ * @returns UNode<T>* Returns a pointer to the new node.
+ */
+template<class T>
+UNode<T>* UList<T>::linkNewNode(UNode<T>* prev, UNode<T>* next)
+{
+  UNode<T>* node = new (nodePool.allocate()) UNode<T>(prev, next);
+
+  if (prev == nullptr)
+  {
+    front = node;
+  }
+  else
+  {
+    prev->next = node;
+  }
+  if (next == nullptr)
+  {
+    back = node;
+  }
+  else
+  {
+    next->prev = node;
+  }
+  nodeCount++;
+
+  return node;
+}
+
+/** @brief Unlink node
+ *
+ * Private helper to remove an empty node from the list and give its
+ * memory back to the node pool.
+ *
+ * @param node The node to remove, which must no longer hold any values.
+ */
+template<class T>
+void UList<T>::unlinkNode(UNode<T>* node)
+{
+  if (node->prev == nullptr)
+  {
+    front = node->next;
+  }
+  else
+  {
+    node->prev->next = node->next;
+  }
+  if (node->next == nullptr)
+  {
+    back = node->prev;
+  }
+  else
+  {
+    node->next->prev = node->prev;
+  }
+
+  if (cursor == node)
+  {
+    invalidateCursor();
+  }
+  node->~UNode<T>();
+  nodePool.deallocate(node);
+  nodeCount--;
+}
+
+/** @brief Invalidate cursor
+ *
+ * Private helper to forget the remembered position of the last
+ * positional access.
+ */
+template<class T>
+void UList<T>::invalidateCursor()
+{
+  cursor = nullptr;
+  cursorStart = 0;
+}
+
+/** @brief Relocate values
+ *
+ * Private helper to move a run of values to a new place, within the
+ * same block or into another block.  The destination slots must be
+ * uninitialized, except where they overlap the source, and afterwards
+ * the source slots outside of the destination are uninitialized.
+ * Trivially copyable values are simply moved with memmove(), other
+ * values are move constructed and the originals destroyed, in the
+ * order that keeps overlapping runs intact.
+ *
+ * @param source The run of values to move.
+ * @param count The number of values to move.
+ * @param destination Where the run of values should end up.
+ */
+template<class T>
+void UList<T>::relocateValues(T* source, int count, T* destination)
+{
+  if (count == 0 or source == destination)
+  {
+    return;
+  }
+
+  if constexpr (is_trivially_copyable<T>::value)
+  {
+    memmove(destination, source, sizeof(T) * count);
+  }
+  else if (destination < source)
+  {
+    for (int index = 0; index < count; index++)
+    {
+      new (destination + index) T(move(source[index]));
+      source[index].~T();
+    }
+  }
+  else
+  {
+    for (int index = count - 1; index >= 0; index--)
+    {
+      new (destination + index) T(move(source[index]));
+      source[index].~T();
+    }
+  }
+}
@@ -0,0 +1,79 @@
+/** @file UListIterator.hpp
+ * @brief Concrete Iterator for UList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Definition of concrete UListIterator to iterate over
+ * UList<T> instances.
+ */
+#ifndef _ULIST_ITERATOR_HPP_
+#define _ULIST_ITERATOR_HPP_
+#include "UNode.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+using namespace std;
+
+/** @class UListIterator
+ * @brief The forward iterator for unrolled linked lists
+ *
+ * Iterate over the values of a UList<T> in list order, stepping
+ * through the block of values of each node before following the
+ * link to the next node.  A UListIterator<T> gives access to modify
+ * the values, a UListIterator<const T> is the const_iterator of the
+ * list and only gives read access.  These are standard iterators, so
+ * they work with range based iteration as well as with the <algorithm>
+ * library.
+ */
+template<class T>
+class UListIterator
+{
+public:
+  // standard iterator traits
+  using iterator_category = forward_iterator_tag;
+  using value_type = remove_const_t<T>;
+  using difference_type = ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  // constructors
+  UListIterator();
+  UListIterator(UNode<value_type>* node, int offset);
+  template<class U, class = enable_if_t<is_same<const U, T>::value>>
+  UListIterator(const UListIterator<U>& other);
+
+  // accessing the current value
+  reference operator*() const;
+  pointer operator->() const;
+
+  // moving the iterator
+  UListIterator<T>& operator++();
+  UListIterator<T> operator++(int);
+
+  // comparing iterators, mutable and const iterators can be mixed
+  template<class U>
+  bool operator==(const UListIterator<U>& rhs) const;
+  template<class U>
+  bool operator!=(const UListIterator<U>& rhs) const;
+
+private:
+  /// @brief pointer to the node holding the current value of
+  ///   the iteration, or nullptr once past the end of the list
+  UNode<value_type>* node;
+
+  /// @brief the offset of the current value in the block of the node
+  int offset;
+
+  // the const iterator is built from and compared to the mutable one
+  template<class U>
+  friend class UListIterator;
+};
+
+// template member definitions
+#include "UListIterator.ipp"
+
+#endif // define _ULIST_ITERATOR_HPP_
@@ -0,0 +1,167 @@
+/** @file UListIterator.ipp
+ * @brief Concrete Iterator for UList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implementation of concrete UListIterator to iterate over
+ * UList<T> instances.
+ *
+ * This file is included at the end of UListIterator.hpp and is not
+ * compiled on its own.
+ */
+#include <string>
+using namespace std;
+
+/**
+ * @brief Default constructor
+ *
+ * Default constructor, iterator will not be iterating over
+ * anything if constructed using the default constructor.
+ */
+template<class T>
+UListIterator<T>::UListIterator()
+{
+  node = nullptr;
+  offset = 0;
+}
+
+/**
+ * @brief Standard constructor
+ *
+ * Standard constructor, we are given the node and the offset into
+ * its block of the value we are to begin iteration with.
+ *
+ * @param node A pointer to the UNode<T> holding the value at the
+ *   start of this iteration, or nullptr for the end of the list.
+ * @param offset The offset of the value in the block of the node.
+ */
+template<class T>
+UListIterator<T>::UListIterator(UNode<value_type>* node, int offset)
+{
+  this->node = node;
+  this->offset = offset;
+}
+
+/**
+ * @brief Converting constructor
+ *
+ * A mutable iterator can be turned into a const iterator to the same
+ * value, but not the other way around.
+ *
+ * @param other The mutable iterator to convert.
+ */
+template<class T>
+template<class U, class>
+UListIterator<T>::UListIterator(const UListIterator<U>& other)
+{
+  this->node = other.node;
+  this->offset = other.offset;
+}
+
+/**
+ * @brief Overload dereference operator
+ *
+ * Overload the dereference operator* for the UListIterator.
+ * This method makes it easy/convenient to access the info
+ * that the iterator is currently pointing two.
+ *
+ * @returns reference Returns a reference to the value currently being
+ *   pointed to by this iterator.
+ */
+template<class T>
+typename UListIterator<T>::reference UListIterator<T>::operator*() const
+{
+  return node->values()[offset];
+}
+
+/**
+ * @brief Overload member access operator
+ *
+ * @returns pointer Returns a pointer to the value currently being
+ *   pointed to by this iterator.
+ */
+template<class T>
+typename UListIterator<T>::pointer UListIterator<T>::operator->() const
+{
+  return &**this;
+}
+
+/**
+ * @brief Overload increment operator
+ *
+ * Overload the pre increment operator++.  This is defined to cause the
+ * iterator to move to the next value of the block of the current node,
+ * or to the first value of the next node once the block is done.
+ *
+ * @returns UListIterator<T>& We need to return ourself after incrementing
+ *   the iterator to the next value of the list we are iterating over.
+ */
+template<class T>
+UListIterator<T>& UListIterator<T>::operator++()
+{
+  offset++;
+  if (offset == node->count)
+  {
+    node = node->next;
+    offset = 0;
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Overload post increment operator
+ *
+ * @returns UListIterator<T> Returns a copy of ourself from before we
+ *   were moved to the next value.
+ */
+template<class T>
+UListIterator<T> UListIterator<T>::operator++(int)
+{
+  UListIterator<T> before(*this);
+  ++*this;
+
+  return before;
+}
+
+/**
+ * @brief Overload boolean equality operator
+ *
+ * Overload the boolean operator== to check for equivalence.  This is
+ * needed to create loops and test if we are done yet or not iterating
+ * over the list by testing if the iterator is == the end() iterator item.
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators are both pointing to the same
+ *   value of the iteration, false otherwise.
+ */
+template<class T>
+template<class U>
+bool UListIterator<T>::operator==(const UListIterator<U>& rhs) const
+{
+  return node == rhs.node and offset == rhs.offset;
+}
+
+/**
+ * @brief Overload boolean not equal operator
+ *
+ * Overload the boolean operator!= to check for nonequivalance.  This is
+ * needed to create loops and test if we are done yet or not iterating
+ * over the list by testing if the iterator is != the end() iterator item.
+ *
+ * @param rhs The other iterator we are comparing ourself against.
+ *
+ * @returns bool True if the iterators are not pointing to the same
+ *   value of the iteration, false otherwise.
+ */
+template<class T>
+template<class U>
+bool UListIterator<T>::operator!=(const UListIterator<U>& rhs) const
+{
+  return not(*this == rhs);
+}
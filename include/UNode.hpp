@@ -0,0 +1,63 @@
+/** @file UNode.hpp
+ * @brief Definition of the UNode class used by UList unrolled lists.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Definition of UNode class used by UList unrolled linked list
+ * implementations and supporting iteration classes.  Simplifies
+ * inclusion circular references to put this structure definition in
+ * its own file.
+ */
+#ifndef _UNODE_HPP_
+#define _UNODE_HPP_
+using namespace std;
+
+/** UNode
+ * A node of an unrolled linked list.  Instead of a single value, each
+ * node holds a small block of up to CAPACITY values, sized to fill
+ * about 4 cache lines, along with the count of values it currently
+ * holds.  The block is raw storage, only the first count slots hold
+ * constructed values.
+ */
+template<class T>
+struct UNode
+{
+public:
+  /// @brief the number of values that fit in the block of a node, enough
+  ///   to fill 256 bytes but never fewer than 4 values
+  static const int CAPACITY = (256 / sizeof(T) > 4) ? 256 / sizeof(T) : 4;
+
+  /// @brief Construct an empty node linked between the given nodes.
+  UNode(UNode<T>* prev, UNode<T>* next)
+    : count(0),
+      prev(prev),
+      next(next)
+  {
+  }
+
+  /// @brief access the block of this node as an array of values
+  T* values()
+  {
+    return reinterpret_cast<T*>(storage);
+  }
+
+  /// @brief the raw storage for the block of values of this node
+  alignas(T) unsigned char storage[sizeof(T) * CAPACITY];
+
+  /// @brief the number of values currently held in this node
+  int count;
+
+  /// @brief A pointer to the previous node of the linked list, or
+  ///    nullptr if this node is the front node.
+  UNode<T>* prev;
+
+  /// @brief A pointer to the next node of the linked list, or
+  ///    nullptr if this node is the back node.
+  UNode<T>* next;
+};
+
+#endif // define _UNODE_HPP_
@@ -0,0 +1,27 @@
+/** @file DLList.cpp
+ * @brief Concrete doubly linked list implementation of List ADT.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * The members are defined in DLList.ipp, which the header includes, so
+ * this file only compiles the instances of the template in common use.
+ */
+#include "DLList.hpp"
+#include <string>
+using namespace std;
+
+/**
+ * @brief Compile the common instances
+ *
+ * The definitions are included by the header, so that the template can
+ * be instantiated for any type where it is used.  We still explicitly
+ * instantiate it here for the types the tests and main program use,
+ * so that every member is compiled and checked, and not only those
+ * members that happen to be called.
+ */
+template class DLList<int>;
+template class DLList<string>;
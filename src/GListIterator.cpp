@@ -0,0 +1,30 @@
+/** @file GListIterator.cpp
+ * @brief Concrete Iterator for GList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * The members are defined in GListIterator.ipp, which the header
+ * includes, so this file only compiles the instances of the template
+ * in common use.
+ */
+#include "GListIterator.hpp"
+#include <string>
+using namespace std;
+
+/**
+ * @brief Compile the common instances
+ *
+ * The definitions are included by the header, so that the template can
+ * be instantiated for any type where it is used.  We still explicitly
+ * instantiate it here for the types the tests and main program use,
+ * so that every member is compiled and checked, and not only those
+ * members that happen to be called.
+ */
+template class GListIterator<int>;
+template class GListIterator<const int>;
+template class GListIterator<string>;
+template class GListIterator<const string>;
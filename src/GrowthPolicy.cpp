@@ -0,0 +1,228 @@
+/** @file GrowthPolicy.cpp
+ * @brief Growth policies for array based List implementations.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the GrowthPolicy decisions of how large the block of
+ * memory of an array based list should be as it grows and shrinks.
+ */
+#include "GrowthPolicy.hpp"
+#include <climits>
+using namespace std;
+
+/**
+ * @brief Default constructor
+ *
+ * The default policy doubles the allocation whenever the list is full,
+ * starting from an allocation of 10 values, and never shrinks.
+ */
+GrowthPolicy::GrowthPolicy()
+{
+  growthType = DOUBLING;
+  initialAllocationSize = 10;
+  chunkSize = 10;
+  autoShrink = false;
+}
+
+/**
+ * @brief Standard constructor
+ *
+ * Construct a policy with all of its settings given explicitly.  An
+ * initial allocation size or chunk size below 1 could never grow the
+ * allocation, so they are raised to 1.
+ *
+ * @param growthType The way the allocation is grown when the list is full.
+ * @param initialAllocationSize The allocation size an empty list grows to,
+ *   at least 1.
+ * @param chunkSize The number of values FIXED_CHUNK growth adds to the
+ *   allocation, at least 1.
+ * @param autoShrink True if the allocation should be reduced as values
+ *   are removed from the list.
+ */
+GrowthPolicy::GrowthPolicy(GrowthType growthType, int initialAllocationSize, int chunkSize, bool autoShrink)
+{
+  this->growthType = growthType;
+  this->initialAllocationSize = initialAllocationSize < 1 ? 1 : initialAllocationSize;
+  this->chunkSize = chunkSize < 1 ? 1 : chunkSize;
+  this->autoShrink = autoShrink;
+}
+
+/**
+ * @brief Doubling policy
+ *
+ * @returns GrowthPolicy Returns the default policy, which doubles the
+ *   allocation whenever the list is full.
+ */
+GrowthPolicy GrowthPolicy::doubling()
+{
+  return GrowthPolicy();
+}
+
+/**
+ * @brief One and a half policy
+ *
+ * @returns GrowthPolicy Returns a policy that grows the allocation by
+ *   half of its current size whenever the list is full.  This wastes
+ *   less memory than doubling, at the cost of growing more often.
+ */
+GrowthPolicy GrowthPolicy::oneAndHalf()
+{
+  return GrowthPolicy(ONE_AND_HALF, 10, 10, false);
+}
+
+/**
+ * @brief Fixed chunk policy
+ *
+ * @param chunkSize The number of values to add to the allocation each
+ *   time the list is full, at least 1.
+ *
+ * @returns GrowthPolicy Returns a policy that grows the allocation by
+ *   a fixed number of values whenever the list is full.  Memory overhead
+ *   is bounded by the chunk size, but appending n values is O(n^2 / chunk).
+ */
+GrowthPolicy GrowthPolicy::fixedChunk(int chunkSize)
+{
+  return GrowthPolicy(FIXED_CHUNK, chunkSize, chunkSize, false);
+}
+
+/**
+ * @brief Growth type accessor
+ *
+ * @returns GrowthType Returns the way this policy grows the allocation.
+ */
+GrowthPolicy::GrowthType GrowthPolicy::getGrowthType() const
+{
+  return growthType;
+}
+
+/**
+ * @brief Initial allocation size accessor
+ *
+ * @returns int Returns the allocation size an empty list grows to.
+ */
+int GrowthPolicy::getInitialAllocationSize() const
+{
+  return initialAllocationSize;
+}
+
+/**
+ * @brief Chunk size accessor
+ *
+ * @returns int Returns the number of values FIXED_CHUNK growth adds.
+ */
+int GrowthPolicy::getChunkSize() const
+{
+  return chunkSize;
+}
+
+/**
+ * @brief Auto shrink accessor
+ *
+ * @returns bool Returns true if lists using this policy give memory
+ *   back as values are removed.
+ */
+bool GrowthPolicy::isAutoShrink() const
+{
+  return autoShrink;
+}
+
+/**
+ * @brief Copy with auto shrink setting
+ *
+ * @param autoShrink True if the allocation should be reduced as values
+ *   are removed from the list.
+ *
+ * @returns GrowthPolicy Returns a copy of this policy with the auto
+ *   shrink setting changed.
+ */
+GrowthPolicy GrowthPolicy::withAutoShrink(bool autoShrink) const
+{
+  GrowthPolicy policy = *this;
+  policy.autoShrink = autoShrink;
+  return policy;
+}
+
+/**
+ * @brief Grow allocation size
+ *
+ * Determine the new allocation size of a list whose current allocation
+ * is not large enough.  The growth rule of the policy is applied until
+ * the allocation can hold the required number of values.  Growth is
+ * capped at INT_MAX rather than overflowing for very large lists.
+ *
+ * @param allocationSize The current allocation size of the list.
+ * @param requiredSize The number of values the list needs room for.
+ *
+ * @returns int Returns the new allocation size, which is at least the
+ *   required size.
+ */
+int GrowthPolicy::grow(int allocationSize, int requiredSize) const
+{
+  // an empty list starts out at the initial allocation size
+  int newAllocationSize = allocationSize;
+  if (newAllocationSize <= 0)
+  {
+    newAllocationSize = initialAllocationSize;
+  }
+
+  while (newAllocationSize < requiredSize)
+  {
+    // work out the amount to grow by, so the sum can be checked for overflow
+    int growth = 0;
+    switch (growthType)
+    {
+    case DOUBLING:
+      growth = newAllocationSize;
+      break;
+    case ONE_AND_HALF:
+      // always grow by at least 1 value, even for tiny allocations
+      growth = newAllocationSize / 2 + 1;
+      break;
+    case FIXED_CHUNK:
+      growth = chunkSize;
+      break;
+    }
+
+    if (growth > INT_MAX - newAllocationSize)
+    {
+      return INT_MAX;
+    }
+    newAllocationSize = newAllocationSize + growth;
+  }
+
+  return newAllocationSize;
+}
+
+/**
+ * @brief Shrink allocation size
+ *
+ * Determine the allocation size a list should shrink to after values
+ * were removed from it.  If auto shrinking is not enabled, or the list
+ * is still more than a quarter full, the allocation is kept as is.
+ * Otherwise the allocation is halved, though never below the initial
+ * allocation size.
+ *
+ * @param allocationSize The current allocation size of the list.
+ * @param size The number of values currently in the list.
+ *
+ * @returns int Returns the allocation size the list should have, which
+ *   is the current allocation size if it should not shrink.
+ */
+int GrowthPolicy::shrink(int allocationSize, int size) const
+{
+  if (not autoShrink or allocationSize <= initialAllocationSize or size > allocationSize / 4)
+  {
+    return allocationSize;
+  }
+
+  int newAllocationSize = allocationSize / 2;
+  if (newAllocationSize < initialAllocationSize)
+  {
+    newAllocationSize = initialAllocationSize;
+  }
+  return newAllocationSize;
+}
@@ -11,6 +11,7 @@
  * instances.
  */
 #include "ListException.hpp"
+#include <sstream>
 #include <string>
 using namespace std;
 
@@ -25,6 +26,25 @@ using namespace std;
 ListEmptyException::ListEmptyException(const string& message)
 {
   this->message = message;
+  this->operation = "";
+  this->size = 0;
+}
+
+/**
+ * @brief ListEmptyException constructor
+ *
+ * Constructor for the exception thrown by a list operation that needs
+ * a value, when the list has none.  Only the facts are kept here, the
+ * message is formatted by what().
+ *
+ * @param operation The name of the list operation that failed, this
+ *   must be a string literal.
+ * @param size The size of the list when the operation failed.
+ */
+ListEmptyException::ListEmptyException(const char* operation, int size)
+{
+  this->operation = operation;
+  this->size = size;
 }
 
 /**
@@ -39,16 +59,53 @@ ListEmptyException::~ListEmptyException() {}
  * @brief ListEmptyException message
  *
  * Accessor method to access/return message given when an exception occurs.
+ * The message is formatted the first time it is asked for.
  *
  * @returns char* Returns a const old style c character array message for
  *   display/use by the process that catches this exception.
  */
 const char* ListEmptyException::what() const throw()
 {
+  if (message.empty())
+  {
+    try
+    {
+      ostringstream out;
+      out << "Error: <" << operation << "> attempt to access item"
+          << " from empty list, size:  " << size;
+      message = out.str();
+    }
+    catch (...)
+    {
+      return "Error: attempt to access item from empty list";
+    }
+  }
+
   // what expects old style array of characters, so convert to that
   return message.c_str();
 }
 
+/**
+ * @brief ListEmptyException operation
+ *
+ * @returns const char* Returns the name of the list operation that
+ *   failed, empty if the exception was given a message instead.
+ */
+const char* ListEmptyException::getOperation() const
+{
+  return operation;
+}
+
+/**
+ * @brief ListEmptyException size
+ *
+ * @returns int Returns the size of the list when the operation failed.
+ */
+int ListEmptyException::getSize() const
+{
+  return size;
+}
+
 /**
  * @brief ListMemoryBoundsException constructor
  *
@@ -60,6 +117,28 @@ const char* ListEmptyException::what() const throw()
 ListMemoryBoundsException::ListMemoryBoundsException(const string& message)
 {
   this->message = message;
+  this->operation = "";
+  this->size = 0;
+  this->index = 0;
+}
+
+/**
+ * @brief ListMemoryBoundsException constructor
+ *
+ * Constructor for the exception thrown by a list operation given an
+ * index outside of the list.  Only the facts are kept here, the
+ * message is formatted by what().
+ *
+ * @param operation The name of the list operation that failed, this
+ *   must be a string literal.
+ * @param size The size of the list when the operation failed.
+ * @param index The illegal index the operation was asked to access.
+ */
+ListMemoryBoundsException::ListMemoryBoundsException(const char* operation, int size, int index)
+{
+  this->operation = operation;
+  this->size = size;
+  this->index = index;
 }
 
 /**
@@ -74,16 +153,63 @@ ListMemoryBoundsException::~ListMemoryBoundsException() {}
  * @brief ListMemoryBoundsException message
  *
  * Accessor method to access/return message given when an exception occurs.
+ * The message is formatted the first time it is asked for.
  *
  * @returns char* Returns a const old style c character array message for
  *   display/use by the process that catches this exception.
  */
 const char* ListMemoryBoundsException::what() const throw()
 {
+  if (message.empty())
+  {
+    try
+    {
+      ostringstream out;
+      out << "Error: <" << operation << "> illegal bounds access, list size: " << size << " tried to access index address: " << index;
+      message = out.str();
+    }
+    catch (...)
+    {
+      return "Error: illegal bounds access";
+    }
+  }
+
   // what expects old style array of characters, so convert to that
   return message.c_str();
 }
 
+/**
+ * @brief ListMemoryBoundsException operation
+ *
+ * @returns const char* Returns the name of the list operation that
+ *   failed, empty if the exception was given a message instead.
+ */
+const char* ListMemoryBoundsException::getOperation() const
+{
+  return operation;
+}
+
+/**
+ * @brief ListMemoryBoundsException size
+ *
+ * @returns int Returns the size of the list when the operation failed.
+ */
+int ListMemoryBoundsException::getSize() const
+{
+  return size;
+}
+
+/**
+ * @brief ListMemoryBoundsException index
+ *
+ * @returns int Returns the illegal index the operation was asked to
+ *   access.
+ */
+int ListMemoryBoundsException::getIndex() const
+{
+  return index;
+}
+
 /**
  * @brief ListValueNotFoundException constructor
  *
@@ -95,6 +221,68 @@ const char* ListMemoryBoundsException::what() const throw()
 ListValueNotFoundException::ListValueNotFoundException(const string& message)
 {
   this->message = message;
+  this->operation = "";
+  this->formatValue = nullptr;
+  this->copyValue = nullptr;
+  this->destroyValue = nullptr;
+}
+
+/**
+ * @brief ListValueNotFoundException copy constructor
+ *
+ * Copy the exception, along with its own copy of the value that was
+ * not found.
+ *
+ * @param other The exception to copy.
+ */
+ListValueNotFoundException::ListValueNotFoundException(const ListValueNotFoundException& other)
+  : exception(other),
+    message(other.message),
+    operation(other.operation),
+    formatValue(other.formatValue),
+    copyValue(other.copyValue),
+    destroyValue(other.destroyValue)
+{
+  if (copyValue != nullptr)
+  {
+    copyValue(valueBytes, other.valueBytes);
+  }
+}
+
+/**
+ * @brief ListValueNotFoundException assignment
+ *
+ * @param rhs The exception to copy.
+ *
+ * @returns ListValueNotFoundException& Returns this exception, now a
+ *   copy of the rhs.
+ */
+ListValueNotFoundException& ListValueNotFoundException::operator=(const ListValueNotFoundException& rhs)
+{
+  if (this != &rhs)
+  {
+    // give up our own value before taking a copy of theirs
+    if (destroyValue != nullptr)
+    {
+      destroyValue(valueBytes);
+      formatValue = nullptr;
+      copyValue = nullptr;
+      destroyValue = nullptr;
+    }
+
+    exception::operator=(rhs);
+    message = rhs.message;
+    operation = rhs.operation;
+    if (rhs.copyValue != nullptr)
+    {
+      rhs.copyValue(valueBytes, rhs.valueBytes);
+      formatValue = rhs.formatValue;
+      copyValue = rhs.copyValue;
+      destroyValue = rhs.destroyValue;
+    }
+  }
+
+  return *this;
 }
 
 /**
@@ -103,18 +291,208 @@ ListValueNotFoundException::ListValueNotFoundException(const string& message)
  * Destructor for exceptions used for our ListValueNotFoundException
  * class.
  */
-ListValueNotFoundException::~ListValueNotFoundException() {}
+ListValueNotFoundException::~ListValueNotFoundException()
+{
+  if (destroyValue != nullptr)
+  {
+    destroyValue(valueBytes);
+  }
+}
 
 /**
  * @brief ListValueNotFoundException message
  *
  * Accessor method to access/return message given when an exception occurs.
+ * The message is formatted the first time it is asked for.
  *
  * @returns char* Returns a const old style c character array message for
  *   display/use by the process that catches this exception.
  */
 const char* ListValueNotFoundException::what() const throw()
 {
+  if (message.empty())
+  {
+    try
+    {
+      ostringstream out;
+      out << "Error: <" << operation << "> asked to delete value";
+      if (formatValue != nullptr)
+      {
+        out << ": ";
+        formatValue(out, valueBytes);
+      }
+      out << " but this value was not currently in the list";
+      message = out.str();
+    }
+    catch (...)
+    {
+      return "Error: value was not currently in the list";
+    }
+  }
+
+  // what expects old style array of characters, so convert to that
+  return message.c_str();
+}
+
+/**
+ * @brief ListValueNotFoundException operation
+ *
+ * @returns const char* Returns the name of the list operation that
+ *   failed, empty if the exception was given a message instead.
+ */
+const char* ListValueNotFoundException::getOperation() const
+{
+  return operation;
+}
+
+/**
+ * @brief ListValueNotFoundException value
+ *
+ * @returns bool Returns true if the exception kept a copy of the value
+ *   that was not found, and so shows it in its message.
+ */
+bool ListValueNotFoundException::hasValue() const
+{
+  return formatValue != nullptr;
+}
+
+/**
+ * @brief ListFileException constructor
+ *
+ * Constructor for the exception thrown when a list can not be saved
+ * to or loaded from a file.  Only the facts are kept here, the message
+ * is formatted by what().
+ *
+ * @param operation The name of the list operation that failed, this
+ *   must be a string literal.
+ * @param path The path of the file being saved or loaded.
+ * @param problem What went wrong with the file, this must be a string
+ *   literal.
+ */
+ListFileException::ListFileException(const char* operation, const string& path, const char* problem)
+  : operation(operation),
+    path(path),
+    problem(problem)
+{
+}
+
+/**
+ * @brief ListFileException destructor
+ *
+ * Destructor for exceptions used for our ListFileException
+ * class.
+ */
+ListFileException::~ListFileException() {}
+
+/**
+ * @brief ListFileException message
+ *
+ * Accessor method to access/return message given when an exception occurs.
+ * The message is formatted the first time it is asked for.
+ *
+ * @returns char* Returns a const old style c character array message for
+ *   display/use by the process that catches this exception.
+ */
+const char* ListFileException::what() const throw()
+{
+  if (message.empty())
+  {
+    try
+    {
+      ostringstream out;
+      out << "Error: <" << operation << "> " << problem << ", file: " << path;
+      message = out.str();
+    }
+    catch (...)
+    {
+      return "Error: list file could not be saved or loaded";
+    }
+  }
+
+  // what expects old style array of characters, so convert to that
+  return message.c_str();
+}
+
+/**
+ * @brief ListFileException operation
+ *
+ * @returns const char* Returns the name of the list operation that
+ *   failed.
+ */
+const char* ListFileException::getOperation() const
+{
+  return operation;
+}
+
+/**
+ * @brief ListFileException path
+ *
+ * @returns const string& Returns the path of the file that could not
+ *   be saved or loaded.
+ */
+const string& ListFileException::getPath() const
+{
+  return path;
+}
+
+/**
+ * @brief ListReadOnlyException constructor
+ *
+ * Constructor for the exception thrown when a list that can not be
+ * changed is asked to insert or remove values.
+ *
+ * @param operation The name of the list operation that failed, this
+ *   must be a string literal.
+ */
+ListReadOnlyException::ListReadOnlyException(const char* operation)
+  : operation(operation)
+{
+}
+
+/**
+ * @brief ListReadOnlyException destructor
+ *
+ * Destructor for exceptions used for our ListReadOnlyException
+ * class.
+ */
+ListReadOnlyException::~ListReadOnlyException() {}
+
+/**
+ * @brief ListReadOnlyException message
+ *
+ * Accessor method to access/return message given when an exception occurs.
+ * The message is formatted the first time it is asked for.
+ *
+ * @returns char* Returns a const old style c character array message for
+ *   display/use by the process that catches this exception.
+ */
+const char* ListReadOnlyException::what() const throw()
+{
+  if (message.empty())
+  {
+    try
+    {
+      ostringstream out;
+      out << "Error: <" << operation << "> attempt to change a list that is read only";
+      message = out.str();
+    }
+    catch (...)
+    {
+      return "Error: attempt to change a list that is read only";
+    }
+  }
+
   // what expects old style array of characters, so convert to that
   return message.c_str();
-}
\ No newline at end of file
+}
+
+/**
+ * @brief ListReadOnlyException operation
+ *
+ * @returns const char* Returns the name of the list operation that
+ *   failed.
+ */
+const char* ListReadOnlyException::getOperation() const
+{
+  return operation;
+}
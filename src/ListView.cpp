@@ -0,0 +1,27 @@
+/** @file ListView.cpp
+ * @brief Non-owning view of the values of an array or AList.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * The members are defined in ListView.ipp, which the header includes, so
+ * this file only compiles the instances of the template in common use.
+ */
+#include "ListView.hpp"
+#include <string>
+using namespace std;
+
+/**
+ * @brief Compile the common instances
+ *
+ * The definitions are included by the header, so that the template can
+ * be instantiated for any type where it is used.  We still explicitly
+ * instantiate it here for the types the tests and main program use,
+ * so that every member is compiled and checked, and not only those
+ * members that happen to be called.
+ */
+template class ListView<int>;
+template class ListView<string>;
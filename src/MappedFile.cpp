@@ -0,0 +1,239 @@
+/** @file MappedFile.cpp
+ * @brief File mapped into memory, the storage of a file backed AList.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * Implement the MappedFile with the POSIX file and memory mapping
+ * calls.  Growing an existing mapping uses mremap, which is specific
+ * to Linux, so the kernel can move the mapping without copying it.
+ */
+#include "MappedFile.hpp"
+#include "ListException.hpp"
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+/**
+ * @brief Standard constructor
+ *
+ * Open the file and map all of it into memory.  A writable file is
+ * created empty if it does not exist yet.  An empty file is not
+ * mapped until it is resized.
+ *
+ * @param operation The name of the list operation opening the file,
+ *   this must be a string literal.
+ * @param path The path of the file to open.
+ * @param readOnly True to map the file private and never change it,
+ *   false to map it shared so that changes are written to the file.
+ *
+ * @throws ListFileException If the file can not be opened or mapped.
+ */
+MappedFile::MappedFile(const char* operation, const string& path, bool readOnly)
+{
+  this->path = path;
+  this->readOnly = readOnly;
+  data = nullptr;
+  length = 0;
+
+  descriptor = readOnly ? open(path.c_str(), O_RDONLY) : open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (descriptor < 0)
+  {
+    throw ListFileException(operation, path, "could not open list file");
+  }
+
+  struct stat status;
+  if (fstat(descriptor, &status) != 0)
+  {
+    ::close(descriptor);
+    throw ListFileException(operation, path, "could not open list file");
+  }
+  length = status.st_size;
+
+  if (length > 0)
+  {
+    // even a read only file is mapped writable, as private copy on write
+    // pages, so the values can be changed in memory like any other list
+    void* mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, readOnly ? MAP_PRIVATE : MAP_SHARED, descriptor, 0);
+    if (mapping == MAP_FAILED)
+    {
+      ::close(descriptor);
+      throw ListFileException(operation, path, "could not map list file");
+    }
+    data = static_cast<unsigned char*>(mapping);
+  }
+}
+
+/**
+ * @brief Class destructor
+ *
+ * Unmap and close the file, leaving its length as it is.  Changed pages
+ * of a writable file are written back by the kernel.
+ */
+MappedFile::~MappedFile()
+{
+  unmap();
+  if (descriptor >= 0)
+  {
+    ::close(descriptor);
+  }
+}
+
+/**
+ * @brief Data accessor
+ *
+ * @returns unsigned char* Returns the start of the mapped file, or
+ *   nullptr if the file is empty.
+ */
+unsigned char* MappedFile::getData() const
+{
+  return data;
+}
+
+/**
+ * @brief Length accessor
+ *
+ * @returns uint64_t Returns the length of the file in bytes.
+ */
+uint64_t MappedFile::getLength() const
+{
+  return length;
+}
+
+/**
+ * @brief Read only accessor
+ *
+ * @returns bool Returns true if changes are never written to the file.
+ */
+bool MappedFile::isReadOnly() const
+{
+  return readOnly;
+}
+
+/**
+ * @brief Path accessor
+ *
+ * @returns const string& Returns the path the file was opened with.
+ */
+const string& MappedFile::getPath() const
+{
+  return path;
+}
+
+/**
+ * @brief Resize file
+ *
+ * Change the length of a writable file, and of its mapping along with
+ * it.  The mapping is resized with mremap, which may move it to another
+ * address, but never copies the pages of the file.  A file grows before
+ * its mapping does, and shrinks after, so the mapping never reaches
+ * past the end of the file.  If resizing fails the file is left mapped
+ * at its old length, though the file itself may be left longer.
+ *
+ * @param operation The name of the list operation resizing the file,
+ *   this must be a string literal.
+ * @param length The new length of the file, must be more than 0.
+ *
+ * @throws ListFileException If the file can not be resized.
+ */
+void MappedFile::resize(const char* operation, uint64_t length)
+{
+  if (length == this->length)
+  {
+    return;
+  }
+
+  if (length > this->length and ftruncate(descriptor, length) != 0)
+  {
+    throw ListFileException(operation, path, "could not grow list file");
+  }
+
+  void* mapping;
+  if (data == nullptr)
+  {
+    mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+  }
+  else
+  {
+    mapping = mremap(data, this->length, length, MREMAP_MAYMOVE);
+  }
+  if (mapping == MAP_FAILED)
+  {
+    // a file that was already grown is left longer than its mapping,
+    // which only adds unused room at its end
+    throw ListFileException(operation, path, "could not map list file");
+  }
+  data = static_cast<unsigned char*>(mapping);
+
+  if (length < this->length and ftruncate(descriptor, length) != 0)
+  {
+    // the mapping is already smaller, the file is just left longer
+    this->length = length;
+    throw ListFileException(operation, path, "could not shrink list file");
+  }
+  this->length = length;
+}
+
+/**
+ * @brief Sync file
+ *
+ * Wait for the changed pages of a writable file to be written to the
+ * file, so that they survive a crash of the machine.
+ *
+ * @param operation The name of the list operation syncing the file,
+ *   this must be a string literal.
+ *
+ * @throws ListFileException If the pages can not be written.
+ */
+void MappedFile::sync(const char* operation)
+{
+  if (data != nullptr and msync(data, length, MS_SYNC) != 0)
+  {
+    throw ListFileException(operation, path, "could not write list file");
+  }
+}
+
+/**
+ * @brief Close file
+ *
+ * Unmap and close a writable file, cutting it to the given length.
+ * This never throws, so that a list can close its file while being
+ * destroyed or moved.
+ *
+ * @param length The length to leave the file at, at most its current
+ *   length.
+ *
+ * @returns bool Returns true if the file was cut and closed, false if
+ *   that failed and the file may be left longer.
+ */
+bool MappedFile::close(uint64_t length)
+{
+  unmap();
+  bool closed = ftruncate(descriptor, length) == 0;
+  closed = ::close(descriptor) == 0 and closed;
+  descriptor = -1;
+  this->length = 0;
+
+  return closed;
+}
+
+/**
+ * @brief Unmap file
+ *
+ * Private member method to give back the mapping of the file, if it is
+ * mapped.
+ */
+void MappedFile::unmap()
+{
+  if (data != nullptr)
+  {
+    munmap(data, length);
+    data = nullptr;
+  }
+}
@@ -0,0 +1,38 @@
+/** @file NodePool.cpp
+ * @brief Slab based pool allocator for the nodes of linked lists.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * The members are defined in NodePool.ipp, which the header includes,
+ * so this file only compiles the instances of the template in common
+ * use.
+ */
+#include "NodePool.hpp"
+#include "DNode.hpp"
+#include "Node.hpp"
+#include "SkipEntry.hpp"
+#include "UNode.hpp"
+#include <string>
+using namespace std;
+
+/**
+ * @brief Compile the common instances
+ *
+ * The definitions are included by the header, so that the template can
+ * be instantiated for any type where it is used.  We still explicitly
+ * instantiate it here for the types the tests and main program use,
+ * so that every member is compiled and checked, and not only those
+ * members that happen to be called.
+ */
+template class NodePool<Node<int>>;
+template class NodePool<Node<string>>;
+template class NodePool<DNode<int>>;
+template class NodePool<DNode<string>>;
+template class NodePool<UNode<int>>;
+template class NodePool<UNode<string>>;
+template class NodePool<SkipEntry<int>>;
+template class NodePool<SkipEntry<string>>;
@@ -0,0 +1,28 @@
+/** @file SkipIndex.cpp
+ * @brief Skip list positional index over the nodes of an LList.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * The members are defined in SkipIndex.ipp, which the header includes,
+ * so this file only compiles the instances of the template in common
+ * use.
+ */
+#include "SkipIndex.hpp"
+#include <string>
+using namespace std;
+
+/**
+ * @brief Compile the common instances
+ *
+ * The definitions are included by the header, so that the template can
+ * be instantiated for any type where it is used.  We still explicitly
+ * instantiate it here for the types the tests and main program use,
+ * so that every member is compiled and checked, and not only those
+ * members that happen to be called.
+ */
+template class SkipIndex<int>;
+template class SkipIndex<string>;
@@ -0,0 +1,32 @@
+/** @file StaticList.cpp
+ * @brief Statically dispatched facade over concrete List types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * The members of the StaticList are all defined inline in the header,
+ * so that the forwarding calls disappear when compiled.  Here we only
+ * make sure that the facades over the lists we use compile.
+ */
+#include "AList.hpp"
+#include "LList.hpp"
+#include "StaticList.hpp"
+#include <string>
+using namespace std;
+
+/**
+ * @brief Compile the common instances
+ *
+ * The definitions are included by the header, so that the template can
+ * be instantiated for any type where it is used.  We still explicitly
+ * instantiate it here for the types the tests and main program use,
+ * so that every member is compiled and checked, and not only those
+ * members that happen to be called.
+ */
+template class StaticList<AList<int>>;
+template class StaticList<AList<string>>;
+template class StaticList<LList<int>>;
+template class StaticList<LList<string>>;
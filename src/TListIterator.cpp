@@ -0,0 +1,30 @@
+/** @file TListIterator.cpp
+ * @brief Concrete Iterator for TList<T> list types.
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * The members are defined in TListIterator.ipp, which the header
+ * includes, so this file only compiles the instances of the template
+ * in common use.
+ */
+#include "TListIterator.hpp"
+#include <string>
+using namespace std;
+
+/**
+ * @brief Compile the common instances
+ *
+ * The definitions are included by the header, so that the template can
+ * be instantiated for any type where it is used.  We still explicitly
+ * instantiate it here for the types the tests and main program use,
+ * so that every member is compiled and checked, and not only those
+ * members that happen to be called.
+ */
+template class TListIterator<int>;
+template class TListIterator<const int>;
+template class TListIterator<string>;
+template class TListIterator<const string>;
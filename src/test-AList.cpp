@@ -17,12 +17,53 @@
  * assertions.
  */
 #include "AList.hpp"
+#include "DLList.hpp"
+#include "LList.hpp"
 #include "ListException.hpp"
-#include "ListIterator.hpp"
+#include "StaticList.hpp"
 #include "catch.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <type_traits>
+#include <vector>
 using namespace std;
 
+/** @brief A plain record type, used to test lists of values other than
+ *   the int and string lists that are compiled with the list classes.
+ */
+struct Point
+{
+  int x;
+  int y;
+};
+
+/** @brief Point equality, needed by list equality */
+bool operator==(const Point& lhs, const Point& rhs)
+{
+  return lhs.x == rhs.x and lhs.y == rhs.y;
+}
+
+/** @brief Point ordering, needed by list ordering */
+bool operator<(const Point& lhs, const Point& rhs)
+{
+  return lhs.x < rhs.x or (lhs.x == rhs.x and lhs.y < rhs.y);
+}
+
+/** @brief Point output, needed by the list str() method */
+ostream& operator<<(ostream& out, const Point& point)
+{
+  out << "(" << point.x << "," << point.y << ")";
+  return out;
+}
+
 /** Test AList<int> concrete array implementation of list of integers
  */
 TEST_CASE("AList<int> test integer list concrete array implementation", "[task0]")
@@ -314,7 +355,7 @@ TEST_CASE("AList<int> test integer list concrete array implementation", "[task0]
     }
 
     // iterate using C++ explicit iterator object
-    ListIterator<int> itr;
+    AList<int>::iterator itr;
     int index = 0;
     for (itr = list.begin(); itr != list.end(); ++itr)
     {
@@ -332,12 +373,203 @@ TEST_CASE("AList<int> test integer list concrete array implementation", "[task0]
       index++;
     }
   }
+
+  SECTION("test shifting values in a grown list")
+  {
+    AList<int> list;
+
+    // insert on the front through several growths of the allocation
+    for (int value = 0; value < 50; value++)
+    {
+      list.insertFront(value);
+    }
+    CHECK(list.getSize() == 50);
+    CHECK(list.getAllocationSize() == 80); // only for AList<>
+    for (int index = 0; index < 50; index++)
+    {
+      CHECK(list[index] == 49 - index);
+    }
+
+    // copies of the grown list hold the same values
+    AList<int> copy = list;
+    CHECK(copy == list);
+
+    // delete from the front and the middle, shifting the values down
+    list.deleteFront();
+    list.deleteIndex(10);
+    list.deleteIndex(47);
+    CHECK(list.getSize() == 47);
+    CHECK(list.getFront() == 48);
+    CHECK(list[9] == 39);
+    CHECK(list[10] == 37);
+    CHECK(list.getBack() == 1);
+    CHECK_FALSE(copy == list);
+  }
+
+  SECTION("test insert value at index")
+  {
+    int values[] = {3, 1, 4, 2};
+    AList<int> list(4, values);
+
+    // insert in the middle, at the front and at the back
+    list.insertAt(2, 9);
+    CHECK(list.str() == "<list> size: 5 [ 3, 1, 9, 4, 2 ]");
+    list.insertAt(0, 8);
+    CHECK(list.str() == "<list> size: 6 [ 8, 3, 1, 9, 4, 2 ]");
+    list.insertAt(6, 7);
+    CHECK(list.str() == "<list> size: 7 [ 8, 3, 1, 9, 4, 2, 7 ]");
+    list.insertAt(5, 6);
+    CHECK(list.str() == "<list> size: 8 [ 8, 3, 1, 9, 4, 6, 2, 7 ]");
+    CHECK(list.getAllocationSize() == 8);
+    CHECK(list.getFront() == 8);
+    CHECK(list.getBack() == 7);
+
+    // the index can be at most 1 past the back of the list
+    CHECK_THROWS_AS(list.insertAt(-1, 0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(list.insertAt(9, 0), ListMemoryBoundsException);
+    CHECK(list.getSize() == 8);
+
+    // inserting into an empty list
+    AList<int> empty;
+    empty.insertAt(0, 5);
+    CHECK(empty.str() == "<list> size: 1 [ 5 ]");
+    CHECK(empty.getFront() == 5);
+    CHECK(empty.getBack() == 5);
+  }
+
+  SECTION("test growth policies, reserve and shrink to fit")
+  {
+    // one and a half growth
+    AList<int> half(GrowthPolicy::oneAndHalf());
+    for (int value = 0; value < 11; value++)
+    {
+      half.insertBack(value);
+    }
+    CHECK(half.getAllocationSize() == 16); // only for AList<>
+    for (int value = 11; value < 17; value++)
+    {
+      half.insertBack(value);
+    }
+    CHECK(half.getAllocationSize() == 25); // only for AList<>
+
+    // fixed chunk growth
+    AList<int> chunked(GrowthPolicy::fixedChunk(4));
+    for (int value = 0; value < 9; value++)
+    {
+      chunked.insertFront(value);
+    }
+    CHECK(chunked.getAllocationSize() == 12); // only for AList<>
+    CHECK(chunked.getFront() == 8);
+    CHECK(chunked.getBack() == 0);
+
+    // copies are exactly sized and keep the growth policy
+    AList<int> copy = chunked;
+    CHECK(copy.getAllocationSize() == 9); // only for AList<>
+    CHECK(copy.getGrowthPolicy().getGrowthType() == GrowthPolicy::FIXED_CHUNK);
+    copy.insertBack(9);
+    CHECK(copy.getAllocationSize() == 13); // only for AList<>
+
+    // settings that could never grow the allocation are raised to 1
+    GrowthPolicy zeroChunk = GrowthPolicy::fixedChunk(0);
+    CHECK(zeroChunk.getChunkSize() == 1);
+    CHECK(zeroChunk.getInitialAllocationSize() == 1);
+    CHECK(zeroChunk.grow(0, 3) == 3);
+    GrowthPolicy zeroInitial(GrowthPolicy::DOUBLING, 0, -5, false);
+    CHECK(zeroInitial.getInitialAllocationSize() == 1);
+    CHECK(zeroInitial.getChunkSize() == 1);
+    CHECK(zeroInitial.grow(0, 5) == 8);
+    AList<int> tiny(GrowthPolicy::fixedChunk(0));
+    tiny.insertBack(1);
+    tiny.insertBack(2);
+    CHECK(tiny.getAllocationSize() == 2); // only for AList<>
+
+    // growth is capped instead of overflowing for very large sizes
+    CHECK(GrowthPolicy::doubling().grow(1 << 30, (1 << 30) + 1) == INT_MAX);
+    CHECK(GrowthPolicy::oneAndHalf().grow(1 << 30, INT_MAX) == INT_MAX);
+    CHECK(GrowthPolicy::fixedChunk(1 << 30).grow(1 << 30, INT_MAX - 1) == INT_MAX);
+
+    // reserve grows the allocation once, but never reduces it
+    AList<int> list;
+    list.reserve(100);
+    CHECK(list.getAllocationSize() == 100); // only for AList<>
+    for (int value = 0; value < 100; value++)
+    {
+      list.insertBack(value);
+    }
+    CHECK(list.getAllocationSize() == 100); // only for AList<>
+    list.reserve(50);
+    CHECK(list.getAllocationSize() == 100); // only for AList<>
+
+    // shrink to fit gives back unused memory
+    for (int count = 0; count < 90; count++)
+    {
+      list.deleteBack();
+    }
+    CHECK(list.getAllocationSize() == 100); // only for AList<>
+    list.shrinkToFit();
+    CHECK(list.getAllocationSize() == 10); // only for AList<>
+    CHECK(list.str() == "<list> size: 10 [ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 ]");
+    list.clear();
+    list.shrinkToFit();
+    CHECK(list.getAllocationSize() == 0); // only for AList<>
+  }
+
+  SECTION("test auto shrink with hysteresis")
+  {
+    AList<int> list(GrowthPolicy::doubling().withAutoShrink(true));
+    for (int value = 0; value < 40; value++)
+    {
+      list.insertBack(value);
+    }
+    CHECK(list.getAllocationSize() == 40); // only for AList<>
+
+    // allocation is kept until the list is only a quarter full
+    while (list.getSize() > 11)
+    {
+      list.deleteFront();
+    }
+    CHECK(list.getAllocationSize() == 40); // only for AList<>
+    list.deleteBack();
+    CHECK(list.getSize() == 10);
+    CHECK(list.getAllocationSize() == 20); // only for AList<>
+
+    // growing again right after shrinking does not reallocate
+    list.insertBack(100);
+    list.deleteIndex(0);
+    CHECK(list.getAllocationSize() == 20); // only for AList<>
+
+    // never shrinks below the initial allocation size
+    while (list.getSize() > 1)
+    {
+      list.deleteBack();
+    }
+    CHECK(list.getAllocationSize() == 10); // only for AList<>
+    CHECK(list.getFront() == 30);
+  }
 }
 
 /** Test AList<string> concrete array implementation of list of strings
  */
 TEST_CASE("AList<string> test string list concrete array implementation", "[task0]")
 {
+  SECTION("test not found exception keeps a copy of the value")
+  {
+    AList<string> list;
+    list.insertBack("Alpha");
+    string missing = "a value long enough that it lives on the heap";
+    try
+    {
+      list.deleteValue(missing);
+      FAIL("deleteValue() of a missing value should throw");
+    }
+    catch (const ListValueNotFoundException& e)
+    {
+      missing.clear();
+      CHECK(e.hasValue());
+      CHECK(string(e.what()) == "Error: <AList::deleteValue> asked to delete value: a value long enough that it lives on the heap but this value was not currently in the list");
+    }
+  }
+
   SECTION("test empty list is empty")
   {
     AList<string> empty;
@@ -626,7 +858,7 @@ TEST_CASE("AList<string> test string list concrete array implementation", "[task
     }
 
     // iterate using C++ explicit iterator object
-    ListIterator<string> itr;
+    AList<string>::iterator itr;
     int index = 0;
     for (itr = list.begin(); itr != list.end(); ++itr)
     {
@@ -644,4 +876,655 @@ TEST_CASE("AList<string> test string list concrete array implementation", "[task
       index++;
     }
   }
+
+  SECTION("test move semantics and emplace")
+  {
+    string values[] = {"charlie", "alpha", "delta", "bravo"};
+    AList<string> list(4, values);
+
+    // moving a list takes over its values and leaves the original empty
+    AList<string> moved = move(list);
+    CHECK(moved.getSize() == 4);
+    CHECK(moved.getAllocationSize() == 4); // only for AList<>
+    CHECK(moved.str() == "<list> size: 4 [ charlie, alpha, delta, bravo ]");
+    CHECK(list.getSize() == 0);
+    CHECK(list.getAllocationSize() == 0); // only for AList<>
+    CHECK(list.isEmpty());
+
+    // move assignment replaces the values of the target list
+    list = move(moved);
+    CHECK(list.str() == "<list> size: 4 [ charlie, alpha, delta, bravo ]");
+    CHECK(moved.isEmpty());
+
+    // copy assignment gives an independent copy
+    moved = list;
+    CHECK(moved == list);
+    moved[0] = "echo";
+    CHECK_FALSE(moved == list);
+
+    // inserting an rvalue moves the value into the list
+    string value = "foxtrot";
+    list.insertBack(move(value));
+    CHECK(list.getBack() == "foxtrot");
+    value = "golf";
+    list.insertFront(move(value));
+    CHECK(list.getFront() == "golf");
+    CHECK(list.str() == "<list> size: 6 [ golf, charlie, alpha, delta, bravo, foxtrot ]");
+
+    // emplace constructs the value from constructor arguments
+    string& back = list.emplaceBack(3, 'x');
+    CHECK(back == "xxx");
+    string& front = list.emplaceFront("hotel");
+    CHECK(front == "hotel");
+    CHECK(list.getSize() == 8);
+    CHECK(list.str() == "<list> size: 8 [ hotel, golf, charlie, alpha, delta, bravo, foxtrot, xxx ]");
+
+    // emplacing a copy of a value already in the list is safe when the
+    // list has to grow
+    AList<string> small;
+    small.insertBack("india");
+    for (int count = 0; count < 20; count++)
+    {
+      small.emplaceBack(small[0]);
+    }
+    CHECK(small.getSize() == 21);
+    CHECK(small.getBack() == "india");
+  }
+
+  SECTION("test growth relocates only live values")
+  {
+    AList<string> list;
+
+    // grow through several doublings, each value must survive relocation
+    for (int index = 0; index < 100; index++)
+    {
+      list.insertBack("value-" + to_string(index));
+    }
+    CHECK(list.getSize() == 100);
+    CHECK(list.getAllocationSize() == 160); // only for AList<>
+    for (int index = 0; index < 100; index++)
+    {
+      CHECK(list[index] == "value-" + to_string(index));
+    }
+
+    // deleted slots are destroyed and can be constructed into again
+    list.deleteBack();
+    list.deleteFront();
+    list.deleteIndex(50);
+    CHECK(list.getSize() == 97);
+    list.insertBack("back");
+    list.insertFront("front");
+    CHECK(list.getSize() == 99);
+    CHECK(list.getFront() == "front");
+    CHECK(list[1] == "value-1");
+    CHECK(list[51] == "value-52");
+    CHECK(list[97] == "value-98");
+    CHECK(list.getBack() == "back");
+    CHECK(list.getAllocationSize() == 160); // only for AList<>
+  }
+
+  SECTION("test small lists stored in the inline buffer")
+  {
+    // an empty list already has its inline buffer to use
+    AList<string, 16> list;
+    CHECK(list.isEmpty());
+    CHECK(list.getAllocationSize() == 16);
+
+    // values stay inline until the buffer is full
+    for (int index = 0; index < 16; index++)
+    {
+      list.insertBack("value-" + to_string(index));
+    }
+    CHECK(list.getSize() == 16);
+    CHECK(list.getAllocationSize() == 16);
+    CHECK(list.getFront() == "value-0");
+    CHECK(list.getBack() == "value-15");
+
+    // one more value spills the list over onto the heap
+    list.insertFront("front");
+    CHECK(list.getSize() == 17);
+    CHECK(list.getAllocationSize() == 32);
+    CHECK(list.getFront() == "front");
+    CHECK(list[16] == "value-15");
+
+    // shrinking to fit moves the values back into the inline buffer
+    list.deleteFront();
+    list.deleteBack();
+    list.shrinkToFit();
+    CHECK(list.getSize() == 15);
+    CHECK(list.getAllocationSize() == 16);
+    CHECK(list.getFront() == "value-0");
+    CHECK(list.getBack() == "value-14");
+
+    // copies of small lists are also kept inline
+    AList<string, 16> copy = list;
+    CHECK(copy.getAllocationSize() == 16);
+    CHECK(copy == list);
+
+    // moving a list in its inline buffer moves the values themselves
+    AList<string, 16> moved = move(copy);
+    CHECK(moved.getSize() == 15);
+    CHECK(moved.getAllocationSize() == 16);
+    CHECK(moved == list);
+    CHECK(copy.isEmpty());
+    CHECK(copy.getAllocationSize() == 16);
+
+    // moving a list on the heap takes over its block of memory
+    AList<string, 16> big;
+    for (int index = 0; index < 20; index++)
+    {
+      big.insertBack("value-" + to_string(index));
+    }
+    moved = move(big);
+    CHECK(moved.getSize() == 20);
+    CHECK(moved.getAllocationSize() == 32);
+    CHECK(moved.getBack() == "value-19");
+    CHECK(big.isEmpty());
+    CHECK(big.getAllocationSize() == 16);
+
+    // clearing gives back the heap block but keeps the inline buffer
+    moved.clear();
+    CHECK(moved.getAllocationSize() == 16);
+    moved.insertBack("alpha");
+    CHECK(moved.str() == "<list> size: 1 [ alpha ]");
+
+    // trivially copyable values work in the inline buffer as well
+    int values[] = {3, 1, 4, 1, 5};
+    AList<int, 16> ints(5, values);
+    CHECK(ints.getAllocationSize() == 16);
+    AList<int, 16> otherInts = move(ints);
+    CHECK(otherInts.str() == "<list> size: 5 [ 3, 1, 4, 1, 5 ]");
+    CHECK(ints.isEmpty());
+  }
+
+  SECTION("test removing values in bulk")
+  {
+    int values[] = {1, 2, 3, 2, 4, 2, 5, 6, 2};
+    AList<int> list(9, values);
+
+    // remove matching values, the rest keep their order
+    CHECK(list.removeIf([](const int& value) { return value == 2; }) == 4);
+    CHECK(list.getSize() == 5);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, 4, 5, 6 ]");
+
+    // nothing to remove is not an error
+    CHECK(list.removeIf([](const int& value) { return value > 100; }) == 0);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, 4, 5, 6 ]");
+
+    // removing the front and back keeps the list consistent
+    CHECK(list.removeAll(vector<int>{1, 6, 42}) == 2);
+    CHECK(list.str() == "<list> size: 3 [ 3, 4, 5 ]");
+    CHECK(list.getFront() == 3);
+    CHECK(list.getBack() == 5);
+    list.insertBack(7);
+    list.insertFront(0);
+    CHECK(list.str() == "<list> size: 5 [ 0, 3, 4, 5, 7 ]");
+
+    // remove everything from the list
+    int odd[] = {3, 5, 7};
+    CHECK(list.removeAll(odd) == 3);
+    CHECK(list.removeIf([](const int& value) { return value % 2 == 0; }) == 2);
+    CHECK(list.isEmpty());
+    CHECK(list.str() == "<list> size: 0 [ ]");
+    list.insertBack(8);
+    CHECK(list.getFront() == 8);
+    CHECK(list.getBack() == 8);
+
+    // a large purge is done in a single pass
+    AList<string> words;
+    for (int index = 0; index < 10000; index++)
+    {
+      words.insertBack(index % 3 == 0 ? "purge" : to_string(index));
+    }
+    words.deleteValue("purge");
+    CHECK(words.getSize() == 6666);
+    CHECK(words.getFront() == "1");
+    CHECK(words.getBack() == "9998");
+    CHECK(words.removeAll(vector<string>{"purge"}) == 0);
+    CHECK_THROWS_AS(words.deleteValue("purge"), ListValueNotFoundException);
+  }
+
+  SECTION("test equality and ordering of lists")
+  {
+    int values[] = {1, 2, 3, 4, 5};
+    AList<int> list(5, values);
+    AList<int> same(5, values);
+    AList<int> prefix(3, values);
+    int biggerValues[] = {1, 2, 4};
+    AList<int> bigger(3, biggerValues);
+
+    // array lists compare their blocks of values directly
+    CHECK(list == same);
+    CHECK(list.compare(same) == 0);
+    CHECK_FALSE(list < same);
+    CHECK_FALSE(list == prefix);
+    CHECK(prefix < list);
+    CHECK(list.compare(prefix) > 0);
+    CHECK(list < bigger);
+    CHECK(bigger.compare(list) > 0);
+    same[4] = -5;
+    CHECK_FALSE(list == same);
+    CHECK(same < list);
+    AList<int> empty;
+    CHECK(empty < list);
+    CHECK(empty.compare(AList<int>()) == 0);
+
+    // comparisons with other list types give the same answers
+    LList<int> linked(5, values);
+    DLList<int> doubly(5, values);
+    CHECK(list == linked);
+    CHECK(list == doubly);
+    CHECK(list.compare(linked) == 0);
+    CHECK(list.compare(doubly) == 0);
+    CHECK(prefix < linked);
+    CHECK(prefix < doubly);
+    CHECK(doubly.compare(prefix) > 0);
+    CHECK(bigger.compare(doubly) > 0);
+    CHECK(doubly < bigger);
+    doubly.deleteBack();
+    CHECK_FALSE(list == doubly);
+    CHECK(doubly < list);
+
+    // lists of strings are ordered like strings are
+    string words[] = {"alpha", "bravo", "charlie"};
+    AList<string> wordList(3, words);
+    AList<string> wordCopy(3, words);
+    CHECK(wordList == wordCopy);
+    wordCopy[2] = "chaplin";
+    CHECK(wordCopy < wordList);
+    DLList<string> wordDoubly(3, words);
+    CHECK(wordList == wordDoubly);
+    CHECK(wordCopy < wordDoubly);
+  }
+
+  SECTION("test standard iterators and algorithms")
+  {
+    string words[] = {"delta", "alpha", "charlie", "bravo"};
+    AList<string> list(4, words);
+
+    // the iterators are standard random access iterators
+    using Iterator = AList<string>::iterator;
+    CHECK(is_same<iterator_traits<Iterator>::iterator_category, random_access_iterator_tag>::value);
+    CHECK(is_same<iterator_traits<Iterator>::value_type, string>::value);
+    CHECK(is_same<iterator_traits<Iterator>::reference, string&>::value);
+    CHECK(is_same<iterator_traits<AList<string>::const_iterator>::reference, const string&>::value);
+    CHECK(list.end() - list.begin() == 4);
+
+    // values are accessed by reference, so they can be changed in place
+    for (string& word : list)
+    {
+      word[0] = toupper(word[0]);
+    }
+    CHECK(list.str() == "<list> size: 4 [ Delta, Alpha, Charlie, Bravo ]");
+    Iterator itr = list.begin();
+    CHECK(itr->size() == 5);
+    CHECK(itr[2] == "Charlie");
+    itr += 3;
+    CHECK(*itr == "Bravo");
+    CHECK(*(itr - 1) == "Charlie");
+    CHECK(itr > list.begin());
+
+    // algorithms work directly on the list
+    sort(list.begin(), list.end());
+    CHECK(list.str() == "<list> size: 4 [ Alpha, Bravo, Charlie, Delta ]");
+    CHECK(binary_search(list.begin(), list.end(), "Charlie"));
+    reverse(list.begin(), list.end());
+    CHECK(list.getFront() == "Delta");
+
+    // a const list hands out const iterators
+    const AList<string>& constList = list;
+    AList<string>::const_iterator constItr = constList.begin();
+    CHECK(*constItr == "Delta");
+    CHECK(constItr == list.begin());
+    CHECK(find(constList.begin(), constList.end(), "Bravo") - constList.cbegin() == 2);
+
+    int values[] = {3, 1, 4, 1, 5};
+    AList<int> numbers(5, values);
+    CHECK(accumulate(numbers.cbegin(), numbers.cend(), 0) == 14);
+    CHECK(count(numbers.begin(), numbers.end(), 1) == 2);
+    CHECK(*max_element(numbers.begin(), numbers.end()) == 5);
+  }
+
+  SECTION("test exceptions describe the failed operation")
+  {
+    AList<int> list;
+    try
+    {
+      list.getFront();
+      FAIL("getFront() of an empty list should throw");
+    }
+    catch (const ListEmptyException& e)
+    {
+      CHECK(string(e.getOperation()) == "AList::getFront");
+      CHECK(e.getSize() == 0);
+      CHECK(string(e.what()) == "Error: <AList::getFront> attempt to access item from empty list, size:  0");
+    }
+
+    list.insertBack(7);
+    list.insertBack(8);
+    try
+    {
+      list[5];
+      FAIL("operator[] beyond the list should throw");
+    }
+    catch (const ListMemoryBoundsException& e)
+    {
+      CHECK(e.getSize() == 2);
+      CHECK(e.getIndex() == 5);
+      CHECK(string(e.what()) == "Error: <AList::operator[]> illegal bounds access, list size: 2 tried to access index address: 5");
+    }
+
+    try
+    {
+      list.deleteValue(42);
+      FAIL("deleteValue() of a missing value should throw");
+    }
+    catch (const ListValueNotFoundException& e)
+    {
+      // copies keep their own copy of the value that was not found
+      ListValueNotFoundException copy(e);
+      CHECK(copy.hasValue());
+      CHECK(string(copy.what()) == "Error: <AList::deleteValue> asked to delete value: 42 but this value was not currently in the list");
+      CHECK(string(copy.what()) == e.what());
+    }
+
+    // the exceptions can still be given a message of their own
+    ListEmptyException given("Error: given message");
+    CHECK(string(given.what()) == "Error: given message");
+  }
+
+  SECTION("test unchecked and non-throwing access")
+  {
+    AList<int> list;
+    int value = -1;
+    CHECK_FALSE(list.tryGetFront(value));
+    CHECK_FALSE(list.tryGetBack(value));
+    CHECK_FALSE(list.tryDeleteIndex(0));
+    CHECK(value == -1);
+
+    for (int index = 0; index < 5; index++)
+    {
+      list.insertBack(index * 10);
+    }
+    CHECK(list.tryGetFront(value));
+    CHECK(value == 0);
+    CHECK(list.tryGetBack(value));
+    CHECK(value == 40);
+    list.unchecked(2) = 25;
+    CHECK(list.unchecked(2) == 25);
+    CHECK(list[2] == 25);
+
+    // illegal indexes leave the list unchanged instead of throwing
+    CHECK_FALSE(list.tryDeleteIndex(-1));
+    CHECK_FALSE(list.tryDeleteIndex(5));
+    CHECK(list.tryDeleteIndex(1));
+    CHECK(list.str() == "<list> size: 4 [ 0, 25, 30, 40 ]");
+
+    // a list with the unchecked policy behaves the same for legal accesses
+    AList<int, 0, UncheckedBounds> fast;
+    fast.insertBack(1);
+    fast.insertBack(3);
+    fast.insertAt(1, 2);
+    CHECK(fast[0] == 1);
+    CHECK(fast.getFront() == 1);
+    CHECK(fast.getBack() == 3);
+    fast.deleteIndex(1);
+    fast.deleteFront();
+    CHECK(fast.str() == "<list> size: 1 [ 3 ]");
+    fast.deleteBack();
+    CHECK(fast.isEmpty());
+    CHECK_FALSE(fast.tryGetFront(value));
+  }
+
+  SECTION("test statically dispatched facade")
+  {
+    AList<int> list;
+    StaticList<AList<int>> facade = staticList(list);
+    facade.insertBack(2).insertBack(3).insertFront(1).insertAt(3, 4);
+    CHECK(facade.getSize() == 4);
+    CHECK_FALSE(facade.isEmpty());
+    CHECK(facade.str() == "<list> size: 4 [ 1, 2, 3, 4 ]");
+    CHECK(facade.getFront() == 1);
+    CHECK(facade.getBack() == 4);
+    facade[1] = 20;
+    CHECK(list[1] == 20);
+    CHECK(accumulate(facade.begin(), facade.end(), 0) == 28);
+
+    // the facade changes the wrapped list itself
+    facade.deleteFront();
+    facade.deleteBack();
+    facade.deleteIndex(0);
+    CHECK(list.str() == "<list> size: 1 [ 3 ]");
+    facade.deleteValue(3);
+    CHECK(list.isEmpty());
+    CHECK(&facade.getList() == &list);
+    CHECK_THROWS_AS(facade.deleteBack(), ListEmptyException);
+  }
+}
+
+/** Test AList<T> instantiated for types other than int and string,
+ * which are only compiled where they are used
+ */
+TEST_CASE("AList<T> test lists of other value types", "[task0]")
+{
+  SECTION("test list of doubles")
+  {
+    AList<double> list;
+    list.insertBack(2.5);
+    list.insertFront(1.25);
+    list.insertAt(1, 3.0);
+    CHECK(list.getSize() == 3);
+    CHECK(list.str() == "<list> size: 3 [ 1.25, 3, 2.5 ]");
+    CHECK(accumulate(list.begin(), list.end(), 0.0) == 6.75);
+    list.deleteValue(3.0);
+    CHECK(list.str() == "<list> size: 2 [ 1.25, 2.5 ]");
+  }
+
+  SECTION("test list of 64 bit integers")
+  {
+    AList<int64_t> list;
+    for (int64_t value = 1; value <= 100; value++)
+    {
+      list.insertBack(value * 10000000000LL);
+    }
+    CHECK(list.getSize() == 100);
+    CHECK(list[99] == 1000000000000LL);
+    CHECK(accumulate(list.begin(), list.end(), int64_t(0)) == 50500000000000LL);
+  }
+
+  SECTION("test integer strings match stream output")
+  {
+    // mixed lengths and signs, including the extremes of each type
+    AList<int> ints;
+    ints.insertBack(0);
+    ints.insertBack(-7);
+    ints.insertBack(numeric_limits<int>::min());
+    ints.insertBack(numeric_limits<int>::max());
+    ints.insertBack(12345);
+    ostringstream intOut;
+    intOut << "<list> size: 5 [ 0, -7, " << numeric_limits<int>::min() << ", " << numeric_limits<int>::max() << ", 12345 ]";
+    CHECK(ints.str() == intOut.str());
+    ostringstream intStream;
+    intStream << ints;
+    CHECK(ints.str() == intStream.str());
+
+    AList<int64_t> longs;
+    longs.insertBack(numeric_limits<int64_t>::min());
+    longs.insertBack(3);
+    ostringstream longStream;
+    longStream << longs;
+    CHECK(longs.str() == longStream.str());
+
+    AList<unsigned int> unsignedInts;
+    unsignedInts.insertBack(numeric_limits<unsigned int>::max());
+    ostringstream unsignedStream;
+    unsignedStream << unsignedInts;
+    CHECK(unsignedInts.str() == unsignedStream.str());
+
+    // characters are not numbers, they keep the stream formatting
+    AList<char> chars;
+    chars.insertBack('a');
+    chars.insertBack('b');
+    CHECK(chars.str() == "<list> size: 2 [ a, b ]");
+    CHECK(AList<short>().str() == "<list> size: 0 [ ]");
+  }
+
+  SECTION("test list of plain records")
+  {
+    AList<Point> list;
+    list.insertBack({3, 4});
+    list.insertBack({1, 2});
+    list.insertFront({5, 6});
+    CHECK(list.str() == "<list> size: 3 [ (5,6), (3,4), (1,2) ]");
+    sort(list.begin(), list.end());
+    CHECK(list.getFront() == Point{1, 2});
+    CHECK(list.getBack() == Point{5, 6});
+
+    // lists of records of different kinds compare by their values
+    LList<Point> other;
+    other.insertBack({1, 2});
+    other.insertBack({3, 4});
+    other.insertBack({5, 6});
+    CHECK(list == other);
+    other.deleteBack();
+    CHECK(other < list);
+    CHECK_THROWS_AS(list[3], ListMemoryBoundsException);
+  }
+
+  SECTION("test saving and loading binary files")
+  {
+    const string path = "test-AList-binary.lst";
+
+    AList<int> ints;
+    for (int value = -500; value < 500; value++)
+    {
+      ints.insertBack(value * 7);
+    }
+    ints.saveBinary(path);
+    AList<int> loadedInts;
+    loadedInts.insertBack(42);
+    loadedInts.loadBinary(path);
+    CHECK(loadedInts == ints);
+    CHECK(loadedInts.getAllocationSize() == 1000);
+
+    // the file of an array list can be loaded by a linked list, and a
+    // list small enough for the inline buffer never allocates
+    LList<int> linkedInts;
+    linkedInts.loadBinary(path);
+    CHECK(linkedInts == ints);
+    AList<int>().saveBinary(path);
+    AList<int, 16> inlineInts;
+    inlineInts.loadBinary(path);
+    CHECK(inlineInts.isEmpty());
+    CHECK(inlineInts.getAllocationSize() == 16);
+
+    AList<string> strings;
+    strings.insertBack("Alpha");
+    strings.insertBack("");
+    strings.insertBack(string(100, 'x'));
+    strings.insertBack("Delta");
+    strings.saveBinary(path);
+    AList<string> loadedStrings;
+    loadedStrings.loadBinary(path);
+    CHECK(loadedStrings == strings);
+    CHECK(loadedStrings.getAllocationSize() == 4);
+
+    AList<Point> points;
+    points.insertBack({1, 2});
+    points.insertBack({-3, 4});
+    points.saveBinary(path);
+    AList<Point> loadedPoints;
+    loadedPoints.loadBinary(path);
+    CHECK(loadedPoints == points);
+
+    // a file holding another type of value, or not holding a whole
+    // list, is refused before the list is changed
+    CHECK_THROWS_AS(loadedInts.loadBinary(path), ListFileException);
+    CHECK(loadedInts.getSize() == 1000);
+    ints.saveBinary(path);
+    {
+      ofstream truncated(path, ios::binary | ios::app);
+      truncated << "x";
+    }
+    CHECK_THROWS_AS(loadedInts.loadBinary(path), ListFileException);
+    CHECK_THROWS_AS(loadedStrings.loadBinary(path), ListFileException);
+    CHECK(loadedStrings.getSize() == 4);
+    CHECK_THROWS_AS(loadedInts.loadBinary("no-such-directory/list.lst"), ListFileException);
+
+    remove(path.c_str());
+  }
+
+  SECTION("test lists mapped from files")
+  {
+    const string path = "test-AList-mapped.lst";
+    remove(path.c_str());
+
+    // a new file starts out as an empty list, which grows the file
+    {
+      AList<int64_t> list;
+      list.insertBack(-1);
+      list.mapFile(path);
+      CHECK(list.isMapped());
+      CHECK(list.isEmpty());
+      for (int64_t value = 0; value < 10000; value++)
+      {
+        list.insertBack(value * value);
+      }
+      list.insertFront(-5);
+      list.deleteFront();
+      CHECK(list.getSize() == 10000);
+      CHECK(list[9999] == 99980001);
+      CHECK(list.getAllocationSize() >= 10000);
+      list.syncFile();
+    }
+
+    // the values are still in the file, which can also be loaded
+    AList<int64_t> list;
+    list.mapFile(path);
+    CHECK(list.getSize() == 10000);
+    CHECK(list[100] == 10000);
+    list[100] = 7;
+    list.unmapFile();
+    CHECK_FALSE(list.isMapped());
+    CHECK(list.isEmpty());
+    LList<int64_t> loaded;
+    loaded.loadBinary(path);
+    CHECK(loaded.getSize() == 10000);
+    CHECK(loaded[100] == 7);
+
+    // a read only list can be changed, but the file never is
+    AList<int64_t> readOnly;
+    readOnly.mapFile(path, true);
+    CHECK(readOnly.isMapped());
+    CHECK(readOnly.getAllocationSize() == 10000);
+    CHECK(readOnly == loaded);
+    readOnly[100] = 8;
+    readOnly.insertBack(42);
+    CHECK_FALSE(readOnly.isMapped());
+    CHECK(readOnly.getSize() == 10001);
+    CHECK(readOnly[100] == 8);
+    AList<int64_t> other;
+    other.mapFile(path, true);
+    CHECK(other[100] == 7);
+    CHECK(other.getSize() == 10000);
+
+    // clearing a writable list empties its file
+    list.mapFile(path);
+    list.clear();
+    CHECK(list.isMapped());
+    list.insertBack(3);
+    list = AList<int64_t>();
+    CHECK_FALSE(list.isMapped());
+    loaded.loadBinary(path);
+    CHECK(loaded.str() == "<list> size: 1 [ 3 ]");
+
+    // only lists of values of the same type map, a list of strings does
+    // not even compile a call to mapFile()
+    AList<int> ints;
+    CHECK_THROWS_AS(ints.mapFile(path), ListFileException);
+    CHECK_THROWS_AS(ints.mapFile("no-such-directory/list.lst", true), ListFileException);
+    CHECK_FALSE(ints.isMapped());
+
+    remove(path.c_str());
+  }
 }
@@ -0,0 +1,264 @@
+/** @file test-DLList.cpp
+ * @brief Unit tests for the DLList doubly linked List implementation
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * This file contains test cases and individual unit tests for the
+ * DLList doubly linked list implementation of the List abstraction.
+ * This file uses the catch2 unit test framework to define the test
+ * cases and test assertions.
+ */
+#include "DLList.hpp"
+#include "AList.hpp"
+#include "ListException.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+/** Test DLList<int> concrete doubly linked implementation of list of integers
+ */
+TEST_CASE("DLList<int> test integer list concrete doubly linked implementation", "[dllist]")
+{
+  SECTION("test empty list is empty")
+  {
+    DLList<int> empty;
+
+    // empty lists should be empty
+    CHECK(empty.getSize() == 0);
+    CHECK(empty.isEmpty());
+    CHECK(empty.str() == "<list> size: 0 [ ]");
+
+    // empty lists should compare as being equal
+    DLList<int> otherEmpty;
+    CHECK(otherEmpty == empty);
+    CHECK(empty == otherEmpty);
+
+    // empty lists should complain if asked to get or delete a value
+    CHECK_THROWS_AS(empty.getFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.getBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty[0], ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteIndex(0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteValue(5), ListValueNotFoundException);
+  }
+
+  SECTION("test array based constructor and insertion at both ends")
+  {
+    int values[] = {1, 3, -2, -4, 7};
+    DLList<int> list(5, values);
+
+    CHECK(list.getSize() == 5);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, -2, -4, 7 ]");
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 7);
+    CHECK_THROWS_AS(list[-1], ListMemoryBoundsException);
+    CHECK_THROWS_AS(list[5], ListMemoryBoundsException);
+
+    list.insertBack(22);
+    list << -22;
+    list.insertFront(-38);
+    list >> 38;
+    CHECK(list.getSize() == 9);
+    CHECK(list.getFront() == -38);
+    CHECK(list.getBack() == 38);
+    CHECK(list.str() == "<list> size: 9 [ -38, -22, 1, 3, -2, -4, 7, 22, 38 ]");
+
+    // indexing walks from either end of the list
+    CHECK(list[0] == -38);
+    CHECK(list[3] == 3);
+    CHECK(list[4] == -2);
+    CHECK(list[6] == 7);
+    CHECK(list[8] == 38);
+    list[7] = 99;
+    CHECK(list[7] == 99);
+
+    // equal to other list types with the same values
+    int otherValues[] = {-38, -22, 1, 3, -2, -4, 7, 99, 38};
+    AList<int> other(9, otherValues);
+    CHECK(list == other);
+    other[4] = 42;
+    CHECK_FALSE(list == other);
+  }
+
+  SECTION("test copy and move of lists")
+  {
+    int values[] = {1, 2, 3, 4};
+    DLList<int> list(4, values);
+
+    DLList<int> copy = list;
+    CHECK(copy == list);
+    copy.deleteBack();
+    CHECK(copy.str() == "<list> size: 3 [ 1, 2, 3 ]");
+    CHECK(list.str() == "<list> size: 4 [ 1, 2, 3, 4 ]");
+
+    DLList<int> moved = move(list);
+    CHECK(moved.str() == "<list> size: 4 [ 1, 2, 3, 4 ]");
+    CHECK(list.isEmpty());
+    list.insertBack(5);
+    CHECK(list.getFront() == 5);
+    CHECK(list.getBack() == 5);
+
+    moved = copy;
+    CHECK(moved == copy);
+    copy = move(moved);
+    CHECK(copy.str() == "<list> size: 3 [ 1, 2, 3 ]");
+    CHECK(moved.isEmpty());
+  }
+
+  SECTION("test deleting values from both ends and the middle")
+  {
+    int values[] = {1, 5, 2, 5, 3, 5, 4, 5};
+    DLList<int> list(8, values);
+
+    // deleting all values links the remaining nodes back up, including
+    // when the back value is deleted
+    list.deleteValue(5);
+    CHECK(list.str() == "<list> size: 4 [ 1, 2, 3, 4 ]");
+    CHECK(list.getBack() == 4);
+    CHECK_THROWS_AS(list.deleteValue(5), ListValueNotFoundException);
+
+    list.deleteIndex(2);
+    CHECK(list.str() == "<list> size: 3 [ 1, 2, 4 ]");
+    list.deleteIndex(0);
+    list.deleteIndex(1);
+    CHECK(list.str() == "<list> size: 1 [ 2 ]");
+    CHECK_THROWS_AS(list.deleteIndex(1), ListMemoryBoundsException);
+
+    // draining from the back never has to search for the new back
+    for (int value = 0; value < 1000; value++)
+    {
+      list.insertBack(value);
+    }
+    for (int value = 999; value >= 0; value--)
+    {
+      CHECK(list.getBack() == value);
+      list.deleteBack();
+    }
+    CHECK(list.str() == "<list> size: 1 [ 2 ]");
+    list.deleteBack();
+    CHECK(list.isEmpty());
+    CHECK_THROWS_AS(list.getFront(), ListEmptyException);
+    list.insertFront(8);
+    CHECK(list.getBack() == 8);
+  }
+
+  SECTION("test list iteration")
+  {
+    int values[] = {1, 3, -2, -4, 7};
+    DLList<int> list(5, values);
+
+    // iterate using C++ explicit iterator object
+    DLList<int>::iterator forward;
+    int index = 0;
+    for (forward = list.begin(); forward != list.end(); ++forward)
+    {
+      int item = *forward;
+      CHECK(item == values[index]);
+      index++;
+    }
+    CHECK(index == 5);
+
+    // iterate using C++ range based iteration with cleaner syntax, but
+    // these use the iterator objects behind the scenes
+    index = 0;
+    for (int value : list)
+    {
+      CHECK(value == values[index]);
+      index++;
+    }
+    CHECK(index == 5);
+
+    // a const list gives const iterators, which compare with mutable ones
+    const DLList<int>& constList = list;
+    DLList<int>::const_iterator constItr = constList.begin();
+    CHECK(constItr == list.begin());
+    CHECK(count_if(constList.begin(), constList.end(), [](int value) { return value < 0; }) == 2);
+    CHECK(*max_element(list.cbegin(), list.cend()) == 7);
+
+    // iterate backward over the list, from the back to the front
+    index = 0;
+    for (DLListIterator<int> itr = list.rbegin(); itr != list.rend(); ++itr)
+    {
+      CHECK(*itr == values[4 - index]);
+      index++;
+    }
+    CHECK(index == 5);
+
+    // a reverse iterator can also be moved back the other way
+    DLListIterator<int> itr = list.rbegin();
+    ++itr;
+    ++itr;
+    CHECK(*itr == -2);
+    --itr;
+    CHECK(*itr == -4);
+
+    // values can be changed through the iterators
+    for (int& value : list)
+    {
+      value = -value;
+    }
+    CHECK(list.str() == "<list> size: 5 [ -1, -3, 2, 4, -7 ]");
+  }
+
+  SECTION("test insert value at index")
+  {
+    DLList<int> list;
+    list.insertAt(0, 5);
+    list.insertAt(0, 1);
+    list.insertAt(2, 9);
+    CHECK(list.str() == "<list> size: 3 [ 1, 5, 9 ]");
+
+    // insert in the first and the second half of the list
+    list.insertAt(1, 3);
+    list.insertAt(3, 7);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, 5, 7, 9 ]");
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 9);
+
+    CHECK_THROWS_AS(list.insertAt(-1, 0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(list.insertAt(6, 0), ListMemoryBoundsException);
+  }
+}
+
+/** Test DLList<string> concrete doubly linked implementation of list of strings
+ */
+TEST_CASE("DLList<string> test string list concrete doubly linked implementation", "[dllist]")
+{
+  SECTION("test insertion and deletion at both ends")
+  {
+    DLList<string> list;
+    list.insertBack("charlie");
+    list.insertFront("bravo");
+    list.insertFront("alpha");
+    list.insertBack("delta");
+    CHECK(list.str() == "<list> size: 4 [ alpha, bravo, charlie, delta ]");
+
+    list.deleteBack();
+    list.deleteFront();
+    CHECK(list.str() == "<list> size: 2 [ bravo, charlie ]");
+    CHECK(list[1] == "charlie");
+    list.clear();
+    CHECK(list.isEmpty());
+    list.insertBack("echo");
+    CHECK(list.str() == "<list> size: 1 [ echo ]");
+  }
+
+  SECTION("test move semantics and emplace")
+  {
+    DLList<string> list;
+    string value = "alpha";
+    list.insertBack(move(value));
+    string& back = list.emplaceBack(3, 'x');
+    CHECK(back == "xxx");
+    string& front = list.emplaceFront("hotel");
+    CHECK(front == "hotel");
+    list.insertAt(1, string("india"));
+    CHECK(list.str() == "<list> size: 4 [ hotel, india, alpha, xxx ]");
+  }
+}
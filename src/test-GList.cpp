@@ -0,0 +1,245 @@
+/** @file test-GList.cpp
+ * @brief Unit tests for the GList gap buffer List implementation
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * This file contains test cases and individual unit tests for the
+ * GList gap buffer implementation of the List abstraction.  This
+ * file uses the catch2 unit test framework to define the test cases
+ * and test assertions.
+ */
+#include "GList.hpp"
+#include "AList.hpp"
+#include "ListException.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+/** Test GList<int> concrete gap buffer implementation of list of integers
+ */
+TEST_CASE("GList<int> test integer list concrete gap buffer implementation", "[glist]")
+{
+  SECTION("test empty list is empty")
+  {
+    GList<int> empty;
+
+    // empty lists should be empty
+    CHECK(empty.getSize() == 0);
+    CHECK(empty.getAllocationSize() == 0);
+    CHECK(empty.isEmpty());
+    CHECK(empty.str() == "<list> size: 0 [ ]");
+
+    // empty lists should compare as being equal
+    GList<int> otherEmpty;
+    CHECK(otherEmpty == empty);
+    CHECK(empty == otherEmpty);
+
+    // empty lists should complain if asked to get or delete a value
+    CHECK_THROWS_AS(empty.getFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.getBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty[0], ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteIndex(0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.insertAt(1, 5), ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteValue(5), ListValueNotFoundException);
+  }
+
+  SECTION("test array based constructor and insertion at both ends")
+  {
+    int values[] = {1, 3, -2, -4, 7};
+    GList<int> list(5, values);
+
+    CHECK(list.getSize() == 5);
+    CHECK(list.getAllocationSize() == 5);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, -2, -4, 7 ]");
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 7);
+    CHECK_THROWS_AS(list[-1], ListMemoryBoundsException);
+    CHECK_THROWS_AS(list[5], ListMemoryBoundsException);
+
+    list.insertBack(22);
+    CHECK(list.getAllocationSize() == 10);
+    list << -22;
+    list.insertFront(-38);
+    list >> 38;
+    CHECK(list.getSize() == 9);
+    CHECK(list.getAllocationSize() == 10);
+    CHECK(list.getFront() == -38);
+    CHECK(list.getBack() == 38);
+    CHECK(list.str() == "<list> size: 9 [ -38, -22, 1, 3, -2, -4, 7, 22, 38 ]");
+
+    // growing while the gap is in the middle keeps the values in order
+    list.insertAt(4, 100);
+    list.insertAt(5, 101);
+    CHECK(list.getAllocationSize() == 20);
+    CHECK(list.str() == "<list> size: 11 [ -38, -22, 1, 3, 100, 101, -2, -4, 7, 22, 38 ]");
+  }
+
+  SECTION("test clustered insertion and deletion in the middle")
+  {
+    GList<int> list;
+    for (int value = 0; value < 10; value++)
+    {
+      list.insertBack(value);
+    }
+
+    // type some values into the middle, then backspace over some
+    list.insertAt(5, 50);
+    list.insertAt(6, 51);
+    list.insertAt(7, 52);
+    CHECK(list.str() == "<list> size: 13 [ 0, 1, 2, 3, 4, 50, 51, 52, 5, 6, 7, 8, 9 ]");
+    list.deleteIndex(7);
+    list.deleteIndex(6);
+    CHECK(list.str() == "<list> size: 11 [ 0, 1, 2, 3, 4, 50, 5, 6, 7, 8, 9 ]");
+
+    // jump around the list moving the gap in both directions
+    list.deleteIndex(0);
+    list.insertAt(10, 99);
+    list.deleteIndex(3);
+    CHECK(list.str() == "<list> size: 10 [ 1, 2, 3, 50, 5, 6, 7, 8, 9, 99 ]");
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 99);
+    CHECK(list[3] == 50);
+    CHECK(list[4] == 5);
+    CHECK_THROWS_AS(list.insertAt(-1, 0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(list.insertAt(11, 0), ListMemoryBoundsException);
+
+    // lists compare equal to other List implementations with same values
+    int values[] = {1, 2, 3, 50, 5, 6, 7, 8, 9, 99};
+    AList<int> other(10, values);
+    CHECK(list == other);
+    CHECK(other == list);
+
+    // copies are compacted, with the gap at the back
+    GList<int> copy = list;
+    CHECK(copy.getAllocationSize() == 10);
+    CHECK(copy == list);
+    copy.deleteBack();
+    CHECK_FALSE(copy == list);
+    copy = list;
+    CHECK(copy == list);
+  }
+
+  SECTION("test deleting values from both ends and by value")
+  {
+    int values[] = {4, 1, 4, 2, 4, 3, 4};
+    GList<int> list(7, values);
+
+    list.deleteValue(4);
+    CHECK(list.str() == "<list> size: 3 [ 1, 2, 3 ]");
+    CHECK_THROWS_AS(list.deleteValue(4), ListValueNotFoundException);
+
+    list.deleteBack();
+    CHECK(list.str() == "<list> size: 2 [ 1, 2 ]");
+    list.deleteFront();
+    CHECK(list.str() == "<list> size: 1 [ 2 ]");
+    list.deleteFront();
+    CHECK(list.isEmpty());
+    CHECK(list.str() == "<list> size: 0 [ ]");
+
+    list.clear();
+    CHECK(list.getAllocationSize() == 0);
+  }
+
+  SECTION("test list iteration")
+  {
+    int values[] = {3, 1, 4, 2};
+    GList<int> list(4, values);
+
+    // iterate using the indexing operator[] of the list abstraction
+    for (int index = 0; index < list.getSize(); index++)
+    {
+      CHECK(list[index] == values[index]);
+    }
+
+    // iterate using C++ explicit iterator object, with the gap in the
+    // middle of the list
+    list.insertAt(2, 9);
+    list.deleteIndex(2);
+    CHECK(list.getAllocationSize() == 8);
+    GList<int>::iterator itr;
+    int index = 0;
+    for (itr = list.begin(); itr != list.end(); ++itr)
+    {
+      int item = *itr;
+      CHECK(item == values[index]);
+      index++;
+    }
+    CHECK(index == 4);
+
+    // iterate using C++ range based iteration with cleaner syntax, but
+    // these use the iterator objects behind the scenes
+    index = 0;
+    for (int value : list)
+    {
+      CHECK(value == values[index]);
+      index++;
+    }
+    CHECK(index == 4);
+
+    // values can be changed through the iterators, on both sides of the gap
+    for (int& value : list)
+    {
+      value *= 10;
+    }
+    CHECK(list.str() == "<list> size: 4 [ 30, 10, 40, 20 ]");
+    list.insertAt(1, 10);
+    CHECK(count(list.begin(), list.end(), 10) == 2);
+
+    // a const list gives const iterators, which compare with mutable ones
+    const GList<int>& constList = list;
+    GList<int>::const_iterator constItr = constList.begin();
+    CHECK(constItr == list.begin());
+    CHECK(*max_element(constList.begin(), constList.end()) == 40);
+    CHECK(distance(list.cbegin(), list.cend()) == 5);
+  }
+}
+
+/** Test GList<string> concrete gap buffer implementation of list of strings
+ */
+TEST_CASE("GList<string> test string list concrete gap buffer implementation", "[glist]")
+{
+  SECTION("test clustered edits of strings")
+  {
+    GList<string> list;
+    for (int index = 0; index < 30; index++)
+    {
+      list.insertBack("value-" + to_string(index));
+    }
+
+    // edits near each other in the middle of the list
+    string value = "inserted";
+    list.insertAt(15, move(value));
+    list.insertAt(16, "another");
+    list.deleteIndex(14);
+    list.deleteIndex(16);
+    CHECK(list.getSize() == 30);
+    CHECK(list[13] == "value-13");
+    CHECK(list[14] == "inserted");
+    CHECK(list[15] == "another");
+    CHECK(list[16] == "value-16");
+    CHECK(list.getFront() == "value-0");
+    CHECK(list.getBack() == "value-29");
+
+    // moving the gap to both ends
+    list.insertFront("front");
+    list.insertBack("back");
+    list.deleteValue("another");
+    CHECK(list.getSize() == 31);
+    CHECK(list[0] == "front");
+    CHECK(list[15] == "inserted");
+    CHECK(list[16] == "value-16");
+    CHECK(list[30] == "back");
+
+    GList<string> moved(move(list));
+    CHECK(list.isEmpty());
+    CHECK(moved.getSize() == 31);
+    CHECK(moved.getBack() == "back");
+  }
+}
@@ -17,10 +17,19 @@
  * assertions.
  */
 #include "LList.hpp"
+#include "DLList.hpp"
+#include "AList.hpp"
 #include "ListException.hpp"
-#include "ListIterator.hpp"
+#include "StaticList.hpp"
 #include "catch.hpp"
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <type_traits>
+#include <vector>
 using namespace std;
 
 /** Task 1: Test LList insertBack() basic functionality.  For first task, initially
@@ -902,7 +911,7 @@ using namespace std;
     }
 
     // iterate using C++ explicit iterator object
-    ListIterator<int> itr;
+    LList<int>::iterator itr;
     int index = 0;
     for (itr = list.begin(); itr != list.end(); ++itr)
     {
@@ -920,6 +929,36 @@ using namespace std;
       index++;
     }
    }
+
+   SECTION("test insert value at index")
+   {
+    int values[] = {3, 1, 4, 2};
+    LList<int> list(4, values);
+
+    // insert in the middle, at the front and at the back
+    list.insertAt(2, 9);
+    CHECK(list.str() == "<list> size: 5 [ 3, 1, 9, 4, 2 ]");
+    list.insertAt(0, 8);
+    CHECK(list.str() == "<list> size: 6 [ 8, 3, 1, 9, 4, 2 ]");
+    list.insertAt(6, 7);
+    CHECK(list.str() == "<list> size: 7 [ 8, 3, 1, 9, 4, 2, 7 ]");
+    list.insertAt(5, 6);
+    CHECK(list.str() == "<list> size: 8 [ 8, 3, 1, 9, 4, 6, 2, 7 ]");
+    CHECK(list.getFront() == 8);
+    CHECK(list.getBack() == 7);
+
+    // the index can be at most 1 past the back of the list
+    CHECK_THROWS_AS(list.insertAt(-1, 0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(list.insertAt(9, 0), ListMemoryBoundsException);
+    CHECK(list.getSize() == 8);
+
+    // inserting into an empty list
+    LList<int> empty;
+    empty.insertAt(0, 5);
+    CHECK(empty.str() == "<list> size: 1 [ 5 ]");
+    CHECK(empty.getFront() == 5);
+    CHECK(empty.getBack() == 5);
+   }
    }
  
 
@@ -1204,7 +1243,7 @@ TEST_CASE("LList<string> test string list concrete linked list implementation",
     }
 
     // iterate using C++ explicit iterator object
-    ListIterator<string> itr;
+    LList<string>::iterator itr;
     int index = 0;
     for (itr = list.begin(); itr != list.end(); ++itr)
     {
@@ -1222,5 +1261,457 @@ TEST_CASE("LList<string> test string list concrete linked list implementation",
       index++;
     }
   }
+
+  SECTION("test move semantics and emplace")
+  {
+    string values[] = {"charlie", "alpha", "delta", "bravo"};
+    LList<string> list(4, values);
+
+    // moving a list takes over its nodes and leaves the original empty
+    LList<string> moved = move(list);
+    CHECK(moved.getSize() == 4);
+    CHECK(moved.str() == "<list> size: 4 [ charlie, alpha, delta, bravo ]");
+    CHECK(list.getSize() == 0);
+    CHECK(list.isEmpty());
+    CHECK(list.str() == "<list> size: 0 [ ]");
+
+    // move assignment replaces the values of the target list
+    list = move(moved);
+    CHECK(list.str() == "<list> size: 4 [ charlie, alpha, delta, bravo ]");
+    CHECK(moved.isEmpty());
+
+    // copy assignment gives an independent copy
+    moved = list;
+    CHECK(moved == list);
+    moved[0] = "echo";
+    CHECK_FALSE(moved == list);
+
+    // inserting an rvalue moves the value into the list
+    string value = "foxtrot";
+    list.insertBack(move(value));
+    CHECK(list.getBack() == "foxtrot");
+    value = "golf";
+    list.insertFront(move(value));
+    CHECK(list.getFront() == "golf");
+    CHECK(list.str() == "<list> size: 6 [ golf, charlie, alpha, delta, bravo, foxtrot ]");
+
+    // emplace constructs the value from constructor arguments
+    string& back = list.emplaceBack(3, 'x');
+    CHECK(back == "xxx");
+    string& front = list.emplaceFront("hotel");
+    CHECK(front == "hotel");
+    CHECK(list.getSize() == 8);
+    CHECK(list.getBack() == "xxx");
+    CHECK(list.str() == "<list> size: 8 [ hotel, golf, charlie, alpha, delta, bravo, foxtrot, xxx ]");
+
+    // emplacing on an empty list sets up both front and back
+    LList<string> empty;
+    empty.emplaceFront("india");
+    CHECK(empty.getFront() == "india");
+    CHECK(empty.getBack() == "india");
+  }
+
+  SECTION("test removing values in bulk")
+  {
+    int values[] = {1, 2, 3, 2, 4, 2, 5, 6, 2};
+    LList<int> list(9, values);
+
+    // remove matching values, the rest keep their order
+    CHECK(list.removeIf([](const int& value) { return value == 2; }) == 4);
+    CHECK(list.getSize() == 5);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, 4, 5, 6 ]");
+
+    // nothing to remove is not an error
+    CHECK(list.removeIf([](const int& value) { return value > 100; }) == 0);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, 4, 5, 6 ]");
+
+    // removing the front and back keeps the list consistent
+    CHECK(list.removeAll(vector<int>{1, 6, 42}) == 2);
+    CHECK(list.str() == "<list> size: 3 [ 3, 4, 5 ]");
+    CHECK(list.getFront() == 3);
+    CHECK(list.getBack() == 5);
+    list.insertBack(7);
+    list.insertFront(0);
+    CHECK(list.str() == "<list> size: 5 [ 0, 3, 4, 5, 7 ]");
+
+    // remove everything from the list
+    int odd[] = {3, 5, 7};
+    CHECK(list.removeAll(odd) == 3);
+    CHECK(list.removeIf([](const int& value) { return value % 2 == 0; }) == 2);
+    CHECK(list.isEmpty());
+    CHECK(list.str() == "<list> size: 0 [ ]");
+    list.insertBack(8);
+    CHECK(list.getFront() == 8);
+    CHECK(list.getBack() == 8);
+
+    // a large purge is done in a single pass
+    LList<string> words;
+    for (int index = 0; index < 10000; index++)
+    {
+      words.insertBack(index % 3 == 0 ? "purge" : to_string(index));
+    }
+    words.deleteValue("purge");
+    CHECK(words.getSize() == 6666);
+    CHECK(words.getFront() == "1");
+    CHECK(words.getBack() == "9998");
+    CHECK(words.removeAll(vector<string>{"purge"}) == 0);
+    CHECK_THROWS_AS(words.deleteValue("purge"), ListValueNotFoundException);
+  }
+
+  SECTION("test nodes come from the node pool")
+  {
+    LList<string> list;
+    CHECK(list.getNodeAllocator().getSlabCount() == 0);
+
+    // nodes are carved out of slabs that double in size
+    for (int index = 0; index < 24; index++)
+    {
+      list.insertBack("value-" + to_string(index));
+    }
+    CHECK(list.getNodeAllocator().getSlabCount() == 2);
+    CHECK(list.getNodeAllocator().getCapacity() == 24);
+    CHECK(list.getNodeAllocator().getLiveCount() == 24);
+
+    // deleted nodes go on the free list and are reused
+    list.deleteFront();
+    list.deleteBack();
+    list.deleteIndex(10);
+    list.deleteValue("value-5");
+    CHECK(list.getNodeAllocator().getLiveCount() == 20);
+    list.insertFront("front");
+    list.insertBack("back");
+    list.insertAt(5, "middle");
+    list.emplaceBack(3, 'x');
+    CHECK(list.getNodeAllocator().getLiveCount() == 24);
+    CHECK(list.getNodeAllocator().getCapacity() == 24);
+    CHECK(list.getSize() == 24);
+    CHECK(list.getFront() == "front");
+    CHECK(list[5] == "middle");
+    CHECK(list[6] == "value-6");
+    CHECK(list.getBack() == "xxx");
+
+    // moving the list moves its pool along with its nodes
+    LList<string> moved = move(list);
+    CHECK(moved.getNodeAllocator().getLiveCount() == 24);
+    CHECK(list.getNodeAllocator().getSlabCount() == 0);
+    moved.deleteFront();
+    CHECK(moved.getFront() == "value-1");
+    list.insertBack("alpha");
+    CHECK(list.str() == "<list> size: 1 [ alpha ]");
+
+    // a copy gets its own pool
+    LList<string> copy = moved;
+    CHECK(copy == moved);
+    CHECK(copy.getNodeAllocator().getLiveCount() == 23);
+
+    // clearing gives all of the slabs back at once
+    moved.clear();
+    CHECK(moved.getNodeAllocator().getSlabCount() == 0);
+    CHECK(moved.getNodeAllocator().getLiveCount() == 0);
+    moved.insertBack("bravo");
+    CHECK(moved.str() == "<list> size: 1 [ bravo ]");
+  }
+
+  SECTION("test indexed access stays correct as the list changes")
+  {
+    // sequential indexed scans walk forward from the last access
+    LList<int> list;
+    for (int value = 0; value < 20000; value++)
+    {
+      list.insertBack(value);
+    }
+    long sum = 0;
+    for (int index = 0; index < list.getSize(); index++)
+    {
+      sum += list[index];
+    }
+    CHECK(sum == 199990000L);
+    LList<int> copy = list;
+    CHECK(copy == list);
+
+    // going back to an earlier index starts over from the front
+    CHECK(list[10] == 10);
+    CHECK(list[5] == 5);
+    CHECK(list[19999] == 19999);
+    CHECK(list[6] == 6);
+
+    // inserting and deleting at the front shifts the remembered index
+    list.insertFront(-1);
+    CHECK(list[7] == 6);
+    list.deleteFront();
+    list.deleteFront();
+    CHECK(list[6] == 7);
+    CHECK(list[0] == 1);
+    list.deleteFront();
+    CHECK(list[0] == 2);
+    CHECK(list[1] == 3);
+
+    // deleting and inserting in the middle keeps indexes consistent
+    list.deleteIndex(1);
+    CHECK(list[1] == 4);
+    list.insertAt(1, 3);
+    CHECK(list[1] == 3);
+    CHECK(list[2] == 4);
+    list.deleteBack();
+    CHECK(list[list.getSize() - 1] == 19998);
+    list.deleteValue(4);
+    CHECK(list[2] == 5);
+    list.removeIf([](const int& value) { return value < 10; });
+    CHECK(list[0] == 10);
+    CHECK(list.getSize() == 19989);
+
+    // clearing and moving forget the remembered position
+    LList<int> moved = move(list);
+    CHECK(moved[3] == 13);
+    list.insertBack(42);
+    CHECK(list[0] == 42);
+    moved.clear();
+    moved.insertBack(7);
+    moved.insertBack(8);
+    CHECK(moved[1] == 8);
+    CHECK(moved[0] == 7);
+  }
+
+  SECTION("test equality and ordering of large lists")
+  {
+    // walking the nodes of both lists keeps comparisons O(n)
+    LList<int> list;
+    DLList<int> doubly;
+    AList<int> array;
+    for (int value = 0; value < 100000; value++)
+    {
+      list.insertBack(value);
+      doubly.insertBack(value);
+      array.insertBack(value);
+    }
+    LList<int> copy = list;
+    CHECK(list == copy);
+    CHECK(list == doubly);
+    CHECK(doubly == list);
+    CHECK(array == list);
+    CHECK(array == doubly);
+    CHECK(list.compare(doubly) == 0);
+    CHECK(array.compare(doubly) == 0);
+
+    // a difference at the very end is still found
+    copy.deleteBack();
+    copy.insertBack(-1);
+    CHECK_FALSE(list == copy);
+    CHECK(copy < list);
+    CHECK(copy < doubly);
+    CHECK(doubly.compare(copy) > 0);
+    CHECK(array.compare(copy) > 0);
+    doubly.insertBack(100000);
+    CHECK(list < doubly);
+    CHECK(array < doubly);
+    CHECK(doubly.compare(array) > 0);
+  }
+
+  SECTION("test skip index keeps positional access correct")
+  {
+    // mirror every kind of change in a vector, with the index enabled
+    LList<int> list;
+    CHECK_FALSE(list.hasSkipIndex());
+    list.setSkipIndex(true);
+    CHECK(list.hasSkipIndex());
+
+    vector<int> expected;
+    unsigned int random = 12345;
+    for (int value = 0; value < 4000; value++)
+    {
+      random = random * 1103515245 + 12345;
+      int index = (random >> 8) % (expected.size() + 1);
+      switch ((random >> 4) % 4)
+      {
+      case 0:
+        list.insertFront(value);
+        expected.insert(expected.begin(), value);
+        break;
+      case 1:
+        list.insertBack(value);
+        expected.push_back(value);
+        break;
+      default:
+        list.insertAt(index, value);
+        expected.insert(expected.begin() + index, value);
+        break;
+      }
+    }
+    for (int count = 0; count < 1500; count++)
+    {
+      random = random * 1103515245 + 12345;
+      int index = (random >> 8) % expected.size();
+      switch ((random >> 4) % 4)
+      {
+      case 0:
+        list.deleteFront();
+        expected.erase(expected.begin());
+        break;
+      case 1:
+        list.deleteBack();
+        expected.pop_back();
+        break;
+      default:
+        list.deleteIndex(index);
+        expected.erase(expected.begin() + index);
+        break;
+      }
+    }
+    list.removeIf([](const int& value) { return value % 7 == 0; });
+    expected.erase(remove_if(expected.begin(), expected.end(), [](int value) { return value % 7 == 0; }), expected.end());
+    list.deleteValue(expected[expected.size() / 2]);
+    expected.erase(expected.begin() + expected.size() / 2);
+
+    // index from the back so the remembered position never helps
+    REQUIRE(list.getSize() == static_cast<int>(expected.size()));
+    bool allEqual = true;
+    for (int index = list.getSize() - 1; index >= 0; index--)
+    {
+      allEqual = allEqual and list[index] == expected[index];
+    }
+    CHECK(allEqual);
+
+    // copies are indexed too, and the index can be turned off again
+    LList<int> copy = list;
+    CHECK(copy.hasSkipIndex());
+    CHECK(copy == list);
+    copy.setSkipIndex(false);
+    CHECK_FALSE(copy.hasSkipIndex());
+    copy.insertAt(100, -1);
+    CHECK(copy[100] == -1);
+    CHECK(copy[101] == expected[100]);
+
+    // enabling the index on a list that already has values builds it
+    copy.setSkipIndex(true);
+    CHECK(copy[2000] == expected[1999]);
+    copy.clear();
+    CHECK(copy.hasSkipIndex());
+    copy.insertBack(5);
+    CHECK(copy[0] == 5);
+  }
+
+  SECTION("test standard iterators and algorithms")
+  {
+    string words[] = {"delta", "alpha", "charlie", "bravo"};
+    LList<string> list(4, words);
+
+    // the iterators are standard forward iterators
+    using Iterator = LList<string>::iterator;
+    CHECK(is_same<iterator_traits<Iterator>::iterator_category, forward_iterator_tag>::value);
+    CHECK(is_same<iterator_traits<Iterator>::value_type, string>::value);
+    CHECK(is_same<iterator_traits<Iterator>::reference, string&>::value);
+    CHECK(is_same<iterator_traits<LList<string>::const_iterator>::reference, const string&>::value);
+    CHECK(distance(list.begin(), list.end()) == 4);
+
+    // values are accessed by reference, so they can be changed in place
+    for (string& word : list)
+    {
+      word[0] = toupper(word[0]);
+    }
+    CHECK(list.str() == "<list> size: 4 [ Delta, Alpha, Charlie, Bravo ]");
+    Iterator itr = list.begin();
+    CHECK(itr->size() == 5);
+    Iterator before = itr++;
+    CHECK(*before == "Delta");
+    CHECK(*itr == "Alpha");
+
+    // algorithms work directly on the list
+    CHECK(*min_element(list.begin(), list.end()) == "Alpha");
+    replace(list.begin(), list.end(), string("Charlie"), string("Echo"));
+    CHECK(list[2] == "Echo");
+    CHECK(find(list.begin(), list.end(), "Foxtrot") == list.end());
+
+    // a const list hands out const iterators
+    const LList<string>& constList = list;
+    LList<string>::const_iterator constItr = constList.begin();
+    CHECK(*constItr == "Delta");
+    CHECK(constItr == list.begin());
+    CHECK(distance(constList.cbegin(), find(constList.begin(), constList.end(), "Bravo")) == 3);
+
+    int values[] = {3, 1, 4, 1, 5};
+    LList<int> numbers(5, values);
+    CHECK(accumulate(numbers.cbegin(), numbers.cend(), 0) == 14);
+    CHECK(count(numbers.begin(), numbers.end(), 1) == 2);
+    CHECK(equal(numbers.begin(), numbers.end(), values));
+  }
+
+  SECTION("test streaming output and writing ranges")
+  {
+    LList<string> list;
+    list.insertBack("Alpha");
+    list.insertBack("Bravo");
+    list.insertBack("Charlie");
+    list.insertBack("Delta");
+
+    ostringstream out;
+    out << list;
+    CHECK(out.str() == "<list> size: 4 [ Alpha, Bravo, Charlie, Delta ]");
+    CHECK(out.str() == list.str());
+
+    ostringstream page;
+    list.writeTo(page, 1, 2);
+    CHECK(page.str() == "Bravo, Charlie");
+    page.str("");
+    list.writeTo(page, 3, 1);
+    CHECK(page.str() == "Delta");
+    CHECK_THROWS_AS(list.writeTo(page, 2, 3), ListMemoryBoundsException);
+  }
+
+  SECTION("test statically dispatched facade")
+  {
+    LList<string> list;
+    StaticList<LList<string>> facade = staticList(list);
+    facade.insertBack("Bravo").insertFront("Alpha").insertAt(2, "Charlie");
+    CHECK(facade.getSize() == 3);
+    CHECK(facade.str() == "<list> size: 3 [ Alpha, Bravo, Charlie ]");
+    CHECK(facade.getBack() == "Charlie");
+    CHECK(facade[1] == "Bravo");
+    CHECK(find(facade.begin(), facade.end(), "Charlie") != facade.end());
+
+    facade.deleteValue("Bravo");
+    facade.deleteFront();
+    CHECK(list.str() == "<list> size: 1 [ Charlie ]");
+    facade.clear();
+    CHECK(facade.isEmpty());
+    CHECK_THROWS_AS(facade.getFront(), ListEmptyException);
+  }
+
+  SECTION("test saving and loading binary files")
+  {
+    const string path = "test-LList-binary.lst";
+
+    LList<string> list;
+    for (int index = 0; index < 3000; index++)
+    {
+      list.insertBack(to_string(index * index));
+    }
+    list.insertBack("");
+    list.saveBinary(path);
+
+    // all of the nodes of the loaded list come from a single slab
+    LList<string> loaded;
+    loaded.insertBack("Alpha");
+    loaded.loadBinary(path);
+    CHECK(loaded == list);
+    CHECK(loaded.getNodeAllocator().getSlabCount() == 1);
+    CHECK(loaded.getNodeAllocator().getCapacity() == 3001);
+    CHECK(loaded[2999] == "8994001");
+    loaded.insertBack("Bravo");
+    CHECK(loaded.getBack() == "Bravo");
+
+    // the file of a linked list can be loaded by an array list
+    AList<string> array;
+    array.loadBinary(path);
+    CHECK(array == list);
+
+    LList<int> ints;
+    CHECK_THROWS_AS(ints.loadBinary(path), ListFileException);
+    CHECK(ints.isEmpty());
+    LList<string>().saveBinary(path);
+    loaded.loadBinary(path);
+    CHECK(loaded.isEmpty());
+
+    remove(path.c_str());
+  }
 }
 
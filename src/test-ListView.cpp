@@ -0,0 +1,191 @@
+/** @file test-ListView.cpp
+ * @brief Unit tests for the ListView non-owning view of a List
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * This file contains test cases and individual unit tests for the
+ * ListView, which reads the values of an array or AList in place
+ * through the List abstraction.  This file uses the catch2 unit test
+ * framework to define the test cases and test assertions.
+ */
+#include "ListView.hpp"
+#include "AList.hpp"
+#include "LList.hpp"
+#include "ListException.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <type_traits>
+using namespace std;
+
+/** Test ListView<int> views of arrays and lists of integers
+ */
+TEST_CASE("ListView<int> test views of integer arrays and lists", "[listview]")
+{
+  SECTION("test empty view is empty")
+  {
+    ListView<int> empty;
+    CHECK(empty.getSize() == 0);
+    CHECK(empty.isEmpty());
+    CHECK(empty.str() == "<list> size: 0 [ ]");
+    CHECK(empty == AList<int>());
+    CHECK(empty.begin() == empty.end());
+    CHECK_THROWS_AS(empty.getFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.getBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty[0], ListMemoryBoundsException);
+  }
+
+  SECTION("test view of array")
+  {
+    int values[] = {3, 1, 4, 1, 5, 9, 2, 6};
+    ListView<int> view(8, values);
+    CHECK(view.getSize() == 8);
+    CHECK(view.getFront() == 3);
+    CHECK(view.getBack() == 6);
+    CHECK(view[5] == 9);
+    CHECK(view.str() == "<list> size: 8 [ 3, 1, 4, 1, 5, 9, 2, 6 ]");
+    CHECK(accumulate(view.begin(), view.end(), 0) == 31);
+    CHECK(view.cend() - view.cbegin() == 8);
+    CHECK_THROWS_AS(view[8], ListMemoryBoundsException);
+    CHECK_THROWS_AS(view[-1], ListMemoryBoundsException);
+
+    // the values are not copied, the view sees changes to the array
+    // and changes through the view are made to the array
+    values[0] = 10;
+    CHECK(view.getFront() == 10);
+    view[1] = 20;
+    CHECK(values[1] == 20);
+
+    // a range of an array is viewed from the address of its first value
+    ListView<int> range(3, values + 2);
+    CHECK(range.str() == "<list> size: 3 [ 4, 1, 5 ]");
+    ostringstream out;
+    out << range;
+    CHECK(out.str() == range.str());
+  }
+
+  SECTION("test view of list and range of list")
+  {
+    AList<int> list;
+    for (int value = 1; value <= 10; value++)
+    {
+      list.insertBack(value);
+    }
+
+    ListView<int> view(list);
+    CHECK(view.getSize() == 10);
+    CHECK(view == list);
+    CHECK(list == view);
+    CHECK(&view[3] == &list[3]);
+
+    // the values can be changed through a view, so a const list, whose
+    // data() only gives read access, can not be viewed
+    static_assert(not is_constructible<ListView<int>, const AList<int>&>::value, "a const list can not be viewed");
+    static_assert(is_same<decltype(static_cast<const AList<int>&>(list).data()), const int*>::value, "data() of a const list is read only");
+
+    ListView<int> range(list, 2, 3);
+    CHECK(range.str() == "<list> size: 3 [ 3, 4, 5 ]");
+    CHECK(range.getFront() == 3);
+    CHECK(range.getBack() == 5);
+    CHECK(ListView<int>(list, 10, 0).isEmpty());
+    CHECK_THROWS_AS(ListView<int>(list, 8, 3), ListMemoryBoundsException);
+    CHECK_THROWS_AS(ListView<int>(list, -1, 2), ListMemoryBoundsException);
+
+    // ranges of views view the same values again
+    ListView<int> subview = view.subview(2, 3);
+    CHECK(subview == range);
+    CHECK(subview.subview(1, 1).str() == "<list> size: 1 [ 4 ]");
+    CHECK_THROWS_AS(view.subview(5, 6), ListMemoryBoundsException);
+
+    // contiguous values are compared directly, whichever side the view
+    // is on and whatever the inline buffer or bounds checks of the list
+    AList<int, 16, UncheckedBounds> small;
+    small.insertBack(3);
+    small.insertBack(4);
+    small.insertBack(5);
+    CHECK(range == small);
+    CHECK(small == range);
+    CHECK(small == ListView<int>(list, 2, 3));
+    small.insertBack(0);
+    CHECK(range < small);
+    CHECK(small < view.subview(3, 2));
+    CHECK_FALSE(small == list);
+
+    // views compare with any kind of list by their values
+    LList<int> linked;
+    linked.insertBack(3);
+    linked.insertBack(4);
+    linked.insertBack(5);
+    CHECK(range == linked);
+    CHECK(linked == range);
+    linked.deleteBack();
+    CHECK(linked < range);
+    CHECK(range < view.subview(3, 1));
+    CHECK(view.subview(0, 2) < range);
+  }
+
+  SECTION("test view can not insert or remove values")
+  {
+    int values[] = {1, 2, 3};
+    ListView<int> view(3, values);
+    List<int>& list = view;
+    CHECK_THROWS_AS(list.insertBack(4), ListReadOnlyException);
+    CHECK_THROWS_AS(list.insertFront(0), ListReadOnlyException);
+    CHECK_THROWS_AS(list.insertAt(1, 5), ListReadOnlyException);
+    CHECK_THROWS_AS(list >> 4, ListReadOnlyException);
+    CHECK_THROWS_AS(list << 0, ListReadOnlyException);
+    CHECK_THROWS_AS(list.deleteBack(), ListReadOnlyException);
+    CHECK_THROWS_AS(list.deleteFront(), ListReadOnlyException);
+    CHECK_THROWS_AS(list.deleteIndex(1), ListReadOnlyException);
+    CHECK_THROWS_AS(list.deleteValue(2), ListReadOnlyException);
+    CHECK_THROWS_AS(list.clear(), ListReadOnlyException);
+    CHECK(view.str() == "<list> size: 3 [ 1, 2, 3 ]");
+
+    try
+    {
+      list.insertBack(4);
+    }
+    catch (const ListReadOnlyException& e)
+    {
+      CHECK(string(e.getOperation()) == "ListView::insertBack");
+      CHECK(string(e.what()) == "Error: <ListView::insertBack> attempt to change a list that is read only");
+    }
+  }
+}
+
+/** Test ListView<string> views of arrays and lists of strings
+ */
+TEST_CASE("ListView<string> test views of string arrays and lists", "[listview]")
+{
+  SECTION("test view of string list")
+  {
+    AList<string> list;
+    list.insertBack("Alpha");
+    list.insertBack("Bravo");
+    list.insertBack("Charlie");
+    list.insertBack("Delta");
+
+    ListView<string> view(list);
+    CHECK(view == list);
+    CHECK(view.str() == "<list> size: 4 [ Alpha, Bravo, Charlie, Delta ]");
+    CHECK(find(view.begin(), view.end(), "Charlie") - view.begin() == 2);
+
+    ListView<string> range(list, 1, 2);
+    CHECK(range.getFront() == "Bravo");
+    CHECK(range.getBack() == "Charlie");
+    ostringstream page;
+    range.writeTo(page, 1, 1);
+    CHECK(page.str() == "Charlie");
+
+    string values[] = {"Bravo", "Charlie"};
+    CHECK(ListView<string>(2, values) == range);
+    values[1] = "Echo";
+    CHECK(range < ListView<string>(2, values));
+  }
+}
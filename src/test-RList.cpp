@@ -0,0 +1,314 @@
+/** @file test-RList.cpp
+ * @brief Unit tests for the RList ring buffer List implementation
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * This file contains test cases and individual unit tests for the
+ * RList circular buffer implementation of the List abstraction.  This
+ * file uses the catch2 unit test framework to define the test cases
+ * and test assertions.
+ */
+#include "RList.hpp"
+#include "AList.hpp"
+#include "ListException.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+/** Test RList<int> concrete ring buffer implementation of list of integers
+ */
+TEST_CASE("RList<int> test integer list concrete ring buffer implementation", "[rlist]")
+{
+  SECTION("test empty list is empty")
+  {
+    RList<int> empty;
+
+    // empty lists should be empty
+    CHECK(empty.getSize() == 0);
+    CHECK(empty.getAllocationSize() == 0);
+    CHECK(empty.isEmpty());
+    CHECK(empty.str() == "<list> size: 0 [ ]");
+
+    // empty lists should compare as being equal
+    RList<int> otherEmpty;
+    CHECK(otherEmpty == empty);
+    CHECK(empty == otherEmpty);
+
+    // empty lists should complain if asked to get or delete a value
+    CHECK_THROWS_AS(empty.getFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.getBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty[0], ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteIndex(0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteValue(5), ListValueNotFoundException);
+  }
+
+  SECTION("test array based constructor and insertion at both ends")
+  {
+    int values[] = {1, 3, -2, -4, 7};
+    RList<int> list(5, values);
+
+    CHECK(list.getSize() == 5);
+    CHECK(list.getAllocationSize() == 5);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, -2, -4, 7 ]");
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 7);
+    CHECK_THROWS_AS(list[-1], ListMemoryBoundsException);
+    CHECK_THROWS_AS(list[5], ListMemoryBoundsException);
+
+    // the list grows when full, then front insertions wrap around
+    // the end of the block
+    list.insertBack(22);
+    CHECK(list.getAllocationSize() == 10);
+    list << -22;
+    list.insertFront(-38);
+    list >> 38;
+    CHECK(list.getSize() == 9);
+    CHECK(list.getAllocationSize() == 10);
+    CHECK(list.getFront() == -38);
+    CHECK(list.getBack() == 38);
+    CHECK(list[1] == -22);
+    CHECK(list[2] == 1);
+    CHECK(list.str() == "<list> size: 9 [ -38, -22, 1, 3, -2, -4, 7, 22, 38 ]");
+
+    // growing a wrapped list keeps the values in list order
+    list.insertFront(99);
+    list.insertFront(98);
+    CHECK(list.getSize() == 11);
+    CHECK(list.getAllocationSize() == 20);
+    CHECK(list.str() == "<list> size: 11 [ 98, 99, -38, -22, 1, 3, -2, -4, 7, 22, 38 ]");
+  }
+
+  SECTION("test copy, move and equality of wrapped lists")
+  {
+    RList<int> list;
+    for (int value = 0; value < 10; value++)
+    {
+      list.insertBack(value);
+    }
+    list.deleteFront();
+    list.deleteFront();
+    list.insertBack(10);
+    list.insertBack(11);
+
+    // values now wrap around the end of the block
+    CHECK(list.getAllocationSize() == 10);
+    CHECK(list.str() == "<list> size: 10 [ 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 ]");
+
+    RList<int> copy = list;
+    CHECK(copy.getAllocationSize() == 10);
+    CHECK(copy == list);
+    CHECK(list == copy);
+
+    // lists compare equal to other List implementations with same values
+    int values[] = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    AList<int> other(10, values);
+    CHECK(list == other);
+    CHECK(other == list);
+
+    copy[9] = 42;
+    CHECK_FALSE(copy == list);
+
+    RList<int> moved = move(copy);
+    CHECK(copy.isEmpty());
+    CHECK(moved.getBack() == 42);
+    copy = list;
+    CHECK(copy == list);
+  }
+
+  SECTION("test deleting values from both ends and the middle")
+  {
+    RList<int> list;
+    for (int value = 0; value < 8; value++)
+    {
+      list.insertFront(value);
+    }
+    CHECK(list.str() == "<list> size: 8 [ 7, 6, 5, 4, 3, 2, 1, 0 ]");
+
+    list.deleteFront();
+    list.deleteBack();
+    CHECK(list.str() == "<list> size: 6 [ 6, 5, 4, 3, 2, 1 ]");
+
+    // delete near front shifts front side, near back shifts back side
+    list.deleteIndex(1);
+    CHECK(list.str() == "<list> size: 5 [ 6, 4, 3, 2, 1 ]");
+    list.deleteIndex(3);
+    CHECK(list.str() == "<list> size: 4 [ 6, 4, 3, 1 ]");
+    CHECK_THROWS_AS(list.deleteIndex(4), ListMemoryBoundsException);
+
+    // insert more values then delete all occurrences of a value
+    list.insertBack(4);
+    list.insertFront(4);
+    list.deleteValue(4);
+    CHECK(list.str() == "<list> size: 3 [ 6, 3, 1 ]");
+    CHECK_THROWS_AS(list.deleteValue(4), ListValueNotFoundException);
+
+    // draining the list from both ends leaves it empty
+    list.deleteBack();
+    list.deleteFront();
+    list.deleteFront();
+    CHECK(list.isEmpty());
+    CHECK(list.str() == "<list> size: 0 [ ]");
+
+    // and list works as a queue after being emptied
+    list.insertBack(1);
+    list.insertBack(2);
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 2);
+  }
+
+  SECTION("test list iteration")
+  {
+    int values[] = {3, 1, 4, 2};
+    RList<int> list(4, values);
+
+    // iterate using the indexing operator[] of the list abstraction
+    for (int index = 0; index < list.getSize(); index++)
+    {
+      CHECK(list[index] == values[index]);
+    }
+
+    // iterate using C++ explicit iterator object
+    RList<int>::iterator itr;
+    int index = 0;
+    for (itr = list.begin(); itr != list.end(); ++itr)
+    {
+      int item = *itr;
+      CHECK(item == values[index]);
+      index++;
+    }
+    CHECK(index == 4);
+
+    // iterate using C++ range based iteration with cleaner syntax, but
+    // these use the iterator objects behind the scenes
+    index = 0;
+    for (int value : list)
+    {
+      CHECK(value == values[index]);
+      index++;
+    }
+    CHECK(index == 4);
+
+    // iteration follows the list as it wraps around the end of the block
+    list.deleteFront();
+    list.deleteFront();
+    list.insertBack(5);
+    list.insertBack(2);
+    list.insertFront(2);
+    CHECK(list.str() == "<list> size: 5 [ 2, 4, 2, 5, 2 ]");
+    CHECK(count(list.begin(), list.end(), 2) == 3);
+    for (int& value : list)
+    {
+      value *= 10;
+    }
+    CHECK(list.str() == "<list> size: 5 [ 20, 40, 20, 50, 20 ]");
+
+    // a const list gives const iterators, which compare with mutable ones
+    const RList<int>& constList = list;
+    RList<int>::const_iterator constItr = constList.begin();
+    CHECK(constItr == list.begin());
+    CHECK(*max_element(constList.begin(), constList.end()) == 50);
+    CHECK(distance(list.cbegin(), list.cend()) == 5);
+  }
+
+  SECTION("test insert value at index")
+  {
+    int values[] = {3, 1, 4, 2};
+    RList<int> list(4, values);
+
+    // insert in the middle, at the front and at the back
+    list.insertAt(2, 9);
+    CHECK(list.str() == "<list> size: 5 [ 3, 1, 9, 4, 2 ]");
+    list.insertAt(0, 8);
+    CHECK(list.str() == "<list> size: 6 [ 8, 3, 1, 9, 4, 2 ]");
+    list.insertAt(6, 7);
+    CHECK(list.str() == "<list> size: 7 [ 8, 3, 1, 9, 4, 2, 7 ]");
+    list.insertAt(5, 6);
+    CHECK(list.str() == "<list> size: 8 [ 8, 3, 1, 9, 4, 6, 2, 7 ]");
+    CHECK(list.getAllocationSize() == 8);
+    CHECK(list.getFront() == 8);
+    CHECK(list.getBack() == 7);
+
+    // the index can be at most 1 past the back of the list
+    CHECK_THROWS_AS(list.insertAt(-1, 0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(list.insertAt(9, 0), ListMemoryBoundsException);
+    CHECK(list.getSize() == 8);
+
+    // inserting into an empty list
+    RList<int> empty;
+    empty.insertAt(0, 5);
+    CHECK(empty.str() == "<list> size: 1 [ 5 ]");
+    CHECK(empty.getFront() == 5);
+    CHECK(empty.getBack() == 5);
+  }
+}
+
+/** Test RList<string> concrete ring buffer implementation of list of strings
+ */
+TEST_CASE("RList<string> test string list concrete ring buffer implementation", "[rlist]")
+{
+  SECTION("test insertion and deletion at both ends")
+  {
+    RList<string> list;
+
+    // use as a double ended work queue
+    for (int index = 0; index < 25; index++)
+    {
+      list.insertBack("back-" + to_string(index));
+      list.insertFront("front-" + to_string(index));
+    }
+    CHECK(list.getSize() == 50);
+    CHECK(list.getFront() == "front-24");
+    CHECK(list.getBack() == "back-24");
+    CHECK(list[24] == "front-0");
+    CHECK(list[25] == "back-0");
+
+    for (int index = 0; index < 20; index++)
+    {
+      list.deleteFront();
+      list.deleteBack();
+    }
+    CHECK(list.getSize() == 10);
+    CHECK(list.str() == "<list> size: 10 [ front-4, front-3, front-2, front-1, front-0, back-0, back-1, back-2, back-3, back-4 ]");
+
+    list.deleteValue("front-0");
+    list.deleteIndex(6);
+    CHECK(list.str() == "<list> size: 8 [ front-4, front-3, front-2, front-1, back-0, back-1, back-3, back-4 ]");
+
+    // delete every instance of a value spread around the wrapped ring
+    list.insertFront("gone");
+    list.insertAt(3, "gone");
+    list.insertAt(7, "gone");
+    list.insertBack("gone");
+    list.deleteValue("gone");
+    CHECK(list.str() == "<list> size: 8 [ front-4, front-3, front-2, front-1, back-0, back-1, back-3, back-4 ]");
+    CHECK_THROWS_AS(list.deleteValue("gone"), ListValueNotFoundException);
+
+    list.clear();
+    CHECK(list.isEmpty());
+    CHECK(list.getAllocationSize() == 0);
+  }
+
+  SECTION("test move semantics and emplace")
+  {
+    RList<string> list;
+    string value = "alpha";
+    list.insertBack(move(value));
+    value = "bravo";
+    list.insertFront(move(value));
+    CHECK(list.emplaceBack(3, 'x') == "xxx");
+    CHECK(list.emplaceFront("charlie") == "charlie");
+    CHECK(list.str() == "<list> size: 4 [ charlie, bravo, alpha, xxx ]");
+
+    RList<string> moved(move(list));
+    CHECK(list.isEmpty());
+    CHECK(moved.getSize() == 4);
+    CHECK(moved.getFront() == "charlie");
+  }
+}
@@ -0,0 +1,387 @@
+/** @file test-TList.cpp
+ * @brief Unit tests for the TList implicit treap List implementation
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * This file contains test cases and individual unit tests for the
+ * TList implicit treap implementation of the List abstraction.
+ * This file uses the catch2 unit test framework to define the test
+ * cases and test assertions.
+ */
+#include "TList.hpp"
+#include "AList.hpp"
+#include "DLList.hpp"
+#include "LList.hpp"
+#include "ListException.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+/** Test TList<int> concrete implicit treap implementation of list of integers
+ */
+TEST_CASE("TList<int> test integer list concrete implicit treap implementation", "[tlist]")
+{
+  SECTION("test empty list is empty")
+  {
+    TList<int> empty;
+
+    // empty lists should be empty
+    CHECK(empty.getSize() == 0);
+    CHECK(empty.isEmpty());
+    CHECK(empty.str() == "<list> size: 0 [ ]");
+
+    // empty lists should compare as being equal
+    TList<int> otherEmpty;
+    CHECK(otherEmpty == empty);
+    CHECK(empty == otherEmpty);
+
+    // empty lists should complain if asked to get or delete a value
+    CHECK_THROWS_AS(empty.getFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.getBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty[0], ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteIndex(0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteValue(5), ListValueNotFoundException);
+  }
+
+  SECTION("test array based constructor and insertion at both ends")
+  {
+    int values[] = {1, 3, -2, -4, 7};
+    TList<int> list(5, values);
+
+    CHECK(list.getSize() == 5);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, -2, -4, 7 ]");
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 7);
+    CHECK_THROWS_AS(list[-1], ListMemoryBoundsException);
+    CHECK_THROWS_AS(list[5], ListMemoryBoundsException);
+
+    list.insertBack(22);
+    list << -22;
+    list.insertFront(-38);
+    list >> 38;
+    CHECK(list.getSize() == 9);
+    CHECK(list.getFront() == -38);
+    CHECK(list.getBack() == 38);
+    CHECK(list.str() == "<list> size: 9 [ -38, -22, 1, 3, -2, -4, 7, 22, 38 ]");
+    list[7] = 99;
+    CHECK(list[7] == 99);
+
+    // equal to other list types with the same values
+    int otherValues[] = {-38, -22, 1, 3, -2, -4, 7, 99, 38};
+    AList<int> other(9, otherValues);
+    CHECK(list == other);
+    CHECK(other == list);
+    other[4] = 42;
+    CHECK_FALSE(list == other);
+    CHECK(list < other);
+    CHECK_FALSE(other < list);
+  }
+
+  SECTION("test positional edits of a large list")
+  {
+    // mirror random positional edits in a vector
+    TList<int> list;
+    vector<int> expected;
+    unsigned int random = 12345;
+    for (int value = 0; value < 3000; value++)
+    {
+      random = random * 1103515245 + 12345;
+      int index = (random >> 8) % (expected.size() + 1);
+      list.insertAt(index, value);
+      expected.insert(expected.begin() + index, value);
+    }
+    for (int count = 0; count < 1000; count++)
+    {
+      random = random * 1103515245 + 12345;
+      int index = (random >> 8) % expected.size();
+      list.deleteIndex(index);
+      expected.erase(expected.begin() + index);
+    }
+
+    REQUIRE(list.getSize() == 2000);
+    bool allEqual = true;
+    for (int index = 0; index < list.getSize(); index++)
+    {
+      allEqual = allEqual and list[index] == expected[index];
+    }
+    CHECK(allEqual);
+    CHECK(list.getFront() == expected.front());
+    CHECK(list.getBack() == expected.back());
+
+    // the same values in the other list types are equal
+    AList<int> alist(2000, expected.data());
+    LList<int> llist(2000, expected.data());
+    DLList<int> dllist(2000, expected.data());
+    CHECK(list == alist);
+    CHECK(alist == list);
+    CHECK(list == llist);
+    CHECK(list == dllist);
+    list.deleteBack();
+    CHECK_FALSE(list == alist);
+    CHECK(list < alist);
+  }
+
+  SECTION("test splitting and concatenating lists")
+  {
+    int values[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    TList<int> list(8, values);
+
+    TList<int> backList = list.split(5);
+    CHECK(list.str() == "<list> size: 5 [ 1, 2, 3, 4, 5 ]");
+    CHECK(backList.str() == "<list> size: 3 [ 6, 7, 8 ]");
+    CHECK(list.getBack() == 5);
+    CHECK(backList.getFront() == 6);
+    CHECK_THROWS_AS(list.split(6), ListMemoryBoundsException);
+    CHECK_THROWS_AS(list.split(-1), ListMemoryBoundsException);
+
+    // splitting at either end leaves one of the lists empty
+    TList<int> emptyList = list.split(5);
+    CHECK(emptyList.isEmpty());
+    TList<int> allList = backList.split(0);
+    CHECK(backList.isEmpty());
+    CHECK(allList.str() == "<list> size: 3 [ 6, 7, 8 ]");
+
+    // concatenate in the other order, the concatenated list is emptied
+    allList.concat(move(list));
+    CHECK(allList.str() == "<list> size: 8 [ 6, 7, 8, 1, 2, 3, 4, 5 ]");
+    CHECK(list.isEmpty());
+    allList.insertAt(3, 0);
+    CHECK(allList.str() == "<list> size: 9 [ 6, 7, 8, 0, 1, 2, 3, 4, 5 ]");
+
+    // cut a large list into pieces and put it back together
+    TList<int> large;
+    for (int value = 0; value < 1000; value++)
+    {
+      large.insertBack(value);
+    }
+    TList<int> middle = large.split(300);
+    TList<int> last = middle.split(400);
+    CHECK(large.getSize() == 300);
+    CHECK(middle.getSize() == 400);
+    CHECK(last.getSize() == 300);
+    CHECK(middle[0] == 300);
+    CHECK(last[0] == 700);
+    large.concat(move(middle));
+    large.concat(move(last));
+    REQUIRE(large.getSize() == 1000);
+    bool allEqual = true;
+    for (int index = 0; index < large.getSize(); index++)
+    {
+      allEqual = allEqual and large[index] == index;
+    }
+    CHECK(allEqual);
+  }
+
+  SECTION("test deleting values from both ends and the middle")
+  {
+    int values[] = {1, 5, 2, 5, 3, 5, 4, 5};
+    TList<int> list(8, values);
+
+    list.deleteValue(5);
+    CHECK(list.str() == "<list> size: 4 [ 1, 2, 3, 4 ]");
+    CHECK(list.getBack() == 4);
+    CHECK_THROWS_AS(list.deleteValue(5), ListValueNotFoundException);
+
+    list.deleteIndex(2);
+    CHECK(list.str() == "<list> size: 3 [ 1, 2, 4 ]");
+    list.deleteIndex(0);
+    list.deleteIndex(1);
+    CHECK(list.str() == "<list> size: 1 [ 2 ]");
+    CHECK_THROWS_AS(list.deleteIndex(1), ListMemoryBoundsException);
+
+    for (int value = 0; value < 1000; value++)
+    {
+      list.insertBack(value % 4);
+    }
+    list.deleteValue(2);
+    list.deleteValue(0);
+    CHECK(list.getSize() == 500);
+    CHECK(list[0] == 1);
+    CHECK(list[1] == 3);
+
+    // draining from both ends
+    while (list.getSize() > 1)
+    {
+      list.deleteFront();
+      list.deleteBack();
+    }
+    CHECK(list.isEmpty());
+    CHECK_THROWS_AS(list.getFront(), ListEmptyException);
+  }
+
+  SECTION("test copy and move of lists")
+  {
+    int values[] = {1, 2, 3, 4};
+    TList<int> list(4, values);
+
+    TList<int> copy = list;
+    CHECK(copy == list);
+    copy.deleteBack();
+    CHECK(copy.str() == "<list> size: 3 [ 1, 2, 3 ]");
+    CHECK(list.str() == "<list> size: 4 [ 1, 2, 3, 4 ]");
+    CHECK(copy < list);
+
+    TList<int> moved = move(list);
+    CHECK(moved.str() == "<list> size: 4 [ 1, 2, 3, 4 ]");
+    CHECK(list.isEmpty());
+    list.insertBack(5);
+    CHECK(list.getFront() == 5);
+    CHECK(list.getBack() == 5);
+
+    moved = copy;
+    CHECK(moved == copy);
+    copy = move(moved);
+    CHECK(copy.str() == "<list> size: 3 [ 1, 2, 3 ]");
+    CHECK(moved.isEmpty());
+  }
+
+  SECTION("test list iteration")
+  {
+    // a tree of values built by inserting at positions all over the list
+    TList<int> list;
+    vector<int> expected;
+    for (int value = 0; value < 100; value++)
+    {
+      int index = (value * 37) % (expected.size() + 1);
+      list.insertAt(index, value);
+      expected.insert(expected.begin() + index, value);
+    }
+
+    // iterate using C++ explicit iterator object, the in order walk of
+    // the tree
+    TList<int>::iterator itr;
+    int index = 0;
+    for (itr = list.begin(); itr != list.end(); ++itr)
+    {
+      int item = *itr;
+      CHECK(item == expected[index]);
+      index++;
+    }
+    CHECK(index == 100);
+
+    // iterate using C++ range based iteration with cleaner syntax, but
+    // these use the iterator objects behind the scenes
+    index = 0;
+    for (int value : list)
+    {
+      CHECK(value == expected[index]);
+      index++;
+    }
+    CHECK(index == 100);
+
+    // values can be changed through the iterators
+    for (int& value : list)
+    {
+      value = -value;
+    }
+    CHECK(list.getFront() == -expected.front());
+    CHECK(count_if(list.begin(), list.end(), [](int value) { return value < 0; }) == 99);
+
+    // a const list gives const iterators, which compare with mutable ones
+    const TList<int>& constList = list;
+    TList<int>::const_iterator constItr = constList.begin();
+    CHECK(constItr == list.begin());
+    CHECK(*min_element(constList.begin(), constList.end()) == -99);
+    CHECK(distance(list.cbegin(), list.cend()) == 100);
+
+    // an empty list has nothing to iterate over
+    TList<int> empty;
+    CHECK(empty.begin() == empty.end());
+  }
+
+  SECTION("test comparing with doubly linked lists")
+  {
+    // neither list can be indexed in order quickly, so the treap walks
+    // the doubly linked list with its iterators, in either order
+    TList<int> list;
+    DLList<int> linked;
+    for (int value = 0; value < 20000; value++)
+    {
+      list.insertBack(value % 97);
+      linked.insertBack(value % 97);
+    }
+    CHECK(list == linked);
+    CHECK(linked == list);
+    CHECK_FALSE(list < linked);
+    CHECK_FALSE(linked < list);
+
+    // the first value that differs decides the order
+    linked.deleteIndex(15000);
+    linked.insertAt(15000, 100);
+    CHECK_FALSE(list == linked);
+    CHECK_FALSE(linked == list);
+    CHECK(list < linked);
+    CHECK_FALSE(linked < list);
+
+    // a list that runs out of values first orders first
+    linked.deleteIndex(15000);
+    linked.insertAt(15000, list[15000]);
+    linked.deleteBack();
+    CHECK_FALSE(list == linked);
+    CHECK(linked < list);
+    CHECK_FALSE(list < linked);
+  }
+
+  SECTION("test insert value at index")
+  {
+    TList<int> list;
+    list.insertAt(0, 5);
+    list.insertAt(0, 1);
+    list.insertAt(2, 9);
+    CHECK(list.str() == "<list> size: 3 [ 1, 5, 9 ]");
+
+    list.insertAt(1, 3);
+    list.insertAt(3, 7);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, 5, 7, 9 ]");
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 9);
+
+    CHECK_THROWS_AS(list.insertAt(-1, 0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(list.insertAt(6, 0), ListMemoryBoundsException);
+  }
+}
+
+/** Test TList<string> concrete implicit treap implementation of list of strings
+ */
+TEST_CASE("TList<string> test string list concrete implicit treap implementation", "[tlist]")
+{
+  SECTION("test insertion and deletion at both ends")
+  {
+    TList<string> list;
+    list.insertBack("charlie");
+    list.insertFront("bravo");
+    list.insertFront("alpha");
+    list.insertBack("delta");
+    CHECK(list.str() == "<list> size: 4 [ alpha, bravo, charlie, delta ]");
+
+    list.deleteBack();
+    list.deleteFront();
+    CHECK(list.str() == "<list> size: 2 [ bravo, charlie ]");
+    CHECK(list[1] == "charlie");
+    list.clear();
+    CHECK(list.isEmpty());
+    list.insertBack("echo");
+    CHECK(list.str() == "<list> size: 1 [ echo ]");
+  }
+
+  SECTION("test splitting and concatenating lists of strings")
+  {
+    string values[] = {"alpha", "bravo", "charlie", "delta"};
+    TList<string> list(4, values);
+
+    TList<string> backList = list.split(2);
+    backList.insertAt(1, string("hotel"));
+    backList.concat(move(list));
+    CHECK(backList.str() == "<list> size: 5 [ charlie, hotel, delta, alpha, bravo ]");
+    backList.deleteValue("hotel");
+    CHECK(backList[1] == "delta");
+  }
+}
@@ -0,0 +1,425 @@
+/** @file test-UList.cpp
+ * @brief Unit tests for the UList unrolled linked List implementation
+ *
+ * @author Derek Harter
+ * @note   class: COSC 2336, Summer 2021
+ * @note   ide  : VSCode Server 3.9.3, Gnu Development Tools
+ * @note   assg : Assignment Linked Lists
+ * @date   June 1, 2021
+ *
+ * This file contains test cases and individual unit tests for the
+ * UList unrolled linked list implementation of the List abstraction.
+ * This file uses the catch2 unit test framework to define the test
+ * cases and test assertions.
+ */
+#include "UList.hpp"
+#include "AList.hpp"
+#include "DLList.hpp"
+#include "LList.hpp"
+#include "ListException.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+using namespace std;
+
+/** Test UList<int> concrete unrolled linked implementation of list of integers
+ */
+TEST_CASE("UList<int> test integer list concrete unrolled linked implementation", "[ulist]")
+{
+  const int CAPACITY = UNode<int>::CAPACITY;
+
+  SECTION("test empty list is empty")
+  {
+    UList<int> empty;
+
+    // empty lists should be empty
+    CHECK(empty.getSize() == 0);
+    CHECK(empty.isEmpty());
+    CHECK(empty.getNodeCount() == 0);
+    CHECK(empty.str() == "<list> size: 0 [ ]");
+
+    // empty lists should compare as being equal
+    UList<int> otherEmpty;
+    CHECK(otherEmpty == empty);
+    CHECK(empty == otherEmpty);
+
+    // empty lists should complain if asked to get or delete a value
+    CHECK_THROWS_AS(empty.getFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.getBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteFront(), ListEmptyException);
+    CHECK_THROWS_AS(empty.deleteBack(), ListEmptyException);
+    CHECK_THROWS_AS(empty[0], ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteIndex(0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(empty.deleteValue(5), ListValueNotFoundException);
+  }
+
+  SECTION("test array based constructor and insertion at both ends")
+  {
+    int values[] = {1, 3, -2, -4, 7};
+    UList<int> list(5, values);
+
+    CHECK(list.getSize() == 5);
+    CHECK(list.getNodeCount() == 1);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, -2, -4, 7 ]");
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 7);
+    CHECK_THROWS_AS(list[-1], ListMemoryBoundsException);
+    CHECK_THROWS_AS(list[5], ListMemoryBoundsException);
+
+    list.insertBack(22);
+    list << -22;
+    list.insertFront(-38);
+    list >> 38;
+    CHECK(list.getSize() == 9);
+    CHECK(list.getFront() == -38);
+    CHECK(list.getBack() == 38);
+    CHECK(list.str() == "<list> size: 9 [ -38, -22, 1, 3, -2, -4, 7, 22, 38 ]");
+    list[7] = 99;
+    CHECK(list[7] == 99);
+
+    // equal to other list types with the same values
+    int otherValues[] = {-38, -22, 1, 3, -2, -4, 7, 99, 38};
+    AList<int> other(9, otherValues);
+    CHECK(list == other);
+    CHECK(other == list);
+    other[4] = 42;
+    CHECK_FALSE(list == other);
+    CHECK(list < other);
+  }
+
+  SECTION("test full nodes are split and sparse nodes are merged")
+  {
+    // appending fills each node completely before starting the next
+    UList<int> list;
+    for (int value = 0; value < 3 * CAPACITY; value++)
+    {
+      list.insertBack(value);
+    }
+    CHECK(list.getSize() == 3 * CAPACITY);
+    CHECK(list.getNodeCount() == 3);
+
+    // inserting into the middle of a full node splits it in two
+    list.insertAt(CAPACITY + 5, -1);
+    CHECK(list.getNodeCount() == 4);
+    CHECK(list.getSize() == 3 * CAPACITY + 1);
+    CHECK(list[CAPACITY + 4] == CAPACITY + 4);
+    CHECK(list[CAPACITY + 5] == -1);
+    CHECK(list[CAPACITY + 6] == CAPACITY + 5);
+    list.deleteIndex(CAPACITY + 5);
+
+    // every value is still where it belongs, walking forward and back
+    for (int index = 0; index < list.getSize(); index++)
+    {
+      CHECK(list[index] == index);
+    }
+    for (int index = list.getSize() - 1; index >= 0; index--)
+    {
+      CHECK(list[index] == index);
+    }
+
+    // deleting values until nodes are under half full merges them
+    while (list.getSize() > CAPACITY)
+    {
+      list.deleteIndex(list.getSize() / 2);
+    }
+    CHECK(list.getNodeCount() <= 2);
+    CHECK(list.getFront() == 0);
+    CHECK(list.getBack() == 3 * CAPACITY - 1);
+
+    // draining from the front gives all the nodes back
+    int count = list.getSize();
+    for (int index = 0; index < count; index++)
+    {
+      list.deleteFront();
+    }
+    CHECK(list.isEmpty());
+    CHECK(list.getNodeCount() == 0);
+    list.insertFront(8);
+    CHECK(list.getBack() == 8);
+  }
+
+  SECTION("test inserting in front and in the middle of large lists")
+  {
+    UList<int> list;
+    vector<int> expected;
+    for (int value = 0; value < 500; value++)
+    {
+      list.insertFront(value);
+      expected.insert(expected.begin(), value);
+    }
+    for (int value = 0; value < 500; value++)
+    {
+      int index = (value * 7) % (list.getSize() + 1);
+      list.insertAt(index, -value);
+      expected.insert(expected.begin() + index, -value);
+    }
+
+    REQUIRE(list.getSize() == 1000);
+    bool allEqual = true;
+    for (int index = 0; index < list.getSize(); index++)
+    {
+      allEqual = allEqual and list[index] == expected[index];
+    }
+    CHECK(allEqual);
+
+    // nodes stay at least half full on average
+    CHECK(list.getNodeCount() <= 2 * 1000 / CAPACITY + 1);
+
+    // the same values in the other list types are equal
+    AList<int> alist(1000, expected.data());
+    LList<int> llist(1000, expected.data());
+    DLList<int> dllist(1000, expected.data());
+    CHECK(list == alist);
+    CHECK(list == llist);
+    CHECK(list == dllist);
+    CHECK(dllist == list);
+    list.deleteBack();
+    CHECK_FALSE(list == alist);
+    CHECK(list < alist);
+  }
+
+  SECTION("test deleting values from both ends and the middle")
+  {
+    int values[] = {1, 5, 2, 5, 3, 5, 4, 5};
+    UList<int> list(8, values);
+
+    // deleting all values compacts the remaining values
+    list.deleteValue(5);
+    CHECK(list.str() == "<list> size: 4 [ 1, 2, 3, 4 ]");
+    CHECK(list.getBack() == 4);
+    CHECK_THROWS_AS(list.deleteValue(5), ListValueNotFoundException);
+
+    list.deleteIndex(2);
+    CHECK(list.str() == "<list> size: 3 [ 1, 2, 4 ]");
+    list.deleteIndex(0);
+    list.deleteIndex(1);
+    CHECK(list.str() == "<list> size: 1 [ 2 ]");
+    CHECK_THROWS_AS(list.deleteIndex(1), ListMemoryBoundsException);
+
+    // deleting a value spread over many nodes merges what is left over
+    for (int value = 0; value < 4 * CAPACITY; value++)
+    {
+      list.insertBack(value % 4);
+    }
+    CHECK(list.getNodeCount() == 5);
+    list.deleteValue(2);
+    list.deleteValue(0);
+    CHECK(list.getSize() == 2 * CAPACITY);
+    CHECK(list.getNodeCount() <= 3);
+    CHECK(list[0] == 1);
+    CHECK(list[1] == 3);
+    CHECK(list.getBack() == 3);
+
+    // draining from the back
+    while (not list.isEmpty())
+    {
+      list.deleteBack();
+    }
+    CHECK(list.getNodeCount() == 0);
+    CHECK_THROWS_AS(list.getFront(), ListEmptyException);
+  }
+
+  SECTION("test copy and move of lists")
+  {
+    UList<int> list;
+    for (int value = 0; value < 2 * CAPACITY; value++)
+    {
+      list.insertFront(value);
+    }
+
+    UList<int> copy = list;
+    CHECK(copy == list);
+    CHECK(copy.getNodeCount() == 2);
+    copy.deleteBack();
+    CHECK_FALSE(copy == list);
+    CHECK(list.getSize() == 2 * CAPACITY);
+
+    UList<int> moved = move(list);
+    CHECK(moved.getSize() == 2 * CAPACITY);
+    CHECK(list.isEmpty());
+    CHECK(list.getNodeCount() == 0);
+    list.insertBack(5);
+    CHECK(list.getFront() == 5);
+    CHECK(list.getBack() == 5);
+
+    moved = copy;
+    CHECK(moved == copy);
+    copy = move(moved);
+    CHECK(copy.getSize() == 2 * CAPACITY - 1);
+    CHECK(moved.isEmpty());
+  }
+
+  SECTION("test streaming output and writing ranges")
+  {
+    UList<int> list;
+    ostringstream empty;
+    empty << list;
+    CHECK(empty.str() == "<list> size: 0 [ ]");
+
+    // enough values to span several blocks
+    for (int value = 0; value < 200; value++)
+    {
+      list.insertBack(value);
+    }
+    CHECK(list.getNodeCount() > 2);
+    ostringstream all;
+    all << list;
+    CHECK(all.str() == list.str());
+
+    // a page crossing from one block into the next
+    ostringstream page;
+    list.writeTo(page, 60, 5);
+    CHECK(page.str() == "60, 61, 62, 63, 64");
+
+    // paging through the whole list gives all of the values
+    ostringstream pages;
+    for (int first = 0; first < list.getSize(); first += 30)
+    {
+      int count = min(30, list.getSize() - first);
+      list.writeTo(pages, first, count);
+      pages << (first + count < list.getSize() ? ", " : "");
+    }
+    CHECK("<list> size: 200 [ " + pages.str() + " ]" == list.str());
+
+    ostringstream none;
+    list.writeTo(none, 200, 0);
+    CHECK(none.str() == "");
+    CHECK_THROWS_AS(list.writeTo(none, 198, 3), ListMemoryBoundsException);
+    CHECK_THROWS_AS(list.writeTo(none, -1, 1), ListMemoryBoundsException);
+  }
+
+  SECTION("test list iteration")
+  {
+    // values spread over several nodes, with a split node in the middle
+    UList<int> list;
+    for (int value = 0; value < 3 * CAPACITY; value++)
+    {
+      list.insertBack(value);
+    }
+    list.insertAt(CAPACITY + 5, -1);
+    list.deleteIndex(CAPACITY + 5);
+    CHECK(list.getNodeCount() == 4);
+
+    // iterate using C++ explicit iterator object
+    UList<int>::iterator itr;
+    int index = 0;
+    for (itr = list.begin(); itr != list.end(); ++itr)
+    {
+      int item = *itr;
+      CHECK(item == index);
+      index++;
+    }
+    CHECK(index == 3 * CAPACITY);
+
+    // iterate using C++ range based iteration with cleaner syntax, but
+    // these use the iterator objects behind the scenes
+    index = 0;
+    for (int value : list)
+    {
+      CHECK(value == index);
+      index++;
+    }
+    CHECK(index == 3 * CAPACITY);
+
+    // values can be changed through the iterators
+    for (int& value : list)
+    {
+      value %= 2;
+    }
+    CHECK(count(list.begin(), list.end(), 1) == 3 * CAPACITY / 2);
+
+    // a const list gives const iterators, which compare with mutable ones
+    const UList<int>& constList = list;
+    UList<int>::const_iterator constItr = constList.begin();
+    CHECK(constItr == list.begin());
+    CHECK(*max_element(constList.begin(), constList.end()) == 1);
+    CHECK(distance(list.cbegin(), list.cend()) == 3 * CAPACITY);
+
+    // an empty list has nothing to iterate over
+    UList<int> empty;
+    CHECK(empty.begin() == empty.end());
+  }
+
+  SECTION("test insert value at index")
+  {
+    UList<int> list;
+    list.insertAt(0, 5);
+    list.insertAt(0, 1);
+    list.insertAt(2, 9);
+    CHECK(list.str() == "<list> size: 3 [ 1, 5, 9 ]");
+
+    list.insertAt(1, 3);
+    list.insertAt(3, 7);
+    CHECK(list.str() == "<list> size: 5 [ 1, 3, 5, 7, 9 ]");
+    CHECK(list.getFront() == 1);
+    CHECK(list.getBack() == 9);
+
+    CHECK_THROWS_AS(list.insertAt(-1, 0), ListMemoryBoundsException);
+    CHECK_THROWS_AS(list.insertAt(6, 0), ListMemoryBoundsException);
+  }
+}
+
+/** Test UList<string> concrete unrolled linked implementation of list of strings
+ */
+TEST_CASE("UList<string> test string list concrete unrolled linked implementation", "[ulist]")
+{
+  SECTION("test insertion and deletion at both ends")
+  {
+    UList<string> list;
+    list.insertBack("charlie");
+    list.insertFront("bravo");
+    list.insertFront("alpha");
+    list.insertBack("delta");
+    CHECK(list.str() == "<list> size: 4 [ alpha, bravo, charlie, delta ]");
+
+    list.deleteBack();
+    list.deleteFront();
+    CHECK(list.str() == "<list> size: 2 [ bravo, charlie ]");
+    CHECK(list[1] == "charlie");
+    list.clear();
+    CHECK(list.isEmpty());
+    list.insertBack("echo");
+    CHECK(list.str() == "<list> size: 1 [ echo ]");
+  }
+
+  SECTION("test splitting and merging nodes of strings")
+  {
+    const int CAPACITY = UNode<string>::CAPACITY;
+
+    // long strings live on the heap, so the values are really moved
+    // between the blocks of the nodes
+    UList<string> list;
+    vector<string> expected;
+    for (int value = 0; value < 4 * CAPACITY; value++)
+    {
+      string text = "a long string value that is not stored inline " + to_string(value);
+      list.insertAt(list.getSize() / 2, text);
+      expected.insert(expected.begin() + expected.size() / 2, text);
+    }
+    CHECK(list.getNodeCount() > 4);
+
+    bool allEqual = true;
+    for (int index = 0; index < list.getSize(); index++)
+    {
+      allEqual = allEqual and list[index] == expected[index];
+    }
+    CHECK(allEqual);
+
+    while (list.getSize() > 2)
+    {
+      list.deleteIndex(1);
+      expected.erase(expected.begin() + 1);
+    }
+    CHECK(list.getNodeCount() == 1);
+    CHECK(list[0] == expected[0]);
+    CHECK(list[1] == expected[1]);
+
+    string value = "hotel";
+    list.insertFront(move(value));
+    list.insertAt(1, string("india"));
+    CHECK(list[0] == "hotel");
+    CHECK(list[1] == "india");
+  }
+}